@@ -7,6 +7,7 @@
 #include "System/Asset/GCFAssetManager.h"
 #include "System/GCFGameData.h"
 #include "GCFShared.h"
+#include "System/GCFInputLatencyTracker.h"
 
 #include "Engine/World.h"
 #include "GameFramework/Pawn.h"
@@ -94,6 +95,20 @@ void UGCFAbilitySystemComponent::TryActivateAbilitiesOnSpawn()
 	}
 }
 
+void UGCFAbilitySystemComponent::OnGiveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	Super::OnGiveAbility(AbilitySpec);
+
+	OnActivatableAbilitiesChanged.Broadcast();
+}
+
+void UGCFAbilitySystemComponent::OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	Super::OnRemoveAbility(AbilitySpec);
+
+	OnActivatableAbilitiesChanged.Broadcast();
+}
+
 void UGCFAbilitySystemComponent::CancelAbilitiesByFunc(TShouldCancelAbilityFunc ShouldCancelFunc, bool bReplicateCancelAbility)
 {
 	ABILITYLIST_SCOPE_LOCK();
@@ -280,7 +295,15 @@ void UGCFAbilitySystemComponent::ProcessAbilityInput(float DeltaTime, bool bGame
 	//
 	for (const FGameplayAbilitySpecHandle& AbilitySpecHandle : AbilitiesToActivate)
 	{
-		TryActivateAbility(AbilitySpecHandle);
+		const bool bActivated = TryActivateAbility(AbilitySpecHandle);
+
+		if (bActivated && FGCFInputLatencyTracker::IsEnabled())
+		{
+			if (const FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandle(AbilitySpecHandle))
+			{
+				FGCFInputLatencyTracker::ReportAbilityActivation(AbilitySpec->GetDynamicSpecSourceTags());
+			}
+		}
 	}
 
 	//
@@ -317,10 +340,20 @@ void UGCFAbilitySystemComponent::ClearAbilityInput()
 	InputHeldSpecHandles.Reset();
 }
 
+void UGCFAbilitySystemComponent::InternalServerTryActivateAbility(FGameplayAbilitySpecHandle AbilityToActivate, bool InputPressed, const FPredictionKey& PredictionKey, const FGameplayEventData* TriggerEventData)
+{
+	// The activation (if any) happens inside this call, so a request that did not activate is dropped right after.
+	FGCFInputLatencyTracker::MarkServerAbilityRequest();
+	Super::InternalServerTryActivateAbility(AbilityToActivate, InputPressed, PredictionKey, TriggerEventData);
+	FGCFInputLatencyTracker::ClearServerAbilityRequest();
+}
+
 void UGCFAbilitySystemComponent::NotifyAbilityActivated(const FGameplayAbilitySpecHandle Handle, UGameplayAbility* Ability)
 {
 	Super::NotifyAbilityActivated(Handle, Ability);
 
+	FGCFInputLatencyTracker::ReportServerAbilityActivation();
+
 	if (UGCFGameplayAbility* GCFAbility = Cast<UGCFGameplayAbility>(Ability))
 	{
 		AddAbilityToActivationGroup(GCFAbility->GetActivationGroup(), GCFAbility);
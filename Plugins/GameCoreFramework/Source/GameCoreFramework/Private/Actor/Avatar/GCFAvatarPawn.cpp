@@ -7,6 +7,7 @@
 #include "Components/SkeletalMeshComponent.h"
 #include "Components/SphereComponent.h"
 #include "Movement/Mover/GCFCharacterMoverComponent.h"
+#include "Animation/GCFAvatarAnimInstance.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GCFAvatarPawn)
 
@@ -80,15 +81,64 @@ void AGCFAvatarPawn::PreInitializeComponents()
 void AGCFAvatarPawn::BeginPlay()
 {
 	Super::BeginPlay();
+
+	if (const USkeletalMeshComponent* SkeletalMesh = GetSkeletalMeshComponent()) {
+		DefaultMeshTickInterval = SkeletalMesh->GetComponentTickInterval();
+		DefaultVisibilityBasedAnimTickOption = SkeletalMesh->VisibilityBasedAnimTickOption;
+	}
+
+	if (UGCFAvatarSignificanceSubsystem* SignificanceSubsystem = UGCFAvatarSignificanceSubsystem::Get(this)) {
+		SignificanceSubsystem->RegisterAvatar(this);
+	}
 }
 
 
 void AGCFAvatarPawn::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	if (UGCFAvatarSignificanceSubsystem* SignificanceSubsystem = UGCFAvatarSignificanceSubsystem::Get(this)) {
+		SignificanceSubsystem->UnregisterAvatar(this);
+	}
+
 	Super::EndPlay(EndPlayReason);
 }
 
 
+void AGCFAvatarPawn::SetGCFSignificance(float NewSignificance, EGCFAnimUpdateTier NewTier)
+{
+	Significance = NewSignificance;
+	if (AnimUpdateTier == NewTier) {
+		return;
+	}
+	AnimUpdateTier = NewTier;
+
+	USkeletalMeshComponent* SkeletalMesh = GetSkeletalMeshComponent();
+	if (!SkeletalMesh) {
+		return;
+	}
+
+	const float TierTickInterval = UGCFAvatarSignificanceSubsystem::GetTierTickInterval(NewTier);
+	SkeletalMesh->SetComponentTickInterval(FMath::Max(TierTickInterval, DefaultMeshTickInterval));
+
+	switch (NewTier) {
+		case EGCFAnimUpdateTier::Minimal:
+			// The authority keeps updating bones it does not render; server-side hit detection reads them.
+			SkeletalMesh->VisibilityBasedAnimTickOption = HasAuthority() ? DefaultVisibilityBasedAnimTickOption : EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered;
+			break;
+		case EGCFAnimUpdateTier::ServerOnly:
+			// Montages keep ticking (and refresh bones while playing) so root motion and montage events stay correct.
+			SkeletalMesh->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesAndRefreshBonesWhenPlayingMontages;
+			break;
+		default:
+			SkeletalMesh->VisibilityBasedAnimTickOption = DefaultVisibilityBasedAnimTickOption;
+			break;
+	}
+
+	if (UGCFAvatarAnimInstance* AnimInstance = Cast<UGCFAvatarAnimInstance>(SkeletalMesh->GetAnimInstance())) {
+		AnimInstance->SetAnimUpdateTier(NewTier);
+	}
+}
+
+
 // --- Input Handlers (Push/Write) ---
 void AGCFAvatarPawn::HandleJumpInput_Implementation(bool bIsPressed)
 {
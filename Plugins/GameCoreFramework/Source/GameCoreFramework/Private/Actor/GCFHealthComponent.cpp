@@ -13,6 +13,7 @@
 #include "Messages/GCFVerbMessageHelpers.h"
 #include "GameFramework/GameplayMessageSubsystem.h"
 #include "GameFramework/PlayerState.h"
+#include "System/GCFGameState.h"
 #include "Engine/World.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GCFHealthComponent)
@@ -175,6 +176,15 @@ void UGCFHealthComponent::HandleOutOfHealth(AActor* DamageInstigator, AActor* Da
 
 			UGameplayMessageSubsystem& MessageSystem = UGameplayMessageSubsystem::Get(GetWorld());
 			MessageSystem.BroadcastMessage(Message.Verb, Message);
+
+			// Relay to the clients only when the game asked for it (e.g. a client-side kill feed)
+			if (bRelayEliminationToClients)
+			{
+				if (AGCFGameState* GameState = GetWorld()->GetGameState<AGCFGameState>())
+				{
+					GameState->SendMessageToRelevantClients(Message);
+				}
+			}
 		}
 
 		//@TODO: assist messages (could compute from damage dealt elsewhere)?
@@ -2,6 +2,7 @@
 // Portions Copyright (c) 2026 munimaru62o. All rights reserved.
 
 #include "Actor/Vehicle/GCFModularVehicle.h"
+#include "Actor/Vehicle/GCFVehicleSleepSubsystem.h"
 #include "Components/GameFrameworkComponentManager.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GCFModularVehicle)
@@ -18,11 +19,38 @@ void AGCFModularVehicle::BeginPlay()
 	UGameFrameworkComponentManager::SendGameFrameworkComponentExtensionEvent(this, UGameFrameworkComponentManager::NAME_GameActorReady);
 
 	Super::BeginPlay();
+
+	if (HasAuthority())
+	{
+		if (UGCFVehicleSleepSubsystem* SleepSubsystem = UGCFVehicleSleepSubsystem::Get(this))
+		{
+			SleepSubsystem->RegisterVehicle(this);
+		}
+	}
 }
 
 void AGCFModularVehicle::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	if (UGCFVehicleSleepSubsystem* SleepSubsystem = UGCFVehicleSleepSubsystem::Get(this))
+	{
+		SleepSubsystem->UnregisterVehicle(this);
+	}
+
 	UGameFrameworkComponentManager::RemoveGameFrameworkComponentReceiver(this);
 
 	Super::EndPlay(EndPlayReason);
 }
+
+void AGCFModularVehicle::NotifyControllerChanged()
+{
+	Super::NotifyControllerChanged();
+
+	// A driver must never find the vehicle asleep.
+	if (GetController())
+	{
+		if (UGCFVehicleSleepSubsystem* SleepSubsystem = UGCFVehicleSleepSubsystem::Get(this))
+		{
+			SleepSubsystem->WakeVehicle(this);
+		}
+	}
+}
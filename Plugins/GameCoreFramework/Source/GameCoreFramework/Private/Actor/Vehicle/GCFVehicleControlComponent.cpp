@@ -9,6 +9,7 @@
 #include "Input/GCFInputConfigProvider.h"
 #include "Input/GCFInputComponent.h"
 #include "Actor/Vehicle/GCFWheeledVehiclePawn.h"
+#include "ChaosVehicleMovementComponent.h"
 
 
 UGCFVehicleControlComponent::UGCFVehicleControlComponent(const FObjectInitializer& ObjectInitializer)
@@ -40,6 +41,45 @@ void UGCFVehicleControlComponent::EndPlay(const EEndPlayReason::Type EndPlayReas
 }
 
 
+void UGCFVehicleControlComponent::SetDriveInput(float Throttle, float Brake, float Steering)
+{
+	AGCFWheeledVehiclePawn* Vehicle = GetPawn<AGCFWheeledVehiclePawn>();
+	UChaosVehicleMovementComponent* VehicleMove = Vehicle ? Vehicle->GetVehicleMovementComponent() : nullptr;
+	if (!VehicleMove) {
+		return;
+	}
+
+	// The movement component holds its inputs until they are set again, so unchanged values need no push.
+	if (Throttle != LastThrottle) {
+		LastThrottle = Throttle;
+		VehicleMove->SetThrottleInput(Throttle);
+	}
+	if (Brake != LastBrake) {
+		LastBrake = Brake;
+		VehicleMove->SetBrakeInput(Brake);
+	}
+	if (Steering != LastSteering) {
+		LastSteering = Steering;
+		VehicleMove->SetSteeringInput(Steering);
+	}
+}
+
+
+void UGCFVehicleControlComponent::ResetDriveInput()
+{
+	// Pushed unconditionally: the movement component may have been reset behind our back.
+	LastThrottle = LastBrake = LastSteering = 0.0f;
+
+	if (AGCFWheeledVehiclePawn* Vehicle = GetPawn<AGCFWheeledVehiclePawn>()) {
+		if (UChaosVehicleMovementComponent* VehicleMove = Vehicle->GetVehicleMovementComponent()) {
+			VehicleMove->SetThrottleInput(0.0f);
+			VehicleMove->SetBrakeInput(0.0f);
+			VehicleMove->SetSteeringInput(0.0f);
+		}
+	}
+}
+
+
 void UGCFVehicleControlComponent::HandlePawnReadyStateChanged(const FGCFPawnReadyStateSnapshot& Snapshot)
 {
 	// We require both "Possessed" (Input Routing established) and "GamePlay" (Logic Initialized).
@@ -0,0 +1,302 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Actor/Vehicle/GCFVehicleSleepSubsystem.h"
+
+#include "GCFShared.h"
+#include "ChaosVehicleMovementComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "TimerManager.h"
+#include "WheeledVehiclePawn.h"
+#include "Actor/Vehicle/GCFVehicleControlComponent.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GCFVehicleSleepSubsystem)
+
+
+namespace GCF::VehicleSleep
+{
+static bool bEnable = false;
+static FAutoConsoleVariableRef CVarEnable(
+	TEXT("GCF.Vehicle.Sleep.Enable"),
+	bEnable,
+	TEXT("If true, unpossessed, stationary vehicles far from every player are put to sleep.")
+);
+
+static float EvaluationInterval = 0.5f;
+static FAutoConsoleVariableRef CVarEvaluationInterval(
+	TEXT("GCF.Vehicle.Sleep.EvaluationInterval"),
+	EvaluationInterval,
+	TEXT("Seconds between two sleep evaluations. Read at world begin play.")
+);
+
+static float Distance = 5000.0f;
+static FAutoConsoleVariableRef CVarDistance(
+	TEXT("GCF.Vehicle.Sleep.Distance"),
+	Distance,
+	TEXT("Minimum distance (cm) to every player view point for a vehicle to sleep. Closer vehicles are woken.")
+);
+
+static float SpeedThreshold = 10.0f;
+static FAutoConsoleVariableRef CVarSpeedThreshold(
+	TEXT("GCF.Vehicle.Sleep.SpeedThreshold"),
+	SpeedThreshold,
+	TEXT("Speed (cm/s) below which a vehicle counts as stationary.")
+);
+
+static float Delay = 2.0f;
+static FAutoConsoleVariableRef CVarDelay(
+	TEXT("GCF.Vehicle.Sleep.Delay"),
+	Delay,
+	TEXT("Seconds a vehicle must stay stationary before it may sleep.")
+);
+
+static float NetUpdateFrequency = 1.0f;
+static FAutoConsoleVariableRef CVarNetUpdateFrequency(
+	TEXT("GCF.Vehicle.Sleep.NetUpdateFrequency"),
+	NetUpdateFrequency,
+	TEXT("Net update frequency (Hz) of sleeping vehicles. 0 keeps the actor's own value.")
+);
+
+static int32 Force = INDEX_NONE;
+static FAutoConsoleVariableRef CVarForce(
+	TEXT("GCF.Vehicle.Sleep.Force"),
+	Force,
+	TEXT("Forces every unpossessed vehicle awake (0) or asleep (1), ignoring speed and distance. -1 uses the normal rules.")
+);
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorld CmdDump(
+	TEXT("GCF.Vehicle.Sleep.Dump"),
+	TEXT("Logs the number of sleeping and awake vehicles."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World) {
+		if (UGCFVehicleSleepSubsystem* Subsystem = UGCFVehicleSleepSubsystem::Get(World)) {
+			Subsystem->DumpVehicles();
+		}
+	})
+);
+#endif
+}
+
+
+UGCFVehicleSleepSubsystem* UGCFVehicleSleepSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr) {
+		return World->GetSubsystem<UGCFVehicleSleepSubsystem>();
+	}
+	return nullptr;
+}
+
+
+bool UGCFVehicleSleepSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+
+void UGCFVehicleSleepSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (GCF::VehicleSleep::EvaluationInterval > 0.0f) {
+		InWorld.GetTimerManager().SetTimer(EvaluateTimerHandle, FTimerDelegate::CreateUObject(this, &ThisClass::EvaluateVehicles), GCF::VehicleSleep::EvaluationInterval, true);
+	}
+}
+
+
+void UGCFVehicleSleepSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld()) {
+		World->GetTimerManager().ClearTimer(EvaluateTimerHandle);
+	}
+	for (FManagedVehicle& Entry : ManagedVehicles) {
+		Wake(Entry);
+	}
+	ManagedVehicles.Empty();
+
+	Super::Deinitialize();
+}
+
+
+void UGCFVehicleSleepSubsystem::RegisterVehicle(AWheeledVehiclePawn* Vehicle)
+{
+	if (!Vehicle || FindEntry(Vehicle)) {
+		return;
+	}
+
+	FManagedVehicle& Entry = ManagedVehicles.AddDefaulted_GetRef();
+	Entry.Vehicle = Vehicle;
+}
+
+
+void UGCFVehicleSleepSubsystem::UnregisterVehicle(AWheeledVehiclePawn* Vehicle)
+{
+	const int32 Index = ManagedVehicles.IndexOfByPredicate([Vehicle](const FManagedVehicle& Entry) { return Entry.Vehicle == Vehicle; });
+	if (Index != INDEX_NONE) {
+		Wake(ManagedVehicles[Index]);
+		ManagedVehicles.RemoveAtSwap(Index);
+	}
+}
+
+
+void UGCFVehicleSleepSubsystem::WakeVehicle(AWheeledVehiclePawn* Vehicle)
+{
+	if (FManagedVehicle* Entry = FindEntry(Vehicle)) {
+		Entry->StationaryTime = 0.0f;
+		Wake(*Entry);
+	}
+}
+
+
+bool UGCFVehicleSleepSubsystem::IsVehicleSleeping(const AWheeledVehiclePawn* Vehicle) const
+{
+	const FManagedVehicle* Entry = ManagedVehicles.FindByPredicate([Vehicle](const FManagedVehicle& Candidate) { return Candidate.Vehicle == Vehicle; });
+	return Entry && Entry->bSleeping;
+}
+
+
+UGCFVehicleSleepSubsystem::FManagedVehicle* UGCFVehicleSleepSubsystem::FindEntry(const AWheeledVehiclePawn* Vehicle)
+{
+	return ManagedVehicles.FindByPredicate([Vehicle](const FManagedVehicle& Candidate) { return Candidate.Vehicle == Vehicle; });
+}
+
+
+void UGCFVehicleSleepSubsystem::EvaluateVehicles()
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_GCFVehicleSleep_Evaluate);
+
+	UWorld* World = GetWorld();
+	if (!World) {
+		return;
+	}
+
+	ManagedVehicles.RemoveAllSwap([](const FManagedVehicle& Entry) { return !Entry.Vehicle.IsValid(); });
+
+	// On the authority every player controller is iterated, so this covers every connected player's view.
+	TArray<FVector, TInlineAllocator<8>> ViewLocations;
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It) {
+		if (const APlayerController* PlayerController = It->Get()) {
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			ViewLocations.Add(ViewLocation);
+		}
+	}
+
+	const float Interval = FMath::Max(GCF::VehicleSleep::EvaluationInterval, UE_KINDA_SMALL_NUMBER);
+	const float SpeedThresholdSquared = FMath::Square(GCF::VehicleSleep::SpeedThreshold);
+	const float DistanceSquared = FMath::Square(GCF::VehicleSleep::Distance);
+
+	for (FManagedVehicle& Entry : ManagedVehicles) {
+		const AWheeledVehiclePawn* Vehicle = Entry.Vehicle.Get();
+
+		if (!GCF::VehicleSleep::bEnable || Vehicle->GetController() || GCF::VehicleSleep::Force == 0) {
+			Entry.StationaryTime = 0.0f;
+			Wake(Entry);
+			continue;
+		}
+
+		if (GCF::VehicleSleep::Force > 0) {
+			Sleep(Entry);
+			continue;
+		}
+
+		// A sleeping vehicle is stationary by definition; its velocity is not updated until it wakes.
+		if (!Entry.bSleeping) {
+			Entry.StationaryTime = Vehicle->GetVelocity().SizeSquared() < SpeedThresholdSquared ? Entry.StationaryTime + Interval : 0.0f;
+		}
+
+		const FVector VehicleLocation = Vehicle->GetActorLocation();
+		const bool bPlayerNearby = ViewLocations.ContainsByPredicate([&VehicleLocation, DistanceSquared](const FVector& ViewLocation) {
+			return FVector::DistSquared(VehicleLocation, ViewLocation) < DistanceSquared;
+		});
+
+		if (bPlayerNearby) {
+			Wake(Entry);
+		} else if (Entry.StationaryTime >= GCF::VehicleSleep::Delay) {
+			Sleep(Entry);
+		}
+	}
+}
+
+
+void UGCFVehicleSleepSubsystem::Sleep(FManagedVehicle& Entry)
+{
+	AWheeledVehiclePawn* Vehicle = Entry.Vehicle.Get();
+	if (Entry.bSleeping || !Vehicle) {
+		return;
+	}
+	Entry.bSleeping = true;
+
+	Entry.DefaultNetUpdateFrequency = Vehicle->GetNetUpdateFrequency();
+	if (GCF::VehicleSleep::NetUpdateFrequency > 0.0f) {
+		Vehicle->SetNetUpdateFrequency(FMath::Min(GCF::VehicleSleep::NetUpdateFrequency, Entry.DefaultNetUpdateFrequency));
+	}
+
+	if (UGCFVehicleControlComponent* ControlComponent = Vehicle->FindComponentByClass<UGCFVehicleControlComponent>()) {
+		Entry.bControlTickWasEnabled = ControlComponent->IsComponentTickEnabled();
+		ControlComponent->SetComponentTickEnabled(false);
+	}
+
+	if (UChaosVehicleMovementComponent* VehicleMovement = Vehicle->GetVehicleMovementComponent()) {
+		VehicleMovement->SetSleeping(true);
+		Entry.bMovementTickWasEnabled = VehicleMovement->IsComponentTickEnabled();
+		VehicleMovement->SetComponentTickEnabled(false);
+	}
+
+	if (USkeletalMeshComponent* Mesh = Vehicle->GetMesh()) {
+		Mesh->PutAllRigidBodiesToSleep();
+
+		// Hits are only needed to wake up; awake vehicles keep their own notify setting.
+		Entry.bDefaultNotifyRigidBodyCollision = Mesh->BodyInstance.bNotifyRigidBodyCollision;
+		Mesh->SetNotifyRigidBodyCollision(true);
+		Mesh->OnComponentHit.AddUniqueDynamic(this, &ThisClass::HandleVehicleHit);
+	}
+}
+
+
+void UGCFVehicleSleepSubsystem::Wake(FManagedVehicle& Entry)
+{
+	AWheeledVehiclePawn* Vehicle = Entry.Vehicle.Get();
+	if (!Entry.bSleeping || !Vehicle) {
+		return;
+	}
+	Entry.bSleeping = false;
+
+	if (USkeletalMeshComponent* Mesh = Vehicle->GetMesh()) {
+		Mesh->OnComponentHit.RemoveDynamic(this, &ThisClass::HandleVehicleHit);
+		Mesh->SetNotifyRigidBodyCollision(Entry.bDefaultNotifyRigidBodyCollision);
+		Mesh->WakeAllRigidBodies();
+	}
+
+	if (UChaosVehicleMovementComponent* VehicleMovement = Vehicle->GetVehicleMovementComponent()) {
+		VehicleMovement->SetComponentTickEnabled(Entry.bMovementTickWasEnabled);
+		VehicleMovement->SetSleeping(false);
+	}
+
+	if (UGCFVehicleControlComponent* ControlComponent = Vehicle->FindComponentByClass<UGCFVehicleControlComponent>()) {
+		ControlComponent->SetComponentTickEnabled(Entry.bControlTickWasEnabled);
+	}
+
+	Vehicle->SetNetUpdateFrequency(Entry.DefaultNetUpdateFrequency);
+	Vehicle->ForceNetUpdate();
+}
+
+
+void UGCFVehicleSleepSubsystem::HandleVehicleHit(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit)
+{
+	if (AWheeledVehiclePawn* Vehicle = HitComponent ? Cast<AWheeledVehiclePawn>(HitComponent->GetOwner()) : nullptr) {
+		WakeVehicle(Vehicle);
+	}
+}
+
+
+void UGCFVehicleSleepSubsystem::DumpVehicles() const
+{
+	const int32 SleepingCount = ManagedVehicles.FilterByPredicate([](const FManagedVehicle& Entry) { return Entry.bSleeping; }).Num();
+	UE_LOG(LogGCFCharacter, Display, TEXT("GCF.Vehicle.Sleep: %d managed vehicles, %d sleeping, %d awake (enabled %d, force %d)."),
+		   ManagedVehicles.Num(), SleepingCount, ManagedVehicles.Num() - SleepingCount, GCF::VehicleSleep::bEnable, GCF::VehicleSleep::Force);
+}
+
@@ -11,6 +11,20 @@
 #include "Actor/Vehicle/GCFVehicleControlComponent.h"
 #include "Input/GCFPawnInputBridgeComponent.h"
 #include "Net/UnrealNetwork.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "GCFShared.h"
+
+
+namespace GCF::VehicleCosmetic
+{
+static float ResendInterval = 0.2f;
+static FAutoConsoleVariableRef CVarResendInterval(
+	TEXT("GCF.Vehicle.Cosmetic.ResendInterval"),
+	ResendInterval,
+	TEXT("Seconds between two resends of an unacknowledged cosmetic vehicle state request.")
+);
+}
 
 
 AGCFWheeledVehiclePawn::AGCFWheeledVehiclePawn(const FObjectInitializer& ObjectInitializer)
@@ -33,7 +47,8 @@ AGCFWheeledVehiclePawn::AGCFWheeledVehiclePawn(const FObjectInitializer& ObjectI
 void AGCFWheeledVehiclePawn::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-	DOREPLIFETIME(AGCFWheeledVehiclePawn, bIsHeadLightTurnOn);
+	DOREPLIFETIME(AGCFWheeledVehiclePawn, CosmeticState);
+	DOREPLIFETIME_CONDITION(AGCFWheeledVehiclePawn, AppliedCosmeticSequence, COND_OwnerOnly);
 }
 
 
@@ -59,6 +74,9 @@ void AGCFWheeledVehiclePawn::PossessedBy(AController* NewController)
 {
 	Super::PossessedBy(NewController);
 
+	// The new driver's client numbers its cosmetic requests from zero.
+	AppliedCosmeticSequence = 0;
+
 	// Notify extension component on Server side possession.
 	if (PawnExtensionComponent) {
 		PawnExtensionComponent->OnControllerAssigned();
@@ -93,6 +111,21 @@ void AGCFWheeledVehiclePawn::OnRep_Controller()
 }
 
 
+void AGCFWheeledVehiclePawn::NotifyControllerChanged()
+{
+	Super::NotifyControllerChanged();
+
+	// Runs on the server and the owning client: the drive inputs cached for the previous driver are stale on both.
+	VehicleControlComponent->ResetDriveInput();
+
+	// A pending request belongs to the previous driver.
+	if (!HasAuthority()) {
+		GetWorldTimerManager().ClearTimer(CosmeticResendTimerHandle);
+		CosmeticRequest = FGCFVehicleCosmeticRequest();
+	}
+}
+
+
 void AGCFWheeledVehiclePawn::OnRep_PlayerState()
 {
 	Super::OnRep_PlayerState();
@@ -107,14 +140,13 @@ void AGCFWheeledVehiclePawn::OnRep_PlayerState()
 
 void AGCFWheeledVehiclePawn::HandleMoveInput_Implementation(const FVector2D& InputValue, const FRotator& MovementRotation)
 {
-	UChaosVehicleMovementComponent* VehicleMove = GetVehicleMovementComponent();
-
-	// Map X-axis (W/S) to Throttle and Brake
-	VehicleMove->SetThrottleInput(InputValue.X > 0 ? InputValue.X : 0.0f);
-	VehicleMove->SetBrakeInput(InputValue.X < 0 ? -InputValue.X : 0.0f);
-
-	// Map Y-axis (A/D) to Steering
-	VehicleMove->SetSteeringInput(InputValue.Y);
+	// Map X-axis (W/S) to Throttle and Brake, and Y-axis (A/D) to Steering.
+	// The control component only forwards the values that changed since the last input event.
+	VehicleControlComponent->SetDriveInput(
+		InputValue.X > 0 ? InputValue.X : 0.0f,
+		InputValue.X < 0 ? -InputValue.X : 0.0f,
+		InputValue.Y
+	);
 }
 
 
@@ -131,7 +163,9 @@ void AGCFWheeledVehiclePawn::ToggleHandBrakeInput()
 
 void AGCFWheeledVehiclePawn::ToggleHeadLightInput()
 {
-	SetHeadLightState(!bIsHeadLightTurnOn);
+	// Toggles build on the pending request, so quick successive toggles are not lost.
+	const uint8 LocalState = CosmeticRequest.Predict(CosmeticState);
+	SetCosmeticState(EGCFVehicleCosmeticState::HeadLight, !EnumHasAnyFlags(static_cast<EGCFVehicleCosmeticState>(LocalState), EGCFVehicleCosmeticState::HeadLight));
 }
 
 
@@ -139,33 +173,131 @@ void AGCFWheeledVehiclePawn::SetHandBrake(bool bNewHandbrake)
 {
 	bIsHandbraking = bNewHandbrake;
 	GetVehicleMovementComponent()->SetHandbrakeInput(bIsHandbraking);
+	SetCosmeticState(EGCFVehicleCosmeticState::HandBrake, bIsHandbraking);
 }
 
 
-void AGCFWheeledVehiclePawn::SetHeadLightState(bool bNewHeadLight)
+void AGCFWheeledVehiclePawn::SetCosmeticState(EGCFVehicleCosmeticState Flag, bool bEnabled)
 {
+	const uint8 FlagBits = static_cast<uint8>(Flag);
+
 	if (HasAuthority()) {
-		if (bIsHeadLightTurnOn != bNewHeadLight) {
-			bIsHeadLightTurnOn = bNewHeadLight;
+		ApplyCosmeticState(static_cast<uint8>(bEnabled ? (CosmeticState | FlagBits) : (CosmeticState & ~FlagBits)));
+		return;
+	}
+
+	// Only the driver's client owns the connection the RPC travels on; other clients wait for the server.
+	if (!IsLocallyControlled()) {
+		return;
+	}
+
+	if (!CosmeticRequest.Request(Flag, bEnabled, CosmeticState)) {
+		return;
+	}
+	SendCosmeticStateRequest();
+
+	if (!CosmeticResendTimerHandle.IsValid()) {
+		GetWorldTimerManager().SetTimer(CosmeticResendTimerHandle, this, &ThisClass::SendCosmeticStateRequest, FMath::Max(GCF::VehicleCosmetic::ResendInterval, 0.01f), true);
+	}
+}
 
-			// Manually call OnRep on the server so the visual changes occur locally as well.
-			OnRep_IsHeadLightTurnOn();
-		}
+
+void AGCFWheeledVehiclePawn::SendCosmeticStateRequest()
+{
+	Server_SetCosmeticState(CosmeticRequest.SetMask, CosmeticRequest.ClearMask, CosmeticRequest.Sequence);
+}
+
+
+void AGCFWheeledVehiclePawn::Server_SetCosmeticState_Implementation(uint8 SetMask, uint8 ClearMask, uint8 Sequence)
+{
+	uint8 NewState = CosmeticState;
+	if (FGCFVehicleCosmeticRequest::ApplyRequest(NewState, AppliedCosmeticSequence, SetMask, ClearMask, Sequence)) {
+		ApplyCosmeticState(NewState);
+	}
+}
+
+
+void AGCFWheeledVehiclePawn::ApplyCosmeticState(uint8 NewState)
+{
+	if (CosmeticState == NewState) {
+		return;
+	}
+
+	const uint8 OldState = CosmeticState;
+	CosmeticState = NewState;
+
+	// Manually fire the hooks on the server so the visual changes occur locally as well.
+	NotifyCosmeticStateChanged(OldState);
+}
+
+
+void AGCFWheeledVehiclePawn::OnRep_CosmeticState(uint8 OldState)
+{
+	NotifyCosmeticStateChanged(OldState);
+}
+
+
+void AGCFWheeledVehiclePawn::OnRep_AppliedCosmeticSequence()
+{
+	if (CosmeticRequest.Acknowledge(AppliedCosmeticSequence)) {
+		GetWorldTimerManager().ClearTimer(CosmeticResendTimerHandle);
+	}
+}
+
+
+bool FGCFVehicleCosmeticRequest::Request(EGCFVehicleCosmeticState Flag, bool bEnabled, uint8 ReplicatedState)
+{
+	const uint8 FlagBits = static_cast<uint8>(Flag);
+	const uint8 PredictedState = Predict(ReplicatedState);
+	if (((PredictedState & FlagBits) != 0) == bEnabled) {
+		return false;
+	}
+
+	// Explicit in both directions: an earlier request that set the bit may still reach the server.
+	if (bEnabled) {
+		SetMask |= FlagBits;
+		ClearMask &= ~FlagBits;
 	} else {
-		// If we are a client, request the server to apply the state change.
-		Server_SetHeadLightState(bNewHeadLight);
+		ClearMask |= FlagBits;
+		SetMask &= ~FlagBits;
 	}
+	++Sequence;
+	return true;
 }
 
-void AGCFWheeledVehiclePawn::Server_SetHeadLightState_Implementation(bool bNewHeadLight)
+
+bool FGCFVehicleCosmeticRequest::Acknowledge(uint8 AppliedSequence)
 {
-	SetHeadLightState(bNewHeadLight);
+	if (!IsPending() || IsNewerSequence(Sequence, AppliedSequence)) {
+		return false;
+	}
+	SetMask = ClearMask = 0;
+	return true;
 }
 
 
-void AGCFWheeledVehiclePawn::OnRep_IsHeadLightTurnOn()
+bool FGCFVehicleCosmeticRequest::ApplyRequest(uint8& InOutState, uint8& InOutAppliedSequence, uint8 InSetMask, uint8 InClearMask, uint8 InSequence)
 {
-	HandleHeadLightStateChange(bIsHeadLightTurnOn);
+	// Resends repeat the sequence of an applied request, and late packets carry an older one: both are ignored.
+	if (!IsNewerSequence(InSequence, InOutAppliedSequence)) {
+		return false;
+	}
+	InOutAppliedSequence = InSequence;
+	InOutState = Apply(InOutState, InSetMask, InClearMask);
+	return true;
+}
+
+
+void AGCFWheeledVehiclePawn::NotifyCosmeticStateChanged(uint8 OldState)
+{
+	const uint8 ChangedBits = OldState ^ CosmeticState;
+
+	if (ChangedBits & static_cast<uint8>(EGCFVehicleCosmeticState::HeadLight)) {
+		HandleHeadLightStateChange(HasCosmeticState(EGCFVehicleCosmeticState::HeadLight));
+	}
+	if (ChangedBits & static_cast<uint8>(EGCFVehicleCosmeticState::HandBrake)) {
+		HandleHandBrakeIndicatorChange(HasCosmeticState(EGCFVehicleCosmeticState::HandBrake));
+	}
 }
 
 
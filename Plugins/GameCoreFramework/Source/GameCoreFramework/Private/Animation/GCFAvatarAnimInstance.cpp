@@ -9,6 +9,9 @@
 #include "GameplayTagContainer.h"
 #include "GCFShared.h"
 #include "KismetAnimationLibrary.h"
+#include "Animation/GCFMoverAnimSnapshot.h"
+#include "Movement/Mover/GCFCharacterMoverComponent.h"
+#include "Movement/Mover/GCFMoverComponent.h"
 
 
 UGCFAvatarAnimInstance::UGCFAvatarAnimInstance(const FObjectInitializer& ObjectInitializer)
@@ -17,8 +20,11 @@ UGCFAvatarAnimInstance::UGCFAvatarAnimInstance(const FObjectInitializer& ObjectI
 	GroundSpeed = 0.0f;
 	VerticalVelocity = 0.0f;
 	bHasAcceleration = false;
+	bIsOnGround = false;
 	bIsFalling = false;
 	bIsCrouched = false;
+	Velocity = FVector::ZeroVector;
+	Acceleration = FVector::ZeroVector;
 	CurrentMovementMode = NAME_None;
 }
 
@@ -29,21 +35,67 @@ void UGCFAvatarAnimInstance::NativeInitializeAnimation()
 	// Cache the owning pawn
 	OwningPawn = TryGetPawnOwner();
 	if (OwningPawn) {
-		MoverComponent = OwningPawn->FindComponentByClass<UMoverComponent>();
+		ResolveMoverComponent();
 	}
 }
 
+
+void UGCFAvatarAnimInstance::NativeUninitializeAnimation()
+{
+	ReleaseSnapshotBuffer();
+
+	Super::NativeUninitializeAnimation();
+}
+
+
+void UGCFAvatarAnimInstance::ResolveMoverComponent()
+{
+	ReleaseSnapshotBuffer();
+	MoverComponent = OwningPawn->FindComponentByClass<UMoverComponent>();
+
+	if (UGCFCharacterMoverComponent* CharacterMover = Cast<UGCFCharacterMoverComponent>(MoverComponent)) {
+		SnapshotBuffer = &CharacterMover->GetAnimSnapshotBuffer();
+	} else if (UGCFMoverComponent* GCFMover = Cast<UGCFMoverComponent>(MoverComponent)) {
+		SnapshotBuffer = &GCFMover->GetAnimSnapshotBuffer();
+	}
+
+	// The component only publishes while someone reads the snapshot.
+	if (SnapshotBuffer) {
+		SnapshotBuffer->AddReader();
+	}
+}
+
+
+void UGCFAvatarAnimInstance::ReleaseSnapshotBuffer()
+{
+	// The buffer lives in the component; once the component is gone there is nothing to unregister from.
+	if (SnapshotBuffer && IsValid(MoverComponent)) {
+		SnapshotBuffer->RemoveReader();
+	}
+	SnapshotBuffer = nullptr;
+	bReadSnapshot = false;
+}
+
 void UGCFAvatarAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
 {
 	Super::NativeUpdateAnimation(DeltaSeconds);
 
+	// The tier is set from the game thread at any time; the worker thread only sees this frame's copy.
+	ThreadSafeAnimUpdateTier = AnimUpdateTier;
+
 	if (!OwningPawn) {
 		return;
 	}
 
 	// If Mover is not found yet, try to find it again (handle late initialization)
 	if (!MoverComponent) {
-		MoverComponent = OwningPawn->FindComponentByClass<UMoverComponent>();
+		ResolveMoverComponent();
+	}
+
+	// GCF Mover components publish a snapshot that is read on the worker thread, as long as it is this frame's.
+	bReadSnapshot = SnapshotBuffer && SnapshotBuffer->IsPublishedInFrame(GFrameCounter);
+	if (bReadSnapshot) {
+		return;
 	}
 
 	// ------------------------------------------------------------------------
@@ -52,7 +104,9 @@ void UGCFAvatarAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
 	// Do NOT perform heavy math operations in this function.
 	// ------------------------------------------------------------------------
 	if (MoverComponent) {
-		Velocity = MoverComponent->GetVelocity();
+		const FVector NewVelocity = MoverComponent->GetVelocity();
+		Acceleration = (SnapshotBuffer && DeltaSeconds > UE_SMALL_NUMBER) ? (NewVelocity - Velocity) / DeltaSeconds : FVector::ZeroVector;
+		Velocity = NewVelocity;
 		CachedActorRotation = OwningPawn->GetActorRotation();
 
 		bHasAcceleration = HasAcceleration();
@@ -60,6 +114,7 @@ void UGCFAvatarAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
 
 		// Determine Falling state using Native Gameplay Tags instead of hardcoded strings or class casting.
 		bIsFalling = MoverComponent->HasGameplayTag(Mover_IsFalling, true);
+		bIsOnGround = MoverComponent->HasGameplayTag(Mover_IsOnGround, true);
 
 		// Retrieve crouch state directly via Native Gameplay Tags to avoid hard casting.
 		bIsCrouched = MoverComponent->HasGameplayTag(Mover_IsCrouching, true);
@@ -77,13 +132,30 @@ void UGCFAvatarAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
 	// Do NOT call functions on Actors or Components (like GetActorRotation) here.
 	// ------------------------------------------------------------------------
 
+	// The snapshot buffer is the only thread-safe source of Mover data.
+	if (bReadSnapshot) {
+		const FGCFMoverAnimSnapshot& Snapshot = SnapshotBuffer->Read();
+		Velocity = Snapshot.Velocity;
+		Acceleration = Snapshot.Acceleration;
+		CachedActorRotation = Snapshot.Rotation;
+		CurrentMovementMode = Snapshot.MovementMode;
+		bHasAcceleration = Snapshot.bHasAcceleration;
+		bIsOnGround = Snapshot.bIsOnGround;
+		bIsFalling = Snapshot.bIsFalling;
+		bIsCrouched = Snapshot.bIsCrouched;
+	}
+
 	VerticalVelocity = Velocity.Z;
 	GroundSpeed = Velocity.Size2D();
+	bShouldMove = GroundSpeed > 3.0f;
+
+	// Nobody sees the pose on a dedicated server; the direction only feeds blend spaces.
+	if (ThreadSafeAnimUpdateTier == EGCFAnimUpdateTier::ServerOnly) {
+		return;
+	}
 
 	// Safely calculate direction using the cached rotation
 	MovementDirection = UKismetAnimationLibrary::CalculateDirection(Velocity, CachedActorRotation);
-
-	bShouldMove = GroundSpeed > 3.0f;
 }
 
 
@@ -0,0 +1,223 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Animation/GCFAvatarSignificanceSubsystem.h"
+
+#include "GCFShared.h"
+#include "Actor/Avatar/GCFAvatarPawn.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "TimerManager.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GCFAvatarSignificanceSubsystem)
+
+
+namespace GCF::AvatarSignificance
+{
+static bool bEnable = false;
+static FAutoConsoleVariableRef CVarEnable(
+	TEXT("GCF.Anim.Significance.Enable"),
+	bEnable,
+	TEXT("If true, avatar animation update rates follow the avatar's GCF significance.")
+);
+
+static float EvaluationInterval = 0.2f;
+static FAutoConsoleVariableRef CVarEvaluationInterval(
+	TEXT("GCF.Anim.Significance.EvaluationInterval"),
+	EvaluationInterval,
+	TEXT("Seconds between two significance evaluations. Read at world begin play.")
+);
+
+static float NearDistance = 1500.0f;
+static FAutoConsoleVariableRef CVarNearDistance(
+	TEXT("GCF.Anim.Significance.NearDistance"),
+	NearDistance,
+	TEXT("Distance (cm) to the nearest local view up to which an avatar has significance 1.")
+);
+
+static float FarDistance = 6000.0f;
+static FAutoConsoleVariableRef CVarFarDistance(
+	TEXT("GCF.Anim.Significance.FarDistance"),
+	FarDistance,
+	TEXT("Distance (cm) to the nearest local view from which an avatar has significance 0.")
+);
+
+static float ReducedBelow = 0.6f;
+static FAutoConsoleVariableRef CVarReducedBelow(
+	TEXT("GCF.Anim.Significance.ReducedBelow"),
+	ReducedBelow,
+	TEXT("Significance below which an avatar animates in the Reduced tier.")
+);
+
+static float MinimalBelow = 0.2f;
+static FAutoConsoleVariableRef CVarMinimalBelow(
+	TEXT("GCF.Anim.Significance.MinimalBelow"),
+	MinimalBelow,
+	TEXT("Significance below which an avatar animates in the Minimal tier.")
+);
+
+static float Hysteresis = 0.05f;
+static FAutoConsoleVariableRef CVarHysteresis(
+	TEXT("GCF.Anim.Significance.Hysteresis"),
+	Hysteresis,
+	TEXT("Significance margin around the tier thresholds that must be crossed before an avatar changes tier again.")
+);
+
+static float ReducedTickInterval = 1.0f / 30.0f;
+static FAutoConsoleVariableRef CVarReducedTickInterval(
+	TEXT("GCF.Anim.Significance.ReducedTickInterval"),
+	ReducedTickInterval,
+	TEXT("Skeletal mesh tick interval (s) of avatars in the Reduced tier.")
+);
+
+static float MinimalTickInterval = 1.0f / 10.0f;
+static FAutoConsoleVariableRef CVarMinimalTickInterval(
+	TEXT("GCF.Anim.Significance.MinimalTickInterval"),
+	MinimalTickInterval,
+	TEXT("Skeletal mesh tick interval (s) of avatars in the Minimal tier.")
+);
+}
+
+
+UGCFAvatarSignificanceSubsystem* UGCFAvatarSignificanceSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr) {
+		return World->GetSubsystem<UGCFAvatarSignificanceSubsystem>();
+	}
+	return nullptr;
+}
+
+
+bool UGCFAvatarSignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+
+void UGCFAvatarSignificanceSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (GCF::AvatarSignificance::EvaluationInterval > 0.0f) {
+		InWorld.GetTimerManager().SetTimer(EvaluateTimerHandle, FTimerDelegate::CreateUObject(this, &ThisClass::EvaluateSignificance), GCF::AvatarSignificance::EvaluationInterval, true);
+	}
+}
+
+
+void UGCFAvatarSignificanceSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld()) {
+		World->GetTimerManager().ClearTimer(EvaluateTimerHandle);
+	}
+	Avatars.Empty();
+
+	Super::Deinitialize();
+}
+
+
+void UGCFAvatarSignificanceSubsystem::RegisterAvatar(AGCFAvatarPawn* Avatar)
+{
+	if (Avatar) {
+		Avatars.AddUnique(Avatar);
+	}
+}
+
+
+void UGCFAvatarSignificanceSubsystem::UnregisterAvatar(AGCFAvatarPawn* Avatar)
+{
+	Avatars.RemoveSwap(Avatar);
+}
+
+
+void UGCFAvatarSignificanceSubsystem::EvaluateSignificance()
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_GCFAvatarSignificance_Evaluate);
+
+	UWorld* World = GetWorld();
+	if (!World) {
+		return;
+	}
+
+	Avatars.RemoveAllSwap([](const TWeakObjectPtr<AGCFAvatarPawn>& Avatar) { return !Avatar.IsValid(); });
+
+	if (!GCF::AvatarSignificance::bEnable) {
+		for (const TWeakObjectPtr<AGCFAvatarPawn>& Avatar : Avatars) {
+			Avatar->SetGCFSignificance(1.0f, EGCFAnimUpdateTier::Full);
+		}
+		return;
+	}
+
+	// Nobody ever sees an avatar on a dedicated server.
+	if (World->GetNetMode() == NM_DedicatedServer) {
+		for (const TWeakObjectPtr<AGCFAvatarPawn>& Avatar : Avatars) {
+			Avatar->SetGCFSignificance(0.0f, EGCFAnimUpdateTier::ServerOnly);
+		}
+		return;
+	}
+
+	// Only local views matter for animation.
+	TArray<FVector, TInlineAllocator<4>> ViewLocations;
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It) {
+		const APlayerController* PlayerController = It->Get();
+		if (PlayerController && PlayerController->IsLocalController()) {
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			ViewLocations.Add(ViewLocation);
+		}
+	}
+
+	// A client or listen server whose local player is not there yet (or is gone) has nothing to measure against.
+	if (ViewLocations.IsEmpty()) {
+		for (const TWeakObjectPtr<AGCFAvatarPawn>& Avatar : Avatars) {
+			Avatar->SetGCFSignificance(1.0f, EGCFAnimUpdateTier::Full);
+		}
+		return;
+	}
+
+	const float NearDistance = GCF::AvatarSignificance::NearDistance;
+	const float FarDistance = FMath::Max(GCF::AvatarSignificance::FarDistance, NearDistance + 1.0f);
+
+	for (const TWeakObjectPtr<AGCFAvatarPawn>& Avatar : Avatars) {
+		const FVector AvatarLocation = Avatar->GetActorLocation();
+		double MinDistanceSquared = TNumericLimits<double>::Max();
+		for (const FVector& ViewLocation : ViewLocations) {
+			MinDistanceSquared = FMath::Min(MinDistanceSquared, FVector::DistSquared(AvatarLocation, ViewLocation));
+		}
+
+		const float Distance = FMath::Sqrt(static_cast<float>(MinDistanceSquared));
+		const float Significance = 1.0f - FMath::Clamp((Distance - NearDistance) / (FarDistance - NearDistance), 0.0f, 1.0f);
+		Avatar->SetGCFSignificance(Significance, ComputeTier(Significance, Avatar->GetAnimUpdateTier()));
+	}
+}
+
+
+EGCFAnimUpdateTier UGCFAvatarSignificanceSubsystem::ComputeTier(float Significance, EGCFAnimUpdateTier CurrentTier)
+{
+	// Thresholds the avatar has already crossed are widened so it does not flap on the boundary.
+	const float Hysteresis = GCF::AvatarSignificance::Hysteresis;
+	const bool bWasReducedOrLower = CurrentTier != EGCFAnimUpdateTier::Full;
+	const bool bWasMinimalOrLower = CurrentTier == EGCFAnimUpdateTier::Minimal || CurrentTier == EGCFAnimUpdateTier::ServerOnly;
+
+	const float MinimalThreshold = GCF::AvatarSignificance::MinimalBelow + (bWasMinimalOrLower ? Hysteresis : -Hysteresis);
+	const float ReducedThreshold = GCF::AvatarSignificance::ReducedBelow + (bWasReducedOrLower ? Hysteresis : -Hysteresis);
+
+	if (Significance < MinimalThreshold) {
+		return EGCFAnimUpdateTier::Minimal;
+	}
+	if (Significance < ReducedThreshold) {
+		return EGCFAnimUpdateTier::Reduced;
+	}
+	return EGCFAnimUpdateTier::Full;
+}
+
+
+float UGCFAvatarSignificanceSubsystem::GetTierTickInterval(EGCFAnimUpdateTier Tier)
+{
+	switch (Tier) {
+		case EGCFAnimUpdateTier::Reduced: return GCF::AvatarSignificance::ReducedTickInterval;
+		case EGCFAnimUpdateTier::Minimal: return GCF::AvatarSignificance::MinimalTickInterval;
+		default: return 0.0f;
+	}
+}
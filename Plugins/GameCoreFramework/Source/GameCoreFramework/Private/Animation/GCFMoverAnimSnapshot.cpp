@@ -0,0 +1,58 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Animation/GCFMoverAnimSnapshot.h"
+#include "CoreGlobals.h"
+#include "GameFramework/Pawn.h"
+#include "MoverComponent.h"
+#include "MoverTypes.h"
+#include "GCFShared.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GCFMoverAnimSnapshot)
+
+
+namespace GCF::MoverAnimSnapshot
+{
+static bool HasMoveIntent(const UMoverComponent& MoverComponent)
+{
+	const APawn* OwnerPawn = Cast<APawn>(MoverComponent.GetOwner());
+
+	// For simulated proxies (other players), read the intent from the server-replicated SyncState.
+	if (OwnerPawn && OwnerPawn->GetLocalRole() == ROLE_SimulatedProxy) {
+		if (const FMoverDefaultSyncState* SyncState = MoverComponent.GetSyncState().SyncStateCollection.FindDataByType<FMoverDefaultSyncState>()) {
+			return !SyncState->MoveDirectionIntent.IsNearlyZero(0.01f);
+		}
+		return false;
+	}
+
+	// For local/authority pawns, read the intent directly from the most recent InputCmd.
+	if (const FCharacterDefaultInputs* CharacterInputs = MoverComponent.GetLastInputCmd().InputCollection.FindDataByType<FCharacterDefaultInputs>()) {
+		return !CharacterInputs->GetMoveInput().IsNearlyZero(0.01f);
+	}
+	return false;
+}
+}
+
+
+void FGCFMoverAnimSnapshotBuffer::Publish(const UMoverComponent& MoverComponent, float DeltaSeconds)
+{
+	const int32 CurrentFrontIndex = FrontIndex.load(std::memory_order_relaxed);
+	const FGCFMoverAnimSnapshot& Previous = Slots[CurrentFrontIndex];
+	FGCFMoverAnimSnapshot& Snapshot = Slots[1 - CurrentFrontIndex];
+
+	const AActor* Owner = MoverComponent.GetOwner();
+	const bool bHadSnapshot = bHasSnapshot.load(std::memory_order_relaxed);
+
+	Snapshot.Velocity = MoverComponent.GetVelocity();
+	Snapshot.Acceleration = (bHadSnapshot && DeltaSeconds > UE_SMALL_NUMBER) ? (Snapshot.Velocity - Previous.Velocity) / DeltaSeconds : FVector::ZeroVector;
+	Snapshot.Rotation = Owner ? Owner->GetActorRotation() : FRotator::ZeroRotator;
+	Snapshot.MovementMode = MoverComponent.GetMovementModeName();
+	Snapshot.bHasAcceleration = GCF::MoverAnimSnapshot::HasMoveIntent(MoverComponent);
+	Snapshot.bIsOnGround = MoverComponent.HasGameplayTag(Mover_IsOnGround, true);
+	Snapshot.bIsFalling = MoverComponent.HasGameplayTag(Mover_IsFalling, true);
+	Snapshot.bIsCrouched = MoverComponent.HasGameplayTag(Mover_IsCrouching, true);
+
+	FrontIndex.store(1 - CurrentFrontIndex, std::memory_order_release);
+	PublishedFrame.store(GFrameCounter, std::memory_order_release);
+	bHasSnapshot.store(true, std::memory_order_release);
+}
@@ -16,6 +16,7 @@
 #include "Components/GameFrameworkComponentManager.h"
 #include "GameFramework/GameplayMessageSubsystem.h"
 #include "Messages/GCFGameplayMessages.h"
+#include "Messages/GCFNativeMessageSubsystem.h"
 #include "Common/GCFNames.h"
 #include "Common/GCFGameplayTags.h"
 #include "System/Binder/GCFPawnReadyStateBinder.h"
@@ -244,23 +245,35 @@ void UGCFCameraComponent::NotifyCameraModeChanged(const FGCFCameraPolicyData& Ne
 		return;
 	}
 
+	// Native listeners (Controller, CameraControl, Interaction) use the typed channel.
+	// The same payloads are still published through the GameplayMessageSubsystem for Blueprint listeners.
+	UGCFNativeMessageSubsystem* NativeSubsystem = World->GetSubsystem<UGCFNativeMessageSubsystem>();
 	UGameplayMessageSubsystem& MessageSubsystem = UGameplayMessageSubsystem::Get(World);
 	{
 		FGCFCameraModeChangedMessage Message;
 		Message.NewCameraModeTag = NewPolicy.CameraTypeTag;
 		Message.Controller = Controller;
+		if (NativeSubsystem) {
+			NativeSubsystem->BroadcastMessage(Message);
+		}
 		MessageSubsystem.BroadcastMessage(GCFGameplayTags::Message_Camera_ModeChange, Message);
 	}
 	{
 		FGCFPolicyChangedCursorMessage Message;
 		Message.bShowCursor = NewPolicy.bShowCursor;
 		Message.Controller = Controller;
+		if (NativeSubsystem) {
+			NativeSubsystem->BroadcastMessage(Message);
+		}
 		MessageSubsystem.BroadcastMessage(GCFGameplayTags::Message_PolicyChange_Cursor, Message);
 	}
 	{
 		FGCFPolicyChangedMovementRotationMessage Message;
 		Message.NewPolicy = NewPolicy.RotationPolicy;
 		Message.Controller = Controller;
+		if (NativeSubsystem) {
+			NativeSubsystem->BroadcastMessage(Message);
+		}
 		MessageSubsystem.BroadcastMessage(GCFGameplayTags::Message_PolicyChange_MovementRotation, Message);
 	}
 
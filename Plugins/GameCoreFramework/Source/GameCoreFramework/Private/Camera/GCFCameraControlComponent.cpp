@@ -62,13 +62,11 @@ void UGCFCameraControlComponent::BeginPlay()
 
 	// Subscribe to Policy Change messages
 	if (UWorld* World = GetWorld()) {
-		UGameplayMessageSubsystem& MessageSubsystem = UGameplayMessageSubsystem::Get(World);
-		MessageHandle = MakeUnique<FGCFMessageSubscription>(
-			World,
-			MessageSubsystem.RegisterListener<FGCFPolicyChangedMovementRotationMessage>(
-			GCFGameplayTags::Message_PolicyChange_MovementRotation,
-			this,
-			&ThisClass::OnCameraModeMessageReceived));
+		if (UGCFNativeMessageSubsystem* MessageSubsystem = World->GetSubsystem<UGCFNativeMessageSubsystem>()) {
+			MessageHandle = MakeUnique<FGCFMessageSubscription>(
+				World,
+				MessageSubsystem->RegisterListener<FGCFPolicyChangedMovementRotationMessage>(this, &ThisClass::OnCameraModeMessageReceived));
+		}
 	}
 }
 
@@ -80,7 +78,7 @@ void UGCFCameraControlComponent::EndPlay(const EEndPlayReason::Type EndPlayReaso
 }
 
 
-void UGCFCameraControlComponent::OnCameraModeMessageReceived(FGameplayTag Channel, const FGCFPolicyChangedMovementRotationMessage& Message)
+void UGCFCameraControlComponent::OnCameraModeMessageReceived(const FGCFPolicyChangedMovementRotationMessage& Message)
 {
 	// Ensure the message is meant for this controller
 	if (Message.Controller == GetController<AController>()) {
@@ -76,11 +76,13 @@ UE_DEFINE_GAMEPLAY_TAG_COMMENT(UI_Layer_GameMenu, "UI.Layer.GameMenu", "");
 UE_DEFINE_GAMEPLAY_TAG_COMMENT(UI_Layer_Modal, "UI.Layer.Modal", "");
 UE_DEFINE_GAMEPLAY_TAG_COMMENT(UI_Layer_Menu, "UI.Layer.Menu", "");
 UE_DEFINE_GAMEPLAY_TAG_COMMENT(UI_Action_Escape, "UI.Action.Escape", "");
+UE_DEFINE_GAMEPLAY_TAG_COMMENT(UI_Slot_Debug, "UI.Slot.Debug", "Parent of the HUD slots hosting debug widgets. Widgets added here keep the debug channel open.");
 
 UE_DEFINE_GAMEPLAY_TAG_COMMENT(Message_Elimination, "Message.Elimination", "");
 UE_DEFINE_GAMEPLAY_TAG_COMMENT(Message_Camera_ModeChange, "Message.Camera.ModeChange", "");
 UE_DEFINE_GAMEPLAY_TAG_COMMENT(Message_PolicyChange_Cursor, "Message.PolicyChange.Cursor", "");
 UE_DEFINE_GAMEPLAY_TAG_COMMENT(Message_PolicyChange_MovementRotation, "Message.PolicyChange.MovementRotation", "");
+UE_DEFINE_GAMEPLAY_TAG_COMMENT(Message_Interaction_FocusChange, "Message.Interaction.FocusChange", "");
 
 UE_DEFINE_GAMEPLAY_TAG_COMMENT(Message_Debug_Log, "Message.Debug.Log", "");
 UE_DEFINE_GAMEPLAY_TAG_COMMENT(Message_Debug_State, "Message.Debug.State", "");
@@ -11,6 +11,8 @@
 #include "InputMappingContext.h"
 #include "UserSettings/EnhancedInputUserSettings.h"
 #include "System/Asset/GCFAssetManager.h"
+#include "Actor/Data/GCFPawnData.h"
+#include "Input/GCFInputFunctionLibrary.h"
 #include "GCFShared.h"
 
 #if WITH_EDITOR
@@ -249,13 +251,20 @@ void UGameFeatureAction_AddInputContextMapping::AddInputMappingForPlayer(UPlayer
 	{
 		if (UEnhancedInputLocalPlayerSubsystem* InputSystem = LocalPlayer->GetSubsystem<UEnhancedInputLocalPlayerSubsystem>())
 		{
+			TArray<FGCFInputMappingContextInfo> ContextsToAdd;
+			ContextsToAdd.Reserve(InputMappings.Num());
 			for (const FInputMappingContextAndPriority& Entry : InputMappings)
 			{
 				if (const UInputMappingContext* IMC = Entry.InputMapping.Get())
 				{
-					InputSystem->AddMappingContext(IMC, Entry.Priority);
+					FGCFInputMappingContextInfo& Info = ContextsToAdd.AddDefaulted_GetRef();
+					Info.InputMapping = IMC;
+					Info.Priority = Entry.Priority;
 				}
 			}
+
+			// Add all mappings as one transaction so the player mappings are rebuilt once
+			UGCFInputFunctionLibrary::ModifyMappingContexts(InputSystem, ContextsToAdd);
 		}
 		else
 		{
@@ -270,13 +279,17 @@ void UGameFeatureAction_AddInputContextMapping::RemoveInputMapping(APlayerContro
 	{
 		if (UEnhancedInputLocalPlayerSubsystem* InputSystem = LocalPlayer->GetSubsystem<UEnhancedInputLocalPlayerSubsystem>())
 		{
+			TArray<const UInputMappingContext*> ContextsToRemove;
+			ContextsToRemove.Reserve(InputMappings.Num());
 			for (const FInputMappingContextAndPriority& Entry : InputMappings)
 			{
 				if (const UInputMappingContext* IMC = Entry.InputMapping.Get())
 				{
-					InputSystem->RemoveMappingContext(IMC);
+					ContextsToRemove.Add(IMC);
 				}
 			}
+
+			UGCFInputFunctionLibrary::ModifyMappingContexts(InputSystem, {}, ContextsToRemove);
 		}
 	}
 
@@ -6,6 +6,8 @@
 #include "GameFeatures/GameFeatureAction_WorldActionBase.h"
 #include "GameFeaturesSubsystemSettings.h"
 #include "CommonUIExtensions.h"
+#include "Common/GCFGameplayTags.h"
+#include "System/GCFDebugSubsystem.h"
 #include "UI/GCFHUD.h"
 
 #if WITH_EDITOR
@@ -118,6 +120,7 @@ void UGameFeatureAction_AddWidgets::Reset(FPerContextData& ActiveData)
 		{
 			Handle.Unregister();
 		}
+		UnregisterDebugListener(Cast<AActor>(Pair.Key.ResolveObjectPtr()), Pair.Value);
 	}
 	ActiveData.ActorData.Empty();
 }
@@ -161,6 +164,16 @@ void UGameFeatureAction_AddWidgets::AddWidgets(AActor* Actor, FPerContextData& A
 		{
 			ActorData.ExtensionHandles.Add(ExtensionSubsystem->RegisterExtensionAsWidgetForContext(Entry.SlotID, LocalPlayer, Entry.WidgetClass.Get(), -1));
 		}
+
+		// The debug widgets only listen on message tags, so the HUD hosting them keeps the debug channel open
+		if (!ActorData.bRegisteredDebugListener && HasDebugWidgets())
+		{
+			if (UGCFDebugSubsystem* DebugSubsystem = UGCFDebugSubsystem::Get(HUD))
+			{
+				DebugSubsystem->RegisterDebugListener(HUD);
+				ActorData.bRegisteredDebugListener = true;
+			}
+		}
 	}
 }
 
@@ -185,9 +198,29 @@ void UGameFeatureAction_AddWidgets::RemoveWidgets(AActor* Actor, FPerContextData
 		{
 			Handle.Unregister();
 		}
+		UnregisterDebugListener(HUD, *ActorData);
 		ActiveData.ActorData.Remove(HUD);
 	}
 }
 
+bool UGameFeatureAction_AddWidgets::HasDebugWidgets() const
+{
+	return Widgets.ContainsByPredicate([](const FGCFHUDElementEntry& Entry) { return Entry.SlotID.MatchesTag(GCFGameplayTags::UI_Slot_Debug); });
+}
+
+void UGameFeatureAction_AddWidgets::UnregisterDebugListener(AActor* HUD, FPerActorData& ActorData)
+{
+	if (!ActorData.bRegisteredDebugListener)
+	{
+		return;
+	}
+	ActorData.bRegisteredDebugListener = false;
+
+	if (UGCFDebugSubsystem* DebugSubsystem = HUD ? UGCFDebugSubsystem::Get(HUD) : nullptr)
+	{
+		DebugSubsystem->UnregisterDebugListener(HUD);
+	}
+}
+
 #undef LOCTEXT_NAMESPACE
 
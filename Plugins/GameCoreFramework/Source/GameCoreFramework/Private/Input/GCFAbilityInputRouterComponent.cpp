@@ -57,6 +57,9 @@ void UGCFAbilityInputRouterComponent::BeginPlay()
 
 void UGCFAbilityInputRouterComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	SetRouteTarget(PlayerStateRoute, nullptr);
+	SetRouteTarget(PawnRoute, nullptr);
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -65,10 +68,10 @@ void UGCFAbilityInputRouterComponent::HandlePossessedPawnChanged(AActor* Actor,
 {
 	if (bPossessed) {
 		if (APawn* Pawn = Cast<APawn>(Actor)) {
-			CurrentPawnASC = UGCFAbilitySystemFunctionLibrary::GetPawnAbilitySystemComponent<UGCFAbilitySystemComponent>(Pawn);
+			SetRouteTarget(PawnRoute, UGCFAbilitySystemFunctionLibrary::GetPawnAbilitySystemComponent<UGCFAbilitySystemComponent>(Pawn));
 		}
 	} else {
-		CurrentPawnASC.Reset();
+		SetRouteTarget(PawnRoute, nullptr);
 	}
 }
 
@@ -78,13 +81,52 @@ void UGCFAbilityInputRouterComponent::HandlePlayerReadyStateChanged(const FGCFPl
 	static const EGCFPlayerReadyState Required = EGCFPlayerReadyState::GamePlay;
 	if (GCF::Bitmask::HasFlagsChanged(Snapshot.State, CachedPlayerReadyState, Required)) {
 		if (GCF::Bitmask::AreFlagsSet(Snapshot.State, Required)) {
-			PlayerStateASC = UGCFAbilitySystemFunctionLibrary::GetPlayerStateAbilitySystemComponent<UGCFAbilitySystemComponent>(Snapshot.PlayerState.Get());
+			SetRouteTarget(PlayerStateRoute, UGCFAbilitySystemFunctionLibrary::GetPlayerStateAbilitySystemComponent<UGCFAbilitySystemComponent>(Snapshot.PlayerState.Get()));
 		}
 	}
 	CachedPlayerReadyState = Snapshot.State;
 }
 
 
+void UGCFAbilityInputRouterComponent::SetRouteTarget(FGCFAbilityInputRoute& Route, UGCFAbilitySystemComponent* NewASC)
+{
+	if (Route.ASC.Get() == NewASC) {
+		return;
+	}
+
+	if (UGCFAbilitySystemComponent* OldASC = Route.ASC.Get()) {
+		OldASC->OnActivatableAbilitiesChanged.Remove(Route.AbilitiesChangedHandle);
+	}
+	Route.AbilitiesChangedHandle.Reset();
+
+	Route.ASC = NewASC;
+	Route.RoutableInputTags.Reset();
+	Route.bRoutableTagsDirty = true;
+
+	if (NewASC) {
+		// Only flag the set here: the removed spec is still listed while the notification is broadcast.
+		Route.AbilitiesChangedHandle = NewASC->OnActivatableAbilitiesChanged.AddWeakLambda(this, [&Route]() {
+			Route.bRoutableTagsDirty = true;
+		});
+	}
+}
+
+
+void UGCFAbilityInputRouterComponent::RebuildRoutableTags(FGCFAbilityInputRoute& Route)
+{
+	Route.RoutableInputTags.Reset();
+	Route.bRoutableTagsDirty = false;
+
+	if (UGCFAbilitySystemComponent* ASC = Route.ASC.Get()) {
+		for (const FGameplayAbilitySpec& Spec : ASC->GetActivatableAbilities()) {
+			for (const FGameplayTag& Tag : Spec.GetDynamicSpecSourceTags()) {
+				Route.RoutableInputTags.Add(Tag);
+			}
+		}
+	}
+}
+
+
 void UGCFAbilityInputRouterComponent::RouteInputTag(const FGameplayTag& InputTag, bool bPressed)
 {
 	// Determine the routing destination based on the tag namespace.
@@ -96,45 +138,39 @@ void UGCFAbilityInputRouterComponent::RouteInputTag(const FGameplayTag& InputTag
 		return;
 	}
 
-	FGameplayEventData EventData;
-	EventData.EventTag = InputTag;
-	EventData.Instigator = GetOwner();
-	EventData.Target = GetOwner();
-
 	// Route to "Soul" (PlayerState)
-	if (bIsPlayerTag && PlayerStateASC.Get()) {
-		InjectInputToASC(PlayerStateASC.Get(), InputTag, bPressed);
+	if (bIsPlayerTag) {
+		RouteToTarget(PlayerStateRoute, InputTag, bPressed);
 	}
 
 	// Route to "Body" (Pawn)
-	if (bIsPawnTag && CurrentPawnASC.Get()) {
-		InjectInputToASC(CurrentPawnASC.Get(), InputTag, bPressed);
+	if (bIsPawnTag) {
+		RouteToTarget(PawnRoute, InputTag, bPressed);
 	}
 }
 
 
-bool UGCFAbilityInputRouterComponent::HasMatchingAbility(UAbilitySystemComponent* ASC, const FGameplayTag& InputTag) const
+void UGCFAbilityInputRouterComponent::RouteToTarget(FGCFAbilityInputRoute& Route, const FGameplayTag& InputTag, bool bPressed)
 {
+	UGCFAbilitySystemComponent* ASC = Route.ASC.Get();
 	if (!ASC) {
-		return false;
+		return;
 	}
 
-	for (const FGameplayAbilitySpec& Spec : ASC->GetActivatableAbilities()) {
-		if (Spec.GetDynamicSpecSourceTags().HasTag(InputTag)) {
-			return true;
-		}
+	if (Route.bRoutableTagsDirty) {
+		RebuildRoutableTags(Route);
 	}
-	return false;
+
+	InjectInputToASC(ASC, InputTag, bPressed, Route.RoutableInputTags.Contains(InputTag));
 }
 
 
-void UGCFAbilityInputRouterComponent::InjectInputToASC(UGCFAbilitySystemComponent* ASC, const FGameplayTag& InputTag, bool bPressed) const
+void UGCFAbilityInputRouterComponent::InjectInputToASC(UGCFAbilitySystemComponent* ASC, const FGameplayTag& InputTag, bool bPressed, bool bHasMatchingAbility) const
 {
 	if (!ASC) {
 		return;
 	}
 
-	const bool bHasMatchingAbility = HasMatchingAbility(ASC, InputTag);
 	if (bHasMatchingAbility) {
 		if (bPressed) {
 			ASC->AbilityInputTagPressed(InputTag);
@@ -144,11 +180,11 @@ void UGCFAbilityInputRouterComponent::InjectInputToASC(UGCFAbilitySystemComponen
 	}
 
 	// Logging based on routing success
-	if (bPressed) {
+	if (bPressed && UGCFDebugFunctionLibrary::IsDebugChannelActive(this)) {
 		if (bHasMatchingAbility) {
 			UGCFDebugFunctionLibrary::SendLogMessage(this, EGCFDebugLogVerbosity::Success, FString::Printf(TEXT("%s: Routed to %s"), *InputTag.GetTagName().ToString(), *ASC->GetOwner()->GetName()));
 		} else {
 			UGCFDebugFunctionLibrary::SendLogMessage(this, EGCFDebugLogVerbosity::Error, TEXT("No Target (Ability Not Found)"));
 		}
 	}
-}
\ No newline at end of file
+}
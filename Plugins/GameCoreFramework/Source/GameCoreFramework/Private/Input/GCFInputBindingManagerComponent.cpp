@@ -16,11 +16,12 @@
 #include "System/Binder/GCFControllerPossessionBinder.h"
 #include "System/Lifecycle/GCFPawnReadyStateComponent.h"
 #include "System/Lifecycle/GCFPlayerReadyStateComponent.h"
+#include "TimerManager.h"
 
 // for debugging
 #include "Common/GCFDebugTypes.h"
-#include "GameFramework/GameplayMessageSubsystem.h"
 #include "System/GCFDebugFunctionLibrary.h"
+#include "System/GCFDebugSubsystem.h"
 
 
 UGCFInputBindingManagerComponent::UGCFInputBindingManagerComponent(const FObjectInitializer& ObjectInitializer)
@@ -58,7 +59,8 @@ void UGCFInputBindingManagerComponent::RegisterInputBinding_Internal(UObject* Co
 
 	// Always overwrite existing pending bindings to ensure we have the latest delegate logic.
 	if (!PendingBindings.Find(BindingKey)) {
-		PendingBindings.Add(BindingKey, MoveTemp(Delegate));
+		// Resolve the lifecycle dependency once here instead of walking the outer chain on every evaluation.
+		PendingBindings.Add(BindingKey, FGCFPendingBinding{ MoveTemp(Delegate), IsBinderPawnDependent(Context) });
 	}
 	EvaluateBindingConditions();
 }
@@ -105,6 +107,14 @@ void UGCFInputBindingManagerComponent::EndPlay(const EEndPlayReason::Type EndPla
 	InputContextTrackerHandle.Reset();
 	PawnPossessionBinder.Reset();
 
+	if (UWorld* World = GetWorld()) {
+		// A pending deferred clear would otherwise be dropped and leave the old pawn's contexts on the subsystem.
+		if (World->GetTimerManager().IsTimerActive(DeferredIMCClearHandle)) {
+			ClearPawnMappingContexts();
+		}
+		World->GetTimerManager().ClearTimer(DeferredIMCClearHandle);
+	}
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -114,7 +124,8 @@ void UGCFInputBindingManagerComponent::HandlePawnPossessionStateChanged(AActor*
 {
 	if (!bPossessed) {
 		// When possession is lost, verify and clear only pawn-dependent bindings.
-		ClearPawnMappingContexts();
+		// IMC removal waits a tick, so a swap to another Pawn only touches the contexts that differ.
+		DeferredIMCClearHandle = GetWorld()->GetTimerManager().SetTimerForNextTick(this, &ThisClass::ClearPawnMappingContexts);
 		ClearBindingsOnContextChange();
 	} else {
 		ApplyPawnMappingContexts(Actor);
@@ -156,27 +167,19 @@ void UGCFInputBindingManagerComponent::ProcessPendingBindings()
 
 	for (auto It = PendingBindings.CreateIterator(); It; ++It) {
 		const FGCFPendingBindingKey& Key = It.Key();
-		const FGCFInputBindNativeDelegate& Delegate = It.Value();
+		const FGCFPendingBinding& PendingBinding = It.Value();
 
-		UObject* Binder = Key.Binder.Get();
-		if (!Binder) {
+		if (!Key.Binder.IsValid()) {
 			// Clean up stale requests from destroyed objects
 			It.RemoveCurrent();
 			continue;
 		}
 
-		const bool bIsBinderPawnDependent = IsBinderPawnDependent(Binder);
+		const bool bIsBinderPawnDependent = PendingBinding.bIsPawnDependent;
 
 		// [Check] Prevent redundant binding execution for Controller-persistent bindings.
 		// Since persistent bindings remain in the pending list, we must skip them if they are already active.
-		bool bAlreadyActive = false;
-		for (const auto& Group : ActiveBindingGroups) {
-			if (Group.Key == Key)
-			{
-				bAlreadyActive = true;
-				break;
-			}
-		}
+		const bool bAlreadyActive = ActiveBindingGroups.Contains(Key);
 
 		// Skip if active, BUT always re-process if it's Pawn-dependent (as it's a new instance/lifecycle).
 		if (bAlreadyActive && !bIsBinderPawnDependent) {
@@ -187,7 +190,8 @@ void UGCFInputBindingManagerComponent::ProcessPendingBindings()
 		// Execute the binding
 		ExecuteInputBinding(
 			Key,
-			Delegate,
+			PendingBinding.Delegate,
+			bIsBinderPawnDependent,
 			InputComp,
 			bIsBinderPawnDependent ? PawnProvider : PlayerProvider
 		);
@@ -216,29 +220,69 @@ void UGCFInputBindingManagerComponent::ApplyPawnMappingContexts(AActor* PawnActo
 		return;
 	}
 
-	if (TScriptInterface<IGCFPawnDataProvider> DataProvider = UGCFActorFunctionLibrary::ResolvePawnDataProvider(PawnActor)) {
-		if (const UGCFPawnData* PawnData = DataProvider->GetPawnData<UGCFPawnData>()) {
+	// The previous Pawn's IMCs are handled by the diff below.
+	GetWorld()->GetTimerManager().ClearTimer(DeferredIMCClearHandle);
 
-			int32 AddedCount = 0;
+	const TArray<FGCFInputMappingContextInfo>& NewContexts = ResolvePawnMappingContexts(PawnActor);
 
-			// Add all IMCs defined in the PawnData
-			for (const FGCFInputMappingContextInfo& BindInfo : PawnData->DefaultMappingContexts) {
-				if (BindInfo.InputMapping) {
-					// Add the IMC with the specified priority
-					Subsystem->AddMappingContext(BindInfo.InputMapping, BindInfo.Priority);
+	auto IsSameContext = [](const FGCFInputMappingContextInfo& A, const FGCFInputMappingContextInfo& B) {
+		return A.InputMapping == B.InputMapping && A.Priority == B.Priority;
+	};
 
-					// Record the IMC for future cleanup
-					AppliedPawnIMCs.Add(BindInfo.InputMapping);
-					AddedCount++;
-				}
-			}
+	// Collect IMCs of the previous Pawn that the new Pawn does not use (or uses with a different priority)
+	TArray<const UInputMappingContext*> ContextsToRemove;
+	for (int32 i = AppliedPawnIMCs.Num() - 1; i >= 0; --i) {
+		const FGCFInputMappingContextInfo& Applied = AppliedPawnIMCs[i];
+		if (!NewContexts.ContainsByPredicate([&](const FGCFInputMappingContextInfo& Info) { return IsSameContext(Info, Applied); })) {
+			ContextsToRemove.Add(Applied.InputMapping);
+			AppliedPawnIMCs.RemoveAt(i);
+		}
+	}
 
-			if (AddedCount > 0) {
-				UE_LOG(LogGCFSystem, Log, TEXT("GCFInputBindingManager: Applied %d new Mapping Contexts for Pawn [%s]. Total active Pawn IMCs: %d."),
-					   AddedCount, *PawnActor->GetName(), AppliedPawnIMCs.Num());
-			}
+	// Collect IMCs that are not applied yet
+	TArray<FGCFInputMappingContextInfo> ContextsToAdd;
+	for (const FGCFInputMappingContextInfo& BindInfo : NewContexts) {
+		if (!AppliedPawnIMCs.ContainsByPredicate([&](const FGCFInputMappingContextInfo& Applied) { return IsSameContext(Applied, BindInfo); })) {
+			ContextsToAdd.Add(BindInfo);
+		}
+	}
+
+	// Apply the difference as one transaction (one control mapping rebuild)
+	if (UGCFInputFunctionLibrary::ModifyMappingContexts(Subsystem, ContextsToAdd, ContextsToRemove)) {
+		// Record the IMCs for future cleanup
+		AppliedPawnIMCs.Append(ContextsToAdd);
+
+		UE_LOG(LogGCFSystem, Log, TEXT("GCFInputBindingManager: Applied %d new and removed %d old Mapping Contexts for Pawn [%s]. Total active Pawn IMCs: %d."),
+			   ContextsToAdd.Num(), ContextsToRemove.Num(), *PawnActor->GetName(), AppliedPawnIMCs.Num());
+	}
+}
+
+
+const TArray<FGCFInputMappingContextInfo>& UGCFInputBindingManagerComponent::ResolvePawnMappingContexts(AActor* PawnActor)
+{
+	static const TArray<FGCFInputMappingContextInfo> NoContexts;
+
+	const UGCFPawnData* PawnData = nullptr;
+	if (TScriptInterface<IGCFPawnDataProvider> DataProvider = UGCFActorFunctionLibrary::ResolvePawnDataProvider(PawnActor)) {
+		PawnData = DataProvider->GetPawnData<UGCFPawnData>();
+	}
+
+	if (!PawnData) {
+		return NoContexts;
+	}
+
+	if (const TArray<FGCFInputMappingContextInfo>* Cached = ResolvedPawnIMCs.Find(PawnData)) {
+		return *Cached;
+	}
+
+	// First possession of a Pawn with this data: keep only valid entries
+	TArray<FGCFInputMappingContextInfo>& Resolved = ResolvedPawnIMCs.Add(PawnData);
+	for (const FGCFInputMappingContextInfo& BindInfo : PawnData->DefaultMappingContexts) {
+		if (BindInfo.InputMapping) {
+			Resolved.Add(BindInfo);
 		}
 	}
+	return Resolved;
 }
 
 
@@ -253,12 +297,13 @@ void UGCFInputBindingManagerComponent::ClearPawnMappingContexts()
 		ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PC->GetLocalPlayer()) : nullptr;
 
 	if (Subsystem) {
-		// Remove all previously recorded IMCs from the subsystem
-		for (const UInputMappingContext* IMC : AppliedPawnIMCs) {
-			if (IMC) {
-				Subsystem->RemoveMappingContext(IMC);
-			}
+		// Remove all previously recorded IMCs from the subsystem in one transaction
+		TArray<const UInputMappingContext*> ContextsToRemove;
+		ContextsToRemove.Reserve(AppliedPawnIMCs.Num());
+		for (const FGCFInputMappingContextInfo& Applied : AppliedPawnIMCs) {
+			ContextsToRemove.Add(Applied.InputMapping);
 		}
+		UGCFInputFunctionLibrary::ModifyMappingContexts(Subsystem, {}, ContextsToRemove);
 	}
 
 	const int32 ClearedCount = AppliedPawnIMCs.Num();
@@ -289,28 +334,31 @@ void UGCFInputBindingManagerComponent::EvaluateBindingConditions()
 {
 	if (bInputEnabled) {
 		ProcessPendingBindings();
-		SendDebugInfo();
+
+		if (UGCFDebugSubsystem* DebugSubsystem = UGCFDebugSubsystem::Get(this)) {
+			DebugSubsystem->MarkInputSnapshotDirty(this, &ThisClass::BuildDebugInputSnapshot);
+		}
 	}
 }
 
 
-void UGCFInputBindingManagerComponent::ExecuteInputBinding(const FGCFPendingBindingKey& Key, const FGCFInputBindNativeDelegate& Delegate, UGCFInputComponent* InputComp, TScriptInterface<IGCFInputConfigProvider> Provider)
+void UGCFInputBindingManagerComponent::ExecuteInputBinding(const FGCFPendingBindingKey& Key, const FGCFInputBindNativeDelegate& Delegate, bool bIsPawnDependent, UGCFInputComponent* InputComp, TScriptInterface<IGCFInputConfigProvider> Provider)
 {
 	// [Safety & Idempotency Check]
 	// Check for existing bindings with the same Key/Binder.
 	// This prevents duplicate bindings if logic triggers multiple times.
-	for (int32 i = ActiveBindingGroups.Num() - 1; i >= 0; --i) {
-		if (ActiveBindingGroups[i].Key == Key) {
-
-			// Only attempt to remove binding if the InputComponent is the SAME instance.
-			// If InputComponent has changed (e.g., Seamless Travel), the old bindings are implicitly invalid.
-			UInputComponent* OldInputComp = ActiveBindingGroups[i].BoundInputComponent.Get();
-			if (OldInputComp && OldInputComp == InputComp) {
-				for (auto& Receipt : ActiveBindingGroups[i].Receipts) {
+	if (FGCFInputBindingGroup* ExistingGroup = ActiveBindingGroups.Find(Key)) {
+
+		// Only attempt to remove binding if the InputComponent is the SAME instance.
+		// If InputComponent has changed (e.g., Seamless Travel), the old bindings are implicitly invalid.
+		UInputComponent* OldInputComp = ExistingGroup->BoundInputComponent.Get();
+		if (OldInputComp && OldInputComp == InputComp) {
+			for (const auto& Receipt : ExistingGroup->Receipts) {
+				if (Receipt.BindingPtr) {
 					InputComp->RemoveBinding(*Receipt.BindingPtr);
 				}
-				ActiveBindingGroups.RemoveAt(i);
 			}
+			ActiveBindingGroups.Remove(Key);
 		}
 	}
 
@@ -320,21 +368,12 @@ void UGCFInputBindingManagerComponent::ExecuteInputBinding(const FGCFPendingBind
 		return;
 	}
 
-	// Register to active groups
-	FGCFInputBindingGroup& Group = ActiveBindingGroups.AddDefaulted_GetRef();
+	// Register to active groups (replaces a stale group left on a previous InputComponent)
+	FGCFInputBindingGroup& Group = ActiveBindingGroups.Add(Key);
 	Group.Key = Key;
 	Group.Receipts = Receipts;
 	Group.BoundInputComponent = InputComp; // Track the physical component for safety
-	Group.bIsPawnDependent = IsBinderPawnDependent(Key.Binder.Get());
-
-#if !UE_BUILD_SHIPPING
-	for (const auto& Receipt : Receipts) {
-		Group.DebugBindingInfos.Add(FString::Printf(TEXT("%s : %s (%s)"),
-									*Receipt.AssociatedTag.ToString(),
-									Receipt.BindingPtr ? *Receipt.BindingPtr->GetAction()->GetName() : TEXT("None"),
-									*UGCFDebugFunctionLibrary::GetEnumName(Receipt.TriggerEvent)));
-	}
-#endif
+	Group.bIsPawnDependent = bIsPawnDependent;
 }
 
 
@@ -343,9 +382,8 @@ void UGCFInputBindingManagerComponent::ClearBindingsOnContextChange()
 	APlayerController* PC = GetController<APlayerController>();
 	UGCFInputComponent* GCFIC = PC ? Cast<UGCFInputComponent>(PC->InputComponent) : nullptr;
 
-	// Iterate backwards to remove
-	for (int32 i = ActiveBindingGroups.Num() - 1; i >= 0; --i) {
-		FGCFInputBindingGroup& Group = ActiveBindingGroups[i];
+	for (auto It = ActiveBindingGroups.CreateIterator(); It; ++It) {
+		const FGCFInputBindingGroup& Group = It.Value();
 
 		// [Logic] Filter Dependencies
 		// Controller-persistent bindings are preserved (e.g. Menu, Chat).
@@ -364,28 +402,42 @@ void UGCFInputBindingManagerComponent::ClearBindingsOnContextChange()
 		}
 
 		// Remove from management list
-		ActiveBindingGroups.RemoveAt(i);
+		It.RemoveCurrent();
 	}
 
 	UE_LOG(LogGCFSystem, Log, TEXT("GCFInputBindingManager: Cleared Pawn-dependent bindings."));
 }
 
 
-void UGCFInputBindingManagerComponent::SendDebugInfo()
+#if !UE_BUILD_SHIPPING
+TArray<FString> UGCFInputBindingManagerComponent::GetDebugBindingInfos(const FGCFInputBindingGroup& Group)
+{
+	TArray<FString> Infos;
+	Infos.Reserve(Group.Receipts.Num());
+
+	for (const FGCFBindingReceipt& Receipt : Group.Receipts) {
+		Infos.Add(FString::Printf(TEXT("%s : %s (%s)"),
+				  *Receipt.AssociatedTag.ToString(),
+				  Receipt.BindingPtr ? *GetNameSafe(Receipt.BindingPtr->GetAction()) : TEXT("None"),
+				  *UGCFDebugFunctionLibrary::GetEnumName(Receipt.TriggerEvent)));
+	}
+	return Infos;
+}
+#endif
+
+
+void UGCFInputBindingManagerComponent::BuildDebugInputSnapshot(FGCFDebugInputSnapshot& OutSnapshot) const
 {
 #if !UE_BUILD_SHIPPING
-	FGCFDebugInputSnapshot Payload;
-	
-	for (const FGCFInputBindingGroup& Group : ActiveBindingGroups) {
+	for (const TPair<FGCFPendingBindingKey, FGCFInputBindingGroup>& Pair : ActiveBindingGroups) {
+		const FGCFInputBindingGroup& Group = Pair.Value;
 		FGCFDebugInputGroup GroupInfo;
 		FString BinderName = Group.Key.Binder.IsValid() ? Group.Key.Binder->GetName() : TEXT("DEAD_OBJECT");
 		FString Dependency = Group.bIsPawnDependent ? TEXT("[Pawn Dependent]") : TEXT("[Controller Persistent]");
 		GroupInfo.GroupName = FString::Printf(TEXT("Binder: %s %s"), *BinderName, *Dependency);
-		GroupInfo.ActiveBindings = Group.DebugBindingInfos;
-		Payload.Groups.Add(GroupInfo);
+		GroupInfo.ActiveBindings = GetDebugBindingInfos(Group);
+		OutSnapshot.Groups.Add(GroupInfo);
 	}
-
-	UGameplayMessageSubsystem::Get(this).BroadcastMessage(GCFGameplayTags::Message_Debug_Input, Payload);
 #endif
 }
 
@@ -397,14 +449,15 @@ void UGCFInputBindingManagerComponent::DumpInputBindings()
 
 	// Active Bindings
 	UE_LOG(LogGCFSystem, Display, TEXT("--- Active Binding Groups (%d) ---"), ActiveBindingGroups.Num());
-	for (const FGCFInputBindingGroup& Group : ActiveBindingGroups) {
+	for (const TPair<FGCFPendingBindingKey, FGCFInputBindingGroup>& Pair : ActiveBindingGroups) {
+		const FGCFInputBindingGroup& Group = Pair.Value;
 		FString BinderName = Group.Key.Binder.IsValid() ? Group.Key.Binder->GetName() : TEXT("DEAD_OBJECT");
 		FString Dependency = Group.bIsPawnDependent ? TEXT("[Pawn Dependent]") : TEXT("[Controller Persistent]");
 
 		UE_LOG(LogGCFSystem, Display, TEXT(" > Binder: %s %s"), *BinderName, *Dependency);
 
-		// Output debug strings saved during ExecuteInputBinding
-		for (const FString& Info : Group.DebugBindingInfos) {
+		// Format debug strings from the receipts recorded during ExecuteInputBinding
+		for (const FString& Info : GetDebugBindingInfos(Group)) {
 			UE_LOG(LogGCFSystem, Display, TEXT("    - %s"), *Info);
 		}
 	}
@@ -413,7 +466,7 @@ void UGCFInputBindingManagerComponent::DumpInputBindings()
 	UE_LOG(LogGCFSystem, Display, TEXT("--- Pending Bindings (%d) ---"), PendingBindings.Num());
 	for (auto It = PendingBindings.CreateIterator(); It; ++It) {
 		const FGCFPendingBindingKey& BindingKey = It.Key();
-		const FGCFInputBindNativeDelegate& Delegate = It.Value();
+		const FGCFPendingBinding& PendingBinding = It.Value();
 
 		// 1. Context Status
 		FString ContextName = BindingKey.Binder.IsValid()
@@ -425,8 +478,7 @@ void UGCFInputBindingManagerComponent::DumpInputBindings()
 		FString FunctionName = BindingKey.KeyName.ToString();
 
 		// 3. Dependency Scope
-		const bool bIsPawnDep = IsBinderPawnDependent(BindingKey.Binder.Get());
-		FString Scope = bIsPawnDep ? TEXT("[Pawn-Dependent]") : TEXT("[Controller-Persistent]");
+		FString Scope = PendingBinding.bIsPawnDependent ? TEXT("[Pawn-Dependent]") : TEXT("[Controller-Persistent]");
 
 		// Log: [Scope] ContextName :: FunctionName
 		UE_LOG(LogGCFSystem, Display, TEXT(" - %-25s %s :: %s"), *Scope, *ContextName, *FunctionName);
@@ -434,4 +486,4 @@ void UGCFInputBindingManagerComponent::DumpInputBindings()
 
 	UE_LOG(LogGCFSystem, Display, TEXT("======================================="));
 #endif
-}
\ No newline at end of file
+}
@@ -8,42 +8,105 @@
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GCFInputConfig)
 
 
+namespace GCFInputConfig
+{
+	static void BuildIndex(const TArray<FGCFInputAction>& Actions, TMap<FGameplayTag, TObjectPtr<const UInputAction>>& OutIndex)
+	{
+		OutIndex.Reset();
+		OutIndex.Reserve(Actions.Num());
+
+		for (const FGCFInputAction& Action : Actions)
+		{
+			// Keep the first valid entry for a tag so the result matches the linear search.
+			if (Action.InputAction && !OutIndex.Contains(Action.InputTag))
+			{
+				OutIndex.Add(Action.InputTag, Action.InputAction);
+			}
+		}
+	}
+}
+
 UGCFInputConfig::UGCFInputConfig(const FObjectInitializer& ObjectInitializer)
 {
 }
 
-const UInputAction* UGCFInputConfig::FindNativeInputActionForTag(const FGameplayTag& InputTag, bool bLogNotFound) const
+void UGCFInputConfig::PostLoad()
 {
-	for (const FGCFInputAction& Action : NativeInputActions)
+	Super::PostLoad();
+
+	RebuildInputActionIndex();
+}
+
+#if WITH_EDITOR
+void UGCFInputConfig::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	RebuildInputActionIndex();
+}
+#endif
+
+void UGCFInputConfig::RebuildInputActionIndex()
+{
+	GCFInputConfig::BuildIndex(NativeInputActions, NativeInputActionIndex);
+	GCFInputConfig::BuildIndex(AbilityInputActions, AbilityInputActionIndex);
+	bInputActionIndexBuilt = true;
+}
+
+const UInputAction* UGCFInputConfig::FindInputActionLinear(const TArray<FGCFInputAction>& Actions, const FGameplayTag& InputTag)
+{
+	for (const FGCFInputAction& Action : Actions)
 	{
 		if (Action.InputAction && (Action.InputTag == InputTag))
 		{
 			return Action.InputAction;
 		}
 	}
+	return nullptr;
+}
+
+const UInputAction* UGCFInputConfig::FindNativeInputActionForTag(const FGameplayTag& InputTag, bool bLogNotFound) const
+{
+	const UInputAction* FoundAction = nullptr;
+	if (bInputActionIndexBuilt)
+	{
+		if (const TObjectPtr<const UInputAction>* Entry = NativeInputActionIndex.Find(InputTag))
+		{
+			FoundAction = *Entry;
+		}
+	}
+	else
+	{
+		FoundAction = FindInputActionLinear(NativeInputActions, InputTag);
+	}
 
-	if (bLogNotFound)
+	if (!FoundAction && bLogNotFound)
 	{
 		UE_LOG(LogGCFCharacter, Error, TEXT("Can't find NativeInputAction for InputTag [%s] on InputConfig [%s]."), *InputTag.ToString(), *GetNameSafe(this));
 	}
 
-	return nullptr;
+	return FoundAction;
 }
 
 const UInputAction* UGCFInputConfig::FindAbilityInputActionForTag(const FGameplayTag& InputTag, bool bLogNotFound) const
 {
-	for (const FGCFInputAction& Action : AbilityInputActions)
+	const UInputAction* FoundAction = nullptr;
+	if (bInputActionIndexBuilt)
 	{
-		if (Action.InputAction && (Action.InputTag == InputTag))
+		if (const TObjectPtr<const UInputAction>* Entry = AbilityInputActionIndex.Find(InputTag))
 		{
-			return Action.InputAction;
+			FoundAction = *Entry;
 		}
 	}
+	else
+	{
+		FoundAction = FindInputActionLinear(AbilityInputActions, InputTag);
+	}
 
-	if (bLogNotFound)
+	if (!FoundAction && bLogNotFound)
 	{
 		UE_LOG(LogGCFCharacter, Error, TEXT("Can't find AbilityInputAction for InputTag [%s] on InputConfig [%s]."), *InputTag.ToString(), *GetNameSafe(this));
 	}
 
-	return nullptr;
+	return FoundAction;
 }
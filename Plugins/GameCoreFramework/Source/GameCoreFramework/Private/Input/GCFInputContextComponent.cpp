@@ -7,7 +7,7 @@
 #include "System/Binder/GCFPossessedPawnReadyStateBinder.h"
 #include "System/Binder/GCFPlayerReadyStateBinder.h"
 #include "System/Binder/GCFControllerPossessionBinder.h"
-#include "System/GCFDebugFunctionLibrary.h"
+#include "System/GCFDebugSubsystem.h"
 #include "Components/GameFrameworkComponentManager.h"
 #include "Misc/EnumClassFlags.h"
 
@@ -119,7 +119,9 @@ void UGCFInputContextComponent::Evaluate()
 		   bLastEvaluatedInputEnabled ? TEXT("Enabled") : TEXT("Disabled"),
 		   bInputAllowed ? TEXT("Enabled") : TEXT("Disabled"));
 
-	UGCFDebugFunctionLibrary::SendStateMessage(this, EGCFDebugStateCategory::InputContext, bInputAllowed ? TEXT("Enabled") : TEXT("Disabled"));
+	if (UGCFDebugSubsystem* DebugSubsystem = UGCFDebugSubsystem::Get(this)) {
+		DebugSubsystem->MarkStateDirty(EGCFDebugStateCategory::InputContext, this, &ThisClass::GetDebugStateValue);
+	}
 
 	bLastEvaluatedInputEnabled = bInputAllowed;
 	OnInputContextEvaluatedNative.Broadcast(CurrentContextState, bInputAllowed);
@@ -135,3 +137,9 @@ bool UGCFInputContextComponent::IsInputAllowed() const
 
 	return EnumHasAllFlags(CurrentContextState, Required);
 }
+
+
+FString UGCFInputContextComponent::GetDebugStateValue() const
+{
+	return IsInputAllowed() ? TEXT("Enabled") : TEXT("Disabled");
+}
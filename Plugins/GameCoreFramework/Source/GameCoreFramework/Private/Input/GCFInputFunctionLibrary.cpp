@@ -8,6 +8,8 @@
 #include "Actor/GCFActorFunctionLibrary.h"
 #include "Input/GCFInputConfigProvider.h"
 #include "Input/GCFInputContextComponent.h"
+#include "Actor/Data/GCFPawnData.h"
+#include "EnhancedInputSubsystems.h"
 
 #include "GameFramework/Controller.h"
 #include "GameFramework/Pawn.h"
@@ -66,4 +68,44 @@ TUniquePtr<FGCFDelegateHandle> UGCFInputFunctionLibrary::BindInputComponentReady
 		&AGCFPlayerController::RegisterAndExecuteDelegate,
 		&AGCFPlayerController::RemoveDelegate,
 		Delegate);
-}
\ No newline at end of file
+}
+
+
+bool UGCFInputFunctionLibrary::ModifyMappingContexts(IEnhancedInputSubsystemInterface* Subsystem, TConstArrayView<FGCFInputMappingContextInfo> ContextsToAdd, TConstArrayView<const UInputMappingContext*> ContextsToRemove)
+{
+	if (!Subsystem || (ContextsToAdd.IsEmpty() && ContextsToRemove.IsEmpty())) {
+		return false;
+	}
+
+	// Each modification only flags a pending rebuild.
+	FModifyContextOptions DeferredOptions;
+	DeferredOptions.bForceImmediately = false;
+
+	int32 RemovedCount = 0;
+	for (const UInputMappingContext* IMC : ContextsToRemove) {
+		if (IMC) {
+			Subsystem->RemoveMappingContext(IMC, DeferredOptions);
+			RemovedCount++;
+		}
+	}
+
+	int32 AddedCount = 0;
+	for (const FGCFInputMappingContextInfo& Info : ContextsToAdd) {
+		if (Info.InputMapping) {
+			Subsystem->AddMappingContext(Info.InputMapping, Info.Priority, DeferredOptions);
+			AddedCount++;
+		}
+	}
+
+	if (RemovedCount == 0 && AddedCount == 0) {
+		return false;
+	}
+
+	// Rebuild once for the whole transaction, so the new mappings are active before any binding runs.
+	FModifyContextOptions RebuildOptions;
+	RebuildOptions.bForceImmediately = true;
+	Subsystem->RequestRebuildControlMappings(RebuildOptions);
+
+	UE_LOG(LogGCFSystem, Verbose, TEXT("ModifyMappingContexts: Removed %d, added %d Mapping Contexts."), RemovedCount, AddedCount);
+	return true;
+}
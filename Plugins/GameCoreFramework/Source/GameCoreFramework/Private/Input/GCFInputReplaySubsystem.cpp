@@ -0,0 +1,552 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Input/GCFInputReplaySubsystem.h"
+
+#include "GCFShared.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/PlatformTime.h"
+#include "Input/GCFPawnInputBridgeComponent.h"
+#include "Input/GCFPlayerInputBridgeComponent.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Movement/Locomotion/GCFLocomotionInputHandler.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GCFInputReplaySubsystem)
+
+
+namespace GCF::InputReplay
+{
+static constexpr uint32 FileMagic = 0x52464347; // "GCFR"
+static constexpr uint32 FileVersion = 1;
+
+static float LocationTolerance = 1.0f;
+static FAutoConsoleVariableRef CVarLocationTolerance(
+	TEXT("GCF.Input.Replay.LocationTolerance"),
+	LocationTolerance,
+	TEXT("Distance (cm) between the recorded and the replayed pawn location above which a frame is reported as divergent.")
+);
+
+/** The world currently recording. Input handlers query this on every event, so it is kept outside the world lookup. */
+static TWeakObjectPtr<UGCFInputReplaySubsystem> ActiveRecorder;
+
+/** The world currently replaying. Physical input handlers query this on every event to drop their input. */
+static TWeakObjectPtr<UGCFInputReplaySubsystem> ActiveReplay;
+
+/** Smallest encoded event: one byte of packed frame delta plus the type byte. Used to reject corrupt event counts. */
+static constexpr int64 MinEventBytes = 2;
+
+#if !UE_BUILD_SHIPPING
+static UGCFInputReplaySubsystem* GetSubsystem(UWorld* World)
+{
+	return World ? World->GetSubsystem<UGCFInputReplaySubsystem>() : nullptr;
+}
+
+static FString GetNameArg(const TArray<FString>& Args)
+{
+	return Args.Num() > 0 ? Args[0] : FString(TEXT("Default"));
+}
+
+static FAutoConsoleCommandWithWorldAndArgs CmdRecordStart(
+	TEXT("GCF.Input.Record.Start"),
+	TEXT("Starts recording the local player's input. Usage: GCF.Input.Record.Start [Name]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World) {
+		if (UGCFInputReplaySubsystem* Subsystem = GetSubsystem(World)) {
+			Subsystem->StartRecording(GetNameArg(Args));
+		}
+	})
+);
+
+static FAutoConsoleCommandWithWorld CmdRecordStop(
+	TEXT("GCF.Input.Record.Stop"),
+	TEXT("Stops recording and writes the recording file."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World) {
+		if (UGCFInputReplaySubsystem* Subsystem = GetSubsystem(World)) {
+			Subsystem->StopRecording();
+		}
+	})
+);
+
+static FAutoConsoleCommandWithWorldAndArgs CmdReplayStart(
+	TEXT("GCF.Input.Replay.Start"),
+	TEXT("Replays a recording through the local player's input bridges. Usage: GCF.Input.Replay.Start [Name]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World) {
+		if (UGCFInputReplaySubsystem* Subsystem = GetSubsystem(World)) {
+			Subsystem->StartReplay(GetNameArg(Args));
+		}
+	})
+);
+
+static FAutoConsoleCommandWithWorld CmdReplayStop(
+	TEXT("GCF.Input.Replay.Stop"),
+	TEXT("Stops the replay and logs the comparison summary."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World) {
+		if (UGCFInputReplaySubsystem* Subsystem = GetSubsystem(World)) {
+			Subsystem->StopReplay();
+		}
+	})
+);
+#endif
+
+static bool IsAbilityEvent(EGCFInputReplayEventType Type)
+{
+	switch (Type) {
+		case EGCFInputReplayEventType::PawnAbilityPressed:
+		case EGCFInputReplayEventType::PawnAbilityReleased:
+		case EGCFInputReplayEventType::PlayerAbilityPressed:
+		case EGCFInputReplayEventType::PlayerAbilityReleased:
+			return true;
+		default:
+			return false;
+	}
+}
+
+static void SerializeEvent(FArchive& Ar, FGCFInputReplayEvent& Event)
+{
+	uint8 Type = (uint8)Event.Type;
+	Ar << Type;
+	Event.Type = (EGCFInputReplayEventType)Type;
+
+	if (IsAbilityEvent(Event.Type)) {
+		uint32 TagIndex = (uint32)Event.TagIndex;
+		Ar.SerializeIntPacked(TagIndex);
+		Event.TagIndex = (int32)TagIndex;
+		return;
+	}
+
+	switch (Event.Type) {
+		case EGCFInputReplayEventType::Move:
+			Ar << Event.Vector.X << Event.Vector.Y;
+			Ar << Event.Rotation.Pitch << Event.Rotation.Yaw << Event.Rotation.Roll;
+			break;
+		case EGCFInputReplayEventType::MoveUp:
+			Ar << Event.Vector.X;
+			break;
+		case EGCFInputReplayEventType::Jump:
+		case EGCFInputReplayEventType::Crouch:
+		{
+			uint8 bPressed = Event.Vector.X != 0.0f;
+			Ar << bPressed;
+			Event.Vector.X = bPressed ? 1.0f : 0.0f;
+			break;
+		}
+		case EGCFInputReplayEventType::PawnLocation:
+			Ar << Event.Vector;
+			break;
+		default:
+			// Unknown type byte: the payload size is unknown, so the rest of the stream cannot be read.
+			Ar.SetError();
+			break;
+	}
+}
+}
+
+
+UGCFInputReplaySubsystem* UGCFInputReplaySubsystem::GetActiveRecorder(const UObject* WorldContextObject)
+{
+#if !UE_BUILD_SHIPPING
+	UGCFInputReplaySubsystem* Recorder = GCF::InputReplay::ActiveRecorder.Get();
+	if (Recorder && WorldContextObject && Recorder->GetWorld() == WorldContextObject->GetWorld()) {
+		return Recorder;
+	}
+#endif
+	return nullptr;
+}
+
+
+bool UGCFInputReplaySubsystem::IsReplayActive(const UObject* WorldContextObject)
+{
+#if !UE_BUILD_SHIPPING
+	const UGCFInputReplaySubsystem* Replay = GCF::InputReplay::ActiveReplay.Get();
+	return Replay && WorldContextObject && Replay->GetWorld() == WorldContextObject->GetWorld();
+#else
+	return false;
+#endif
+}
+
+
+bool UGCFInputReplaySubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if UE_BUILD_SHIPPING
+	return false;
+#else
+	return Super::ShouldCreateSubsystem(Outer);
+#endif
+}
+
+
+void UGCFInputReplaySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (!InWorld.IsGameWorld()) {
+		return;
+	}
+
+	FString Name;
+	if (FParse::Value(FCommandLine::Get(), TEXT("GCFInputReplay="), Name)) {
+		bExitWhenReplayFinished = StartReplay(Name);
+	} else if (FParse::Value(FCommandLine::Get(), TEXT("GCFInputRecord="), Name)) {
+		StartRecording(Name);
+	}
+}
+
+
+void UGCFInputReplaySubsystem::Deinitialize()
+{
+	StopRecording();
+	StopReplay();
+
+	Super::Deinitialize();
+}
+
+
+bool UGCFInputReplaySubsystem::StartRecording(const FString& Name)
+{
+	StopRecording();
+	StopReplay();
+
+	if (UGCFInputReplaySubsystem* OtherRecorder = GCF::InputReplay::ActiveRecorder.Get()) {
+		OtherRecorder->StopRecording();
+	}
+
+	Mode = EMode::Recording;
+	RecordingName = Name;
+	CurrentFrame = 0;
+	Tags.Reset();
+	TagIndices.Reset();
+	Events.Reset();
+
+	GCF::InputReplay::ActiveRecorder = this;
+	PreActorTickHandle = FWorldDelegates::OnWorldPreActorTick.AddUObject(this, &ThisClass::HandlePreActorTick);
+
+	UE_LOG(LogGCFSystem, Display, TEXT("GCF.Input.Record: Recording '%s'."), *Name);
+	return true;
+}
+
+
+void UGCFInputReplaySubsystem::StopRecording()
+{
+	if (Mode != EMode::Recording) {
+		return;
+	}
+
+	FWorldDelegates::OnWorldPreActorTick.Remove(PreActorTickHandle);
+	PreActorTickHandle.Reset();
+	GCF::InputReplay::ActiveRecorder.Reset();
+	Mode = EMode::Idle;
+
+	if (SaveRecording()) {
+		UE_LOG(LogGCFSystem, Display, TEXT("GCF.Input.Record: Wrote %d events over %u frames to %s."), Events.Num(), CurrentFrame, *GetRecordingPath(RecordingName));
+	} else {
+		UE_LOG(LogGCFSystem, Error, TEXT("GCF.Input.Record: Failed to write %s."), *GetRecordingPath(RecordingName));
+	}
+	Events.Empty();
+}
+
+
+bool UGCFInputReplaySubsystem::StartReplay(const FString& Name)
+{
+	StopRecording();
+	StopReplay();
+
+	if (!LoadRecording(Name)) {
+		UE_LOG(LogGCFSystem, Error, TEXT("GCF.Input.Replay: Could not load %s."), *GetRecordingPath(Name));
+		return false;
+	}
+
+	Mode = EMode::Replaying;
+	RecordingName = Name;
+	CurrentFrame = 0;
+	ReplayCursor = 0;
+	ReplayStartTime = FPlatformTime::Seconds();
+	MaxLocationError = 0.0f;
+	FirstDivergentFrame = INDEX_NONE;
+	DivergentFrameCount = 0;
+
+	GCF::InputReplay::ActiveReplay = this;
+	PreActorTickHandle = FWorldDelegates::OnWorldPreActorTick.AddUObject(this, &ThisClass::HandlePreActorTick);
+
+	UE_LOG(LogGCFSystem, Display, TEXT("GCF.Input.Replay: Replaying '%s' (%d events, %u frames)."), *Name, Events.Num(), ReplayFrameCount);
+	return true;
+}
+
+
+void UGCFInputReplaySubsystem::StopReplay()
+{
+	if (Mode != EMode::Replaying) {
+		return;
+	}
+
+	FWorldDelegates::OnWorldPreActorTick.Remove(PreActorTickHandle);
+	PreActorTickHandle.Reset();
+	if (GCF::InputReplay::ActiveReplay.Get() == this) {
+		GCF::InputReplay::ActiveReplay.Reset();
+	}
+	Mode = EMode::Idle;
+
+	const double ElapsedSeconds = FPlatformTime::Seconds() - ReplayStartTime;
+	UE_LOG(LogGCFSystem, Display, TEXT("GCF.Input.Replay: '%s' finished. Frames: %u/%u, wall time %.2f s (%.3f ms/frame). Max location error %.3f cm, divergent frames %d (first %d)."),
+		   *RecordingName, CurrentFrame, ReplayFrameCount, ElapsedSeconds, CurrentFrame > 0 ? ElapsedSeconds * 1000.0 / CurrentFrame : 0.0,
+		   MaxLocationError, DivergentFrameCount, FirstDivergentFrame);
+
+	Events.Empty();
+
+	if (bExitWhenReplayFinished) {
+		bExitWhenReplayFinished = false;
+		FPlatformMisc::RequestExit(false, TEXT("GCF.Input.Replay"));
+	}
+}
+
+
+void UGCFInputReplaySubsystem::HandlePreActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (InWorld != GetWorld()) {
+		return;
+	}
+
+	++CurrentFrame;
+
+	if (Mode == EMode::Recording) {
+		if (const APlayerController* PC = InWorld->GetFirstPlayerController()) {
+			if (const APawn* Pawn = PC->GetPawn()) {
+				AddEvent(EGCFInputReplayEventType::PawnLocation).Vector = FVector3f(Pawn->GetActorLocation());
+			}
+		}
+		return;
+	}
+
+	while (Events.IsValidIndex(ReplayCursor) && Events[ReplayCursor].Frame <= CurrentFrame) {
+		DispatchEvent(Events[ReplayCursor++]);
+	}
+
+	if (CurrentFrame >= ReplayFrameCount) {
+		StopReplay();
+	}
+}
+
+
+void UGCFInputReplaySubsystem::DispatchEvent(const FGCFInputReplayEvent& Event)
+{
+	APlayerController* PC = GetWorld()->GetFirstPlayerController();
+	APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+
+	if (Event.Type == EGCFInputReplayEventType::PawnLocation) {
+		CompareLocation(Event);
+		return;
+	}
+
+	if (GCF::InputReplay::IsAbilityEvent(Event.Type)) {
+		const FGameplayTag& InputTag = Tags.IsValidIndex(Event.TagIndex) ? Tags[Event.TagIndex] : FGameplayTag::EmptyTag;
+		const bool bPressed = Event.Type == EGCFInputReplayEventType::PawnAbilityPressed || Event.Type == EGCFInputReplayEventType::PlayerAbilityPressed;
+		const bool bFromPawn = Event.Type == EGCFInputReplayEventType::PawnAbilityPressed || Event.Type == EGCFInputReplayEventType::PawnAbilityReleased;
+
+		if (bFromPawn) {
+			if (UGCFPawnInputBridgeComponent* Bridge = Pawn ? Pawn->FindComponentByClass<UGCFPawnInputBridgeComponent>() : nullptr) {
+				Bridge->ReplayAbilityInput(InputTag, bPressed);
+			}
+		} else if (UGCFPlayerInputBridgeComponent* Bridge = PC ? PC->FindComponentByClass<UGCFPlayerInputBridgeComponent>() : nullptr) {
+			Bridge->ReplayAbilityInput(InputTag, bPressed);
+		}
+		return;
+	}
+
+	if (!Pawn || !Pawn->Implements<UGCFLocomotionInputHandler>()) {
+		return;
+	}
+
+	switch (Event.Type) {
+		case EGCFInputReplayEventType::Move:
+			IGCFLocomotionInputHandler::Execute_HandleMoveInput(Pawn, FVector2D(Event.Vector.X, Event.Vector.Y), FRotator(Event.Rotation));
+			break;
+		case EGCFInputReplayEventType::MoveUp:
+			IGCFLocomotionInputHandler::Execute_HandleMoveUpInput(Pawn, Event.Vector.X);
+			break;
+		case EGCFInputReplayEventType::Jump:
+			IGCFLocomotionInputHandler::Execute_HandleJumpInput(Pawn, Event.Vector.X != 0.0f);
+			break;
+		case EGCFInputReplayEventType::Crouch:
+			IGCFLocomotionInputHandler::Execute_HandleCrouchInput(Pawn, Event.Vector.X != 0.0f);
+			break;
+		default:
+			break;
+	}
+}
+
+
+void UGCFInputReplaySubsystem::CompareLocation(const FGCFInputReplayEvent& Event)
+{
+	const APlayerController* PC = GetWorld()->GetFirstPlayerController();
+	const APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+	if (!Pawn) {
+		return;
+	}
+
+	const float Error = FVector3f::Dist(FVector3f(Pawn->GetActorLocation()), Event.Vector);
+	MaxLocationError = FMath::Max(MaxLocationError, Error);
+
+	if (Error > GCF::InputReplay::LocationTolerance) {
+		++DivergentFrameCount;
+		if (FirstDivergentFrame == INDEX_NONE) {
+			FirstDivergentFrame = (int32)Event.Frame;
+			UE_LOG(LogGCFSystem, Warning, TEXT("GCF.Input.Replay: Diverged at frame %u (error %.3f cm)."), Event.Frame, Error);
+		}
+	}
+}
+
+
+void UGCFInputReplaySubsystem::RecordAbilityInput(EGCFInputSourceType Source, const FGameplayTag& InputTag, bool bPressed)
+{
+	const bool bFromPawn = Source == EGCFInputSourceType::Pawn;
+	const EGCFInputReplayEventType Type = bFromPawn
+		? (bPressed ? EGCFInputReplayEventType::PawnAbilityPressed : EGCFInputReplayEventType::PawnAbilityReleased)
+		: (bPressed ? EGCFInputReplayEventType::PlayerAbilityPressed : EGCFInputReplayEventType::PlayerAbilityReleased);
+
+	AddEvent(Type).TagIndex = GetTagIndex(InputTag);
+}
+
+
+void UGCFInputReplaySubsystem::RecordMoveInput(const FVector2D& InputValue, const FRotator& MovementRotation)
+{
+	FGCFInputReplayEvent& Event = AddEvent(EGCFInputReplayEventType::Move);
+	Event.Vector = FVector3f((float)InputValue.X, (float)InputValue.Y, 0.0f);
+	Event.Rotation = FRotator3f(MovementRotation);
+}
+
+
+void UGCFInputReplaySubsystem::RecordMoveUpInput(float Value)
+{
+	AddEvent(EGCFInputReplayEventType::MoveUp).Vector.X = Value;
+}
+
+
+void UGCFInputReplaySubsystem::RecordJumpInput(bool bPressed)
+{
+	AddEvent(EGCFInputReplayEventType::Jump).Vector.X = bPressed ? 1.0f : 0.0f;
+}
+
+
+void UGCFInputReplaySubsystem::RecordCrouchInput(bool bPressed)
+{
+	AddEvent(EGCFInputReplayEventType::Crouch).Vector.X = bPressed ? 1.0f : 0.0f;
+}
+
+
+FGCFInputReplayEvent& UGCFInputReplaySubsystem::AddEvent(EGCFInputReplayEventType Type)
+{
+	FGCFInputReplayEvent& Event = Events.AddDefaulted_GetRef();
+	Event.Frame = CurrentFrame;
+	Event.Type = Type;
+	return Event;
+}
+
+
+int32 UGCFInputReplaySubsystem::GetTagIndex(const FGameplayTag& Tag)
+{
+	if (const int32* Index = TagIndices.Find(Tag)) {
+		return *Index;
+	}
+	const int32 Index = Tags.Add(Tag);
+	TagIndices.Add(Tag, Index);
+	return Index;
+}
+
+
+bool UGCFInputReplaySubsystem::SaveRecording() const
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+
+	uint32 Magic = GCF::InputReplay::FileMagic;
+	uint32 Version = GCF::InputReplay::FileVersion;
+	uint32 FrameCount = CurrentFrame;
+	Writer << Magic << Version << FrameCount;
+
+	TArray<FString> TagNames;
+	TagNames.Reserve(Tags.Num());
+	for (const FGameplayTag& Tag : Tags) {
+		TagNames.Add(Tag.ToString());
+	}
+	Writer << TagNames;
+
+	int32 EventCount = Events.Num();
+	Writer << EventCount;
+
+	// Frames are stored as packed deltas; most events are zero or one frame apart.
+	uint32 PreviousFrame = 0;
+	for (const FGCFInputReplayEvent& Event : Events) {
+		uint32 FrameDelta = Event.Frame - PreviousFrame;
+		Writer.SerializeIntPacked(FrameDelta);
+		PreviousFrame = Event.Frame;
+
+		FGCFInputReplayEvent MutableEvent = Event;
+		GCF::InputReplay::SerializeEvent(Writer, MutableEvent);
+	}
+
+	return FFileHelper::SaveArrayToFile(Bytes, *GetRecordingPath(RecordingName));
+}
+
+
+bool UGCFInputReplaySubsystem::LoadRecording(const FString& Name)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *GetRecordingPath(Name))) {
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	uint32 FrameCount = 0;
+	Reader << Magic << Version << FrameCount;
+	if (Magic != GCF::InputReplay::FileMagic || Version != GCF::InputReplay::FileVersion) {
+		return false;
+	}
+
+	TArray<FString> TagNames;
+	Reader << TagNames;
+
+	Tags.Reset();
+	TagIndices.Reset();
+	for (const FString& TagName : TagNames) {
+		// Unknown tags stay as empty entries so the stored indices remain valid.
+		Tags.Add(FGameplayTag::RequestGameplayTag(FName(*TagName), false));
+	}
+
+	int32 EventCount = 0;
+	Reader << EventCount;
+
+	// The count comes from the file; reject it before reserving if the remaining bytes cannot hold that many events.
+	const int64 RemainingBytes = Reader.TotalSize() - Reader.Tell();
+	if (Reader.IsError() || EventCount < 0 || (int64)EventCount > RemainingBytes / GCF::InputReplay::MinEventBytes) {
+		return false;
+	}
+
+	Events.Reset(EventCount);
+	uint32 Frame = 0;
+	for (int32 i = 0; i < EventCount && !Reader.IsError(); ++i) {
+		uint32 FrameDelta = 0;
+		Reader.SerializeIntPacked(FrameDelta);
+		Frame += FrameDelta;
+
+		FGCFInputReplayEvent& Event = Events.AddDefaulted_GetRef();
+		Event.Frame = Frame;
+		GCF::InputReplay::SerializeEvent(Reader, Event);
+	}
+
+	ReplayFrameCount = FrameCount;
+	return !Reader.IsError();
+}
+
+
+FString UGCFInputReplaySubsystem::GetRecordingPath(const FString& Name)
+{
+	return FPaths::ProjectSavedDir() / TEXT("GCFInput") / (Name + TEXT(".gcfinput"));
+}
@@ -7,11 +7,13 @@
 #include "Input/GCFInputConfig.h"
 #include "Input/GCFInputBindingManagerComponent.h"
 #include "Input/GCFAbilityInputRouterComponent.h"
+#include "Input/GCFInputReplaySubsystem.h"
 #include "GameFramework/Pawn.h"
 #include "GameFramework/PlayerController.h"
 #include "System/Lifecycle/GCFPawnReadyStateComponent.h"
 #include "System/Binder/GCFPawnReadyStateBinder.h"
 #include "Components/GameFrameworkComponentManager.h"
+#include "System/GCFInputLatencyTracker.h"
 
 
 UGCFPawnInputBridgeComponent::UGCFPawnInputBridgeComponent(const FObjectInitializer& ObjectInitializer)
@@ -109,8 +111,29 @@ void UGCFPawnInputBridgeComponent::HandlePawnReadyStateChanged(const FGCFPawnRea
 }
 
 
+void UGCFPawnInputBridgeComponent::ReplayAbilityInput(FGameplayTag InputTag, bool bPressed)
+{
+	// Bypasses the physical handlers, which drop their input while a replay is active.
+	if (bPressed) {
+		FGCFInputLatencyTracker::MarkAbilityInput(InputTag);
+	}
+	if (AbilityInputRouter.Get()) {
+		AbilityInputRouter->RouteInputTag(InputTag, bPressed);
+	}
+}
+
+
 void UGCFPawnInputBridgeComponent::HandleInputPressed(FGameplayTag InputTag)
 {
+	if (UGCFInputReplaySubsystem::IsReplayActive(this)) {
+		return;
+	}
+
+	FGCFInputLatencyTracker::MarkAbilityInput(InputTag);
+	if (UGCFInputReplaySubsystem* Recorder = UGCFInputReplaySubsystem::GetActiveRecorder(this)) {
+		Recorder->RecordAbilityInput(EGCFInputSourceType::Pawn, InputTag, true);
+	}
+
 	// Forward the event to the centralized router on the Controller (Soul).
 	if (AbilityInputRouter.Get()) {
 		AbilityInputRouter->RouteInputTag(InputTag, true);
@@ -120,6 +143,14 @@ void UGCFPawnInputBridgeComponent::HandleInputPressed(FGameplayTag InputTag)
 
 void UGCFPawnInputBridgeComponent::HandleInputReleased(FGameplayTag InputTag)
 {
+	if (UGCFInputReplaySubsystem::IsReplayActive(this)) {
+		return;
+	}
+
+	if (UGCFInputReplaySubsystem* Recorder = UGCFInputReplaySubsystem::GetActiveRecorder(this)) {
+		Recorder->RecordAbilityInput(EGCFInputSourceType::Pawn, InputTag, false);
+	}
+
 	if (AbilityInputRouter.Get()) {
 		AbilityInputRouter->RouteInputTag(InputTag, false);
 	}
@@ -6,7 +6,9 @@
 #include "Input/GCFAbilityInputRouterComponent.h"
 #include "Input/GCFInputComponent.h"
 #include "Input/GCFInputBindingManagerComponent.h"
+#include "Input/GCFInputReplaySubsystem.h"
 #include "GameFramework/PlayerController.h"
+#include "System/GCFInputLatencyTracker.h"
 
 
 UGCFPlayerInputBridgeComponent::UGCFPlayerInputBridgeComponent(const FObjectInitializer& ObjectInitializer)
@@ -95,8 +97,29 @@ TArray<FGCFBindingReceipt> UGCFPlayerInputBridgeComponent::HandleInputBinding(UG
 }
 
 
+void UGCFPlayerInputBridgeComponent::ReplayAbilityInput(FGameplayTag InputTag, bool bPressed)
+{
+	// Bypasses the physical handlers, which drop their input while a replay is active.
+	if (bPressed) {
+		FGCFInputLatencyTracker::MarkAbilityInput(InputTag);
+	}
+	if (AbilityInputRouter.Get()) {
+		AbilityInputRouter->RouteInputTag(InputTag, bPressed);
+	}
+}
+
+
 void UGCFPlayerInputBridgeComponent::HandleInputPressed(const FGameplayTag InputTag)
 {
+	if (UGCFInputReplaySubsystem::IsReplayActive(this)) {
+		return;
+	}
+
+	FGCFInputLatencyTracker::MarkAbilityInput(InputTag);
+	if (UGCFInputReplaySubsystem* Recorder = UGCFInputReplaySubsystem::GetActiveRecorder(this)) {
+		Recorder->RecordAbilityInput(EGCFInputSourceType::Player, InputTag, true);
+	}
+
 	if (AbilityInputRouter.Get()) {
 		AbilityInputRouter->RouteInputTag(InputTag, /*bPressed=*/true);
 	}
@@ -105,6 +128,14 @@ void UGCFPlayerInputBridgeComponent::HandleInputPressed(const FGameplayTag Input
 
 void UGCFPlayerInputBridgeComponent::HandleInputReleased(const FGameplayTag InputTag)
 {
+	if (UGCFInputReplaySubsystem::IsReplayActive(this)) {
+		return;
+	}
+
+	if (UGCFInputReplaySubsystem* Recorder = UGCFInputReplaySubsystem::GetActiveRecorder(this)) {
+		Recorder->RecordAbilityInput(EGCFInputSourceType::Player, InputTag, false);
+	}
+
 	if (AbilityInputRouter.Get()) {
 		AbilityInputRouter->RouteInputTag(InputTag, /*bPressed=*/false);
 	}
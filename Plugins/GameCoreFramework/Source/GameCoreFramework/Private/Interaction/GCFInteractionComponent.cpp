@@ -9,6 +9,7 @@
 #include "AbilitySystem/GCFAbilitySystemFunctionLibrary.h"
 #include "AbilitySystemComponent.h"
 #include "GameFramework/PlayerController.h"
+#include "GameFramework/GameplayMessageSubsystem.h"
 #include "Actor/Data/GCFPawnData.h"
 #include "Input/GCFInputConfigProvider.h"
 #include "Input/GCFInputComponent.h"
@@ -39,13 +40,11 @@ void UGCFInteractionComponent::BeginPlay()
 
 	// Subscribe to Camera Mode changes
 	if (UWorld* World = GetWorld()) {
-		UGameplayMessageSubsystem& MessageSubsystem = UGameplayMessageSubsystem::Get(World);
-		CameraMessageHandle = MakeUnique<FGCFMessageSubscription>(
-			World,
-			MessageSubsystem.RegisterListener<FGCFCameraModeChangedMessage>(
-			GCFGameplayTags::Message_Camera_ModeChange,
-			this,
-			&ThisClass::OnCameraModeMessageReceived));
+		if (UGCFNativeMessageSubsystem* MessageSubsystem = World->GetSubsystem<UGCFNativeMessageSubsystem>()) {
+			CameraMessageHandle = MakeUnique<FGCFMessageSubscription>(
+				World,
+				MessageSubsystem->RegisterListener<FGCFCameraModeChangedMessage>(this, &ThisClass::OnCameraModeMessageReceived));
+		}
 	}
 
 	UpdateActiveCameraMode(DefaultCameraModeTag);
@@ -97,8 +96,9 @@ void UGCFInteractionComponent::TickComponent(float DeltaTime, ELevelTick TickTyp
 
 void UGCFInteractionComponent::UpdateFocusedTarget(AActor* NewTarget)
 {
-	if (FocusedTarget) {
-		IGCFInteractable::Execute_OnEndFocus(FocusedTarget);
+	AActor* PreviousTarget = FocusedTarget;
+	if (PreviousTarget) {
+		IGCFInteractable::Execute_OnEndFocus(PreviousTarget);
 	}
 
 	FocusedTarget = NewTarget;
@@ -106,6 +106,21 @@ void UGCFInteractionComponent::UpdateFocusedTarget(AActor* NewTarget)
 	if (FocusedTarget) {
 		IGCFInteractable::Execute_OnBeginFocus(FocusedTarget);
 	}
+
+	if (PreviousTarget != FocusedTarget) {
+		FGCFInteractionFocusChangedMessage Message;
+		Message.PreviousTarget = PreviousTarget;
+		Message.NewTarget = FocusedTarget;
+		Message.Controller = GetController<AController>();
+
+		// Typed channel for native listeners, tag channel for Blueprint listeners.
+		if (UGCFNativeMessageSubsystem* NativeSubsystem = UGCFNativeMessageSubsystem::Get(this)) {
+			if (NativeSubsystem->HasListeners<FGCFInteractionFocusChangedMessage>()) {
+				NativeSubsystem->BroadcastMessage(Message);
+			}
+		}
+		UGameplayMessageSubsystem::Get(this).BroadcastMessage(GCFGameplayTags::Message_Interaction_FocusChange, Message);
+	}
 }
 
 
@@ -136,7 +151,7 @@ void UGCFInteractionComponent::UpdateActiveCameraMode(FGameplayTag NewCameraMode
 }
 
 
-void UGCFInteractionComponent::OnCameraModeMessageReceived(FGameplayTag Channel, const FGCFCameraModeChangedMessage& Message)
+void UGCFInteractionComponent::OnCameraModeMessageReceived(const FGCFCameraModeChangedMessage& Message)
 {
 	if (AController* Controller = GetController<AController>()) {
 		if (Message.Controller == Controller) {
@@ -11,12 +11,20 @@ FGCFMessageSubscription::FGCFMessageSubscription(UWorld* World, FGameplayMessage
 {};
 
 
+FGCFMessageSubscription::FGCFMessageSubscription(UWorld* World, FGCFNativeMessageListenerHandle InNativeHandle)
+	: WeakWorld(World)
+	, NativeHandle(InNativeHandle)
+{};
+
+
 FGCFMessageSubscription::FGCFMessageSubscription(FGCFMessageSubscription&& Other) noexcept
 	: WeakWorld(Other.WeakWorld)
 	, Handle(Other.Handle)
+	, NativeHandle(Other.NativeHandle)
 {
 	// Invalidate the source handle so it doesn't unsubscribe on destruction
 	Other.Handle = FGameplayMessageListenerHandle();
+	Other.NativeHandle = FGCFNativeMessageListenerHandle();
 	Other.WeakWorld = nullptr;
 }
 
@@ -29,9 +37,11 @@ FGCFMessageSubscription& FGCFMessageSubscription::operator=(FGCFMessageSubscript
 
 		WeakWorld = Other.WeakWorld;
 		Handle = Other.Handle;
+		NativeHandle = Other.NativeHandle;
 
 		// Invalidate the source
 		Other.Handle = FGameplayMessageListenerHandle();
+		Other.NativeHandle = FGCFNativeMessageListenerHandle();
 		Other.WeakWorld = nullptr;
 	}
 	return *this;
@@ -49,5 +59,12 @@ void FGCFMessageSubscription::Unsubscribe()
 		// Invalidate handle to prevent double unregistration
 		Handle = FGameplayMessageListenerHandle();
 	}
+
+	if (NativeHandle.IsValid()) {
+		if (UGCFNativeMessageSubsystem* NativeSubsystem = UGCFNativeMessageSubsystem::Get(WeakWorld.Get())) {
+			NativeSubsystem->UnregisterListener(NativeHandle);
+		}
+		NativeHandle = FGCFNativeMessageListenerHandle();
+	}
 	WeakWorld.Reset();
 }
\ No newline at end of file
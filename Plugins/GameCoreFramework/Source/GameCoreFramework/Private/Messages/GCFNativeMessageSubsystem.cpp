@@ -0,0 +1,108 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Messages/GCFNativeMessageSubsystem.h"
+
+#include "GCFShared.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GCFNativeMessageSubsystem)
+
+
+UGCFNativeMessageSubsystem* UGCFNativeMessageSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr) {
+		return World->GetSubsystem<UGCFNativeMessageSubsystem>();
+	}
+	return nullptr;
+}
+
+
+void UGCFNativeMessageSubsystem::Deinitialize()
+{
+	Channels.Empty();
+	Super::Deinitialize();
+}
+
+
+void UGCFNativeMessageSubsystem::BroadcastMessageInternal(const UScriptStruct* MessageType, const void* Payload)
+{
+	const TUniquePtr<FChannel>* ChannelPtr = Channels.Find(MessageType);
+	if (!ChannelPtr) {
+		return;
+	}
+
+	FChannel& Channel = **ChannelPtr;
+
+	// Listeners registered during this broadcast are not called until the next one.
+	const int32 ListenerCount = Channel.Listeners.Num();
+
+	++Channel.BroadcastDepth;
+	for (int32 Index = 0; Index < ListenerCount; ++Index) {
+		// Index access (not a cached reference) because a callback may append and reallocate the array.
+		if (Channel.Listeners[Index].Callback) {
+			Channel.Listeners[Index].Callback(Payload);
+		}
+	}
+	--Channel.BroadcastDepth;
+
+	if (Channel.BroadcastDepth == 0 && Channel.bHasPendingRemovals) {
+		Channel.Listeners.RemoveAll([](const FListener& Listener) { return !Listener.Callback; });
+		Channel.bHasPendingRemovals = false;
+	}
+}
+
+
+FGCFNativeMessageListenerHandle UGCFNativeMessageSubsystem::RegisterListenerInternal(const UScriptStruct* MessageType, TFunction<void(const void*)>&& Callback)
+{
+	if (!MessageType || !Callback) {
+		return FGCFNativeMessageListenerHandle();
+	}
+
+	TUniquePtr<FChannel>& Channel = Channels.FindOrAdd(MessageType);
+	if (!Channel) {
+		Channel = MakeUnique<FChannel>();
+	}
+
+	FListener& Listener = Channel->Listeners.AddDefaulted_GetRef();
+	Listener.ID = ++LastListenerID;
+	Listener.Callback = MoveTemp(Callback);
+
+	return FGCFNativeMessageListenerHandle{ MessageType, Listener.ID };
+}
+
+
+void UGCFNativeMessageSubsystem::UnregisterListener(FGCFNativeMessageListenerHandle& Handle)
+{
+	if (!Handle.IsValid()) {
+		return;
+	}
+
+	if (const TUniquePtr<FChannel>* ChannelPtr = Channels.Find(Handle.MessageType)) {
+		FChannel& Channel = **ChannelPtr;
+		const int32 ListenerIndex = Channel.Listeners.IndexOfByPredicate([ID = Handle.ID](const FListener& Listener) { return Listener.ID == ID; });
+
+		if (ListenerIndex != INDEX_NONE) {
+			if (Channel.BroadcastDepth > 0) {
+				// Defer the removal so the broadcast loop's indices stay valid.
+				Channel.Listeners[ListenerIndex].Callback = nullptr;
+				Channel.bHasPendingRemovals = true;
+			} else {
+				Channel.Listeners.RemoveAt(ListenerIndex);
+			}
+		}
+	}
+
+	Handle = FGCFNativeMessageListenerHandle();
+}
+
+
+bool UGCFNativeMessageSubsystem::HasListenersInternal(const UScriptStruct* MessageType) const
+{
+	if (const TUniquePtr<FChannel>* ChannelPtr = Channels.Find(MessageType)) {
+		return (*ChannelPtr)->Listeners.Num() > 0;
+	}
+	return false;
+}
+
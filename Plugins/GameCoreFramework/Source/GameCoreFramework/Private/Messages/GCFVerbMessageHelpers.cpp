@@ -7,9 +7,100 @@
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/PlayerState.h"
 #include "GameplayEffectTypes.h"
+#include "GenericTeamAgentInterface.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GCFVerbMessageHelpers)
 
+namespace GCFVerbMessageHelpers
+{
+	// Resolves the team of an object directly, or through the player state that owns it
+	static uint8 ResolveTeamId(UObject* Object)
+	{
+		if (const IGenericTeamAgentInterface* TeamAgent = Cast<IGenericTeamAgentInterface>(Object))
+		{
+			return TeamAgent->GetGenericTeamId().GetId();
+		}
+
+		if (const IGenericTeamAgentInterface* TeamAgent = Cast<IGenericTeamAgentInterface>(UGCFVerbMessageHelpers::GetPlayerStateFromObject(Object)))
+		{
+			return TeamAgent->GetGenericTeamId().GetId();
+		}
+
+		return NoTeamId;
+	}
+
+	// Resolves the actor whose location stands for an object; a player state or controller stands for its pawn
+	static const AActor* ResolveLocationActor(UObject* Object)
+	{
+		if (const APlayerState* PlayerState = Cast<APlayerState>(Object))
+		{
+			return PlayerState->GetPawn();
+		}
+
+		if (const AController* Controller = Cast<AController>(Object))
+		{
+			return Controller->GetPawn();
+		}
+
+		return Cast<AActor>(Object);
+	}
+
+	bool ResolveRelevancyOrigin(const FGCFVerbMessage& Message, FVector& OutOrigin)
+	{
+		// An explicit flag, so a message at the world origin is not mistaken for one without an origin
+		if (Message.bHasRelevancyOrigin)
+		{
+			OutOrigin = Message.RelevancyOrigin;
+			return true;
+		}
+
+		for (UObject* Object : { Message.Target.Get(), Message.Instigator.Get() })
+		{
+			if (const AActor* Actor = ResolveLocationActor(Object))
+			{
+				OutOrigin = Actor->GetActorLocation();
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool IsMessageRelevantToReceiver(const FGCFVerbMessage& Message, uint8 InstigatorTeamId, const FRelevancyReceiver& Receiver)
+	{
+		switch (Message.Relevancy)
+		{
+		case EGCFVerbMessageRelevancy::TeamOnly:
+			return (InstigatorTeamId != NoTeamId) && (Receiver.TeamId == InstigatorTeamId);
+
+		case EGCFVerbMessageRelevancy::Participants:
+			return Receiver.bIsParticipant;
+
+		case EGCFVerbMessageRelevancy::WithinRadius:
+		{
+			// Nothing is within a zero radius
+			if (Message.RelevancyRadius <= 0.0f)
+			{
+				return false;
+			}
+
+			FVector Origin;
+			if (!ResolveRelevancyOrigin(Message, Origin))
+			{
+				// The origin actors are gone; deliver rather than silently drop the message
+				return true;
+			}
+
+			return Receiver.bHasViewLocation && (FVector::DistSquared(Receiver.ViewLocation, Origin) <= FMath::Square(Message.RelevancyRadius));
+		}
+
+		case EGCFVerbMessageRelevancy::All:
+		default:
+			return true;
+		}
+	}
+}
+
 //////////////////////////////////////////////////////////////////////
 // FGCFVerbMessage
 
@@ -95,3 +186,40 @@ FGCFVerbMessage UGCFVerbMessageHelpers::CueParametersToVerbMessage(const FGamepl
 	return Result;
 }
 
+bool UGCFVerbMessageHelpers::IsMessageRelevantToPlayer(const FGCFVerbMessage& Message, const APlayerController* PlayerController)
+{
+	if (!PlayerController)
+	{
+		return false;
+	}
+
+	// Only resolve what the message's relevancy mode actually needs
+	GCFVerbMessageHelpers::FRelevancyReceiver Receiver;
+	uint8 InstigatorTeamId = GCFVerbMessageHelpers::NoTeamId;
+
+	switch (Message.Relevancy)
+	{
+	case EGCFVerbMessageRelevancy::TeamOnly:
+		InstigatorTeamId = GCFVerbMessageHelpers::ResolveTeamId(Message.Instigator);
+		Receiver.TeamId = GCFVerbMessageHelpers::ResolveTeamId(PlayerController->PlayerState);
+		break;
+
+	case EGCFVerbMessageRelevancy::Participants:
+		Receiver.bIsParticipant = (PlayerController == GetPlayerControllerFromObject(Message.Instigator))
+			|| (PlayerController == GetPlayerControllerFromObject(Message.Target));
+		break;
+
+	case EGCFVerbMessageRelevancy::WithinRadius:
+		if (const AActor* ViewTarget = PlayerController->GetViewTarget())
+		{
+			Receiver.bHasViewLocation = true;
+			Receiver.ViewLocation = ViewTarget->GetActorLocation();
+		}
+		break;
+
+	default:
+		break;
+	}
+
+	return GCFVerbMessageHelpers::IsMessageRelevantToReceiver(Message, InstigatorTeamId, Receiver);
+}
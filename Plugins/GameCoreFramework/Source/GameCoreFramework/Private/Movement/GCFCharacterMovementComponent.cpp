@@ -9,10 +9,40 @@
 #include "Components/CapsuleComponent.h"
 #include "AbilitySystem/GCFAbilitySystemFunctionLibrary.h"
 #include "AbilitySystem/GCFAbilitySystemComponent.h"
+#include "Engine/World.h"
 
 namespace 
 {
 static float GroundTraceDistance = 100000.0f;
+
+static bool bAsyncGroundTrace = false;
+static FAutoConsoleVariableRef CVarAsyncGroundTrace(
+	TEXT("GCF.Character.AsyncGroundTrace"),
+	bAsyncGroundTrace,
+	TEXT("If true, airborne characters trace the ground asynchronously and use the previous frame's result.")
+);
+
+static int32 AsyncGroundTraceMaxStaleFrames = 2;
+static FAutoConsoleVariableRef CVarAsyncGroundTraceMaxStaleFrames(
+	TEXT("GCF.Character.AsyncGroundTraceMaxStaleFrames"),
+	AsyncGroundTraceMaxStaleFrames,
+	TEXT("Maximum age (frames) of an async ground trace result before GetGroundInfo falls back to a synchronous trace.\n")
+	TEXT("Results complete one frame after they are issued, so 0 never uses them and disables the async path.")
+);
+
+static float GroundTraceMinDistance = 1000.0f;
+static FAutoConsoleVariableRef CVarGroundTraceMinDistance(
+	TEXT("GCF.Character.GroundTraceMinDistance"),
+	GroundTraceMinDistance,
+	TEXT("Minimum length (cm) of the airborne ground trace below the capsule.")
+);
+
+static float GroundTraceLookAheadTime = 1.0f;
+static FAutoConsoleVariableRef CVarGroundTraceLookAheadTime(
+	TEXT("GCF.Character.GroundTraceLookAheadTime"),
+	GroundTraceLookAheadTime,
+	TEXT("Seconds of fall covered by the airborne ground trace. The trace length is the fall speed times this value, clamped to [GroundTraceMinDistance, 100000].")
+);
 }
 
 
@@ -77,28 +107,33 @@ const FGCFCharacterGroundInfo& UGCFCharacterMovementComponent::GetGroundInfo()
 		CachedGroundInfo.GroundHitResult = CurrentFloor.HitResult;
 		CachedGroundInfo.GroundDistance = 0.0f;
 	} else {
-		const UCapsuleComponent* CapsuleComp = CharacterOwner->GetCapsuleComponent();
-		check(CapsuleComp);
-
-		const float CapsuleHalfHeight = CapsuleComp->GetUnscaledCapsuleHalfHeight();
-		const ECollisionChannel CollisionChannel = (UpdatedComponent ? UpdatedComponent->GetCollisionObjectType() : ECC_Pawn);
-		const FVector TraceStart(GetActorLocation());
-		const FVector TraceEnd(TraceStart.X, TraceStart.Y, (TraceStart.Z - GroundTraceDistance - CapsuleHalfHeight));
-
-		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(GCFCharacterMovementComponent_GetGroundInfo), false, CharacterOwner);
-		FCollisionResponseParams ResponseParam;
-		InitCollisionParams(QueryParams, ResponseParam);
+		bool bUsedAsyncResult = false;
+
+		if (bAsyncGroundTrace && AsyncGroundTraceMaxStaleFrames > 0 && MovementMode != MOVE_NavWalking) {
+			// Consume the previous frame's result and queue the next trace for the end of this frame.
+			const uint64 MaxStaleFrames = (uint64)AsyncGroundTraceMaxStaleFrames;
+			const bool bHasRecentResult = AsyncGroundTraceFrame != 0 && (GFrameCounter - AsyncGroundTraceFrame) <= MaxStaleFrames;
+			RequestAsyncGroundTrace();
+
+			if (bHasRecentResult) {
+				const UCapsuleComponent* CapsuleComp = CharacterOwner->GetCapsuleComponent();
+				check(CapsuleComp);
+				SetGroundInfoFromTrace(AsyncGroundHit, AsyncGroundTraceStart, CapsuleComp->GetUnscaledCapsuleHalfHeight());
+				bUsedAsyncResult = true;
+			}
+		}
 
-		FHitResult HitResult;
-		GetWorld()->LineTraceSingleByChannel(HitResult, TraceStart, TraceEnd, CollisionChannel, QueryParams, ResponseParam);
+		if (!bUsedAsyncResult) {
+			FGroundTraceRequest Request;
+			BuildGroundTrace(Request);
 
-		CachedGroundInfo.GroundHitResult = HitResult;
-		CachedGroundInfo.GroundDistance = GroundTraceDistance;
+			FHitResult HitResult;
+			GetWorld()->LineTraceSingleByChannel(HitResult, Request.Start, Request.End, Request.CollisionChannel, Request.QueryParams, Request.ResponseParams);
+			SetGroundInfoFromTrace(HitResult, Request.Start, Request.CapsuleHalfHeight);
 
-		if (MovementMode == MOVE_NavWalking) {
-			CachedGroundInfo.GroundDistance = 0.0f;
-		} else if (HitResult.bBlockingHit) {
-			CachedGroundInfo.GroundDistance = FMath::Max((HitResult.Distance - CapsuleHalfHeight), 0.0f);
+			if (MovementMode == MOVE_NavWalking) {
+				CachedGroundInfo.GroundDistance = 0.0f;
+			}
 		}
 	}
 
@@ -108,6 +143,73 @@ const FGCFCharacterGroundInfo& UGCFCharacterMovementComponent::GetGroundInfo()
 }
 
 
+void UGCFCharacterMovementComponent::BuildGroundTrace(FGroundTraceRequest& OutRequest, bool bFixedLength) const
+{
+	const UCapsuleComponent* CapsuleComp = CharacterOwner->GetCapsuleComponent();
+	check(CapsuleComp);
+
+	// Only the distance the character can fall within the look-ahead time matters to consumers (landing anticipation).
+	const float FallSpeed = (float)FMath::Max(-Velocity.Z, 0.0);
+	const float TraceDistance = bFixedLength ? GroundTraceDistance : FMath::Clamp(FallSpeed * GroundTraceLookAheadTime, GroundTraceMinDistance, GroundTraceDistance);
+
+	OutRequest.CapsuleHalfHeight = CapsuleComp->GetUnscaledCapsuleHalfHeight();
+	OutRequest.CollisionChannel = (UpdatedComponent ? UpdatedComponent->GetCollisionObjectType() : ECC_Pawn);
+	OutRequest.Start = GetActorLocation();
+	OutRequest.End = FVector(OutRequest.Start.X, OutRequest.Start.Y, (OutRequest.Start.Z - TraceDistance - OutRequest.CapsuleHalfHeight));
+
+	OutRequest.QueryParams = FCollisionQueryParams(SCENE_QUERY_STAT(GCFCharacterMovementComponent_GetGroundInfo), false, CharacterOwner);
+	InitCollisionParams(OutRequest.QueryParams, OutRequest.ResponseParams);
+}
+
+
+void UGCFCharacterMovementComponent::SetGroundInfoFromTrace(const FHitResult& HitResult, const FVector& TraceStart, float CapsuleHalfHeight)
+{
+	// Vertical movement since the trace started (non-zero for async results).
+	const double HeightChange = GetActorLocation().Z - TraceStart.Z;
+
+	CachedGroundInfo.GroundHitResult = HitResult;
+
+	// Without a hit, report the same "no ground" sentinel regardless of how far the adaptive trace reached.
+	CachedGroundInfo.GroundDistance = GroundTraceDistance;
+
+	if (HitResult.bBlockingHit) {
+		CachedGroundInfo.GroundDistance = (float)FMath::Max((HitResult.Distance - CapsuleHalfHeight + HeightChange), 0.0);
+	}
+}
+
+
+void UGCFCharacterMovementComponent::RequestAsyncGroundTrace()
+{
+	UWorld* World = GetWorld();
+	if (World->IsTraceHandleValid(PendingGroundTraceHandle, false)) {
+		return;
+	}
+
+	if (!AsyncGroundTraceDelegate.IsBound()) {
+		AsyncGroundTraceDelegate.BindUObject(this, &ThisClass::HandleAsyncGroundTrace);
+	}
+
+	FGroundTraceRequest Request;
+	BuildGroundTrace(Request);
+	PendingGroundTraceHandle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Request.Start, Request.End, Request.CollisionChannel,
+															  Request.QueryParams, Request.ResponseParams, &AsyncGroundTraceDelegate);
+	PendingGroundTraceFrame = GFrameCounter;
+}
+
+
+void UGCFCharacterMovementComponent::HandleAsyncGroundTrace(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	if (!(TraceHandle == PendingGroundTraceHandle)) {
+		return;
+	}
+	PendingGroundTraceHandle = FTraceHandle();
+
+	AsyncGroundHit = TraceDatum.OutHits.Num() > 0 ? TraceDatum.OutHits[0] : FHitResult();
+	AsyncGroundTraceStart = TraceDatum.Start;
+	AsyncGroundTraceFrame = PendingGroundTraceFrame;
+}
+
+
 void UGCFCharacterMovementComponent::SetReplicatedAcceleration(const FVector& InAcceleration)
 {
 	bHasReplicatedAcceleration = true;
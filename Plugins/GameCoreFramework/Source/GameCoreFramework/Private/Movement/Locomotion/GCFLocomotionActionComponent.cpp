@@ -8,7 +8,9 @@
 #include "Components/GameFrameworkComponentManager.h"
 #include "Input/GCFInputConfigProvider.h"
 #include "Input/GCFInputComponent.h"
+#include "Input/GCFInputReplaySubsystem.h"
 #include "Movement/Locomotion/GCFLocomotionInputHandler.h"
+#include "System/GCFInputLatencyTracker.h"
 
 
 UGCFLocomotionActionComponent::UGCFLocomotionActionComponent(const FObjectInitializer& ObjectInitializer)
@@ -81,8 +83,18 @@ TArray<FGCFBindingReceipt> UGCFLocomotionActionComponent::HandleInputBinding(UGC
 
 void UGCFLocomotionActionComponent::Input_Jump(const FInputActionValue& InputActionValue)
 {
+	if (UGCFInputReplaySubsystem::IsReplayActive(this)) {
+		return;
+	}
+
 	if (APawn* Pawn = GetPawn<APawn>()) {
 		if (Pawn->Implements<UGCFLocomotionInputHandler>()) {
+			if (InputActionValue.Get<bool>()) {
+				FGCFInputLatencyTracker::MarkLocomotionInput(Pawn);
+			}
+			if (UGCFInputReplaySubsystem* Recorder = UGCFInputReplaySubsystem::GetActiveRecorder(this)) {
+				Recorder->RecordJumpInput(InputActionValue.Get<bool>());
+			}
 			IGCFLocomotionInputHandler::Execute_HandleJumpInput(Pawn, InputActionValue.Get<bool>());
 		}
 	}
@@ -91,8 +103,15 @@ void UGCFLocomotionActionComponent::Input_Jump(const FInputActionValue& InputAct
 
 void UGCFLocomotionActionComponent::Input_Crouch(const FInputActionValue& InputActionValue)
 {
+	if (UGCFInputReplaySubsystem::IsReplayActive(this)) {
+		return;
+	}
+
 	if (APawn* Pawn = GetPawn<APawn>()) {
 		if (Pawn->Implements<UGCFLocomotionInputHandler>()) {
+			if (UGCFInputReplaySubsystem* Recorder = UGCFInputReplaySubsystem::GetActiveRecorder(this)) {
+				Recorder->RecordCrouchInput(InputActionValue.Get<bool>());
+			}
 			IGCFLocomotionInputHandler::Execute_HandleCrouchInput(Pawn, InputActionValue.Get<bool>());
 		}
 	}
@@ -9,6 +9,9 @@
 #include "Input/GCFInputConfigProvider.h"
 #include "Input/GCFInputConfig.h"
 #include "Input/GCFInputComponent.h"
+#include "Input/GCFInputReplaySubsystem.h"
+#include "Movement/Mover/GCFMoverBenchmarkSubsystem.h"
+#include "System/GCFInputLatencyTracker.h"
 
 
 UGCFLocomotionDirectionComponent::UGCFLocomotionDirectionComponent(const FObjectInitializer& ObjectInitializer)
@@ -82,16 +85,23 @@ TArray<FGCFBindingReceipt> UGCFLocomotionDirectionComponent::HandleInputBinding(
 
 void UGCFLocomotionDirectionComponent::Input_Move(const FInputActionValue& Value)
 {
-	if (AController* Controller = GetController<AController>()) {
+	GCF_MOVER_BENCHMARK_SCOPE(this, ConvertInput);
 
-		// Determine the rotation basis for movement (Camera, World, or Pawn relative)
-		const FRotator MovementRotation = CalcMovementRotation(Controller);
-		const FVector2D MovementVector = Value.Get<FVector2D>();
+	if (UGCFInputReplaySubsystem::IsReplayActive(this)) {
+		return;
+	}
 
-		if (APawn* Pawn = GetPawn<APawn>()) {
-			if (Pawn->Implements<UGCFLocomotionInputHandler>()) {
-				IGCFLocomotionInputHandler::Execute_HandleMoveInput(Pawn, MovementVector, MovementRotation);
+	if (APawn* Pawn = GetPawn<APawn>()) {
+		if (Pawn->Implements<UGCFLocomotionInputHandler>()) {
+			// Determine the rotation basis for movement (Camera, World, or Pawn relative)
+			const FRotator MovementRotation = CalcMovementRotation(GetController<AController>());
+			const FVector2D MovementVector = Value.Get<FVector2D>();
+
+			FGCFInputLatencyTracker::MarkLocomotionInput(Pawn);
+			if (UGCFInputReplaySubsystem* Recorder = UGCFInputReplaySubsystem::GetActiveRecorder(this)) {
+				Recorder->RecordMoveInput(MovementVector, MovementRotation);
 			}
+			IGCFLocomotionInputHandler::Execute_HandleMoveInput(Pawn, MovementVector, MovementRotation);
 		}
 	}
 }
@@ -103,9 +113,16 @@ void UGCFLocomotionDirectionComponent::Input_Move(const FInputActionValue& Value
  */
 void UGCFLocomotionDirectionComponent::Input_Move_Completed(const FInputActionValue& Value)
 {
+	if (UGCFInputReplaySubsystem::IsReplayActive(this)) {
+		return;
+	}
+
 	if (AController* Controller = GetController<AController>()) {
 		if (APawn* Pawn = GetPawn<APawn>()) {
 			if (Pawn->Implements<UGCFLocomotionInputHandler>()) {
+				if (UGCFInputReplaySubsystem* Recorder = UGCFInputReplaySubsystem::GetActiveRecorder(this)) {
+					Recorder->RecordMoveInput(FVector2D::ZeroVector, Controller->GetControlRotation());
+				}
 				IGCFLocomotionInputHandler::Execute_HandleMoveInput(Pawn, FVector2D::ZeroVector, Controller->GetControlRotation());
 			}
 		}
@@ -115,10 +132,17 @@ void UGCFLocomotionDirectionComponent::Input_Move_Completed(const FInputActionVa
 
 void UGCFLocomotionDirectionComponent::Input_MoveUp(const FInputActionValue& Value)
 {
+	if (UGCFInputReplaySubsystem::IsReplayActive(this)) {
+		return;
+	}
+
 	const float UpValue = Value.Get<float>();
 
 	if (APawn* Pawn = GetPawn<APawn>()) {
 		if (Pawn->Implements<UGCFLocomotionInputHandler>()) {
+			if (UGCFInputReplaySubsystem* Recorder = UGCFInputReplaySubsystem::GetActiveRecorder(this)) {
+				Recorder->RecordMoveUpInput(UpValue);
+			}
 			IGCFLocomotionInputHandler::Execute_HandleMoveUpInput(Pawn, UpValue);
 		}
 	}
@@ -131,8 +155,15 @@ void UGCFLocomotionDirectionComponent::Input_MoveUp(const FInputActionValue& Val
  */
 void UGCFLocomotionDirectionComponent::Input_MoveUp_Completed(const FInputActionValue& Value)
 {
+	if (UGCFInputReplaySubsystem::IsReplayActive(this)) {
+		return;
+	}
+
 	if (APawn* Pawn = GetPawn<APawn>()) {
 		if (Pawn->Implements<UGCFLocomotionInputHandler>()) {
+			if (UGCFInputReplaySubsystem* Recorder = UGCFInputReplaySubsystem::GetActiveRecorder(this)) {
+				Recorder->RecordMoveUpInput(0.0f);
+			}
 			IGCFLocomotionInputHandler::Execute_HandleMoveUpInput(Pawn, 0.0f);
 		}
 	}
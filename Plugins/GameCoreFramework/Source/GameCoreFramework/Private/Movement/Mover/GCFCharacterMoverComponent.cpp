@@ -3,8 +3,48 @@
 
 #include "Movement/Mover/GCFCharacterMoverComponent.h"
 #include "Movement/GCFMovementConfig.h"
+#include "Movement/Mover/GCFMoverLODSubsystem.h"
+#include "Movement/Mover/GCFMoverSettingsSubsystem.h"
 #include "Movement/Mover/Input/GCFHumanoidInputs.h"
 #include "DefaultMovementSet/Settings/CommonLegacyMovementSettings.h"
+#include "Engine/World.h"
+
+
+UGCFCharacterMoverComponent::UGCFCharacterMoverComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+}
+
+
+void UGCFCharacterMoverComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (UGCFMoverLODSubsystem* LODSubsystem = UGCFMoverLODSubsystem::Get(this)) {
+		LODSubsystem->RegisterMoverComponent(this);
+	}
+}
+
+
+void UGCFCharacterMoverComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UGCFMoverLODSubsystem* LODSubsystem = UGCFMoverLODSubsystem::Get(this)) {
+		LODSubsystem->UnregisterMoverComponent(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+
+void UGCFCharacterMoverComponent::FinalizeFrame(const FMoverSyncState* SyncState, const FMoverAuxStateContext* AuxState)
+{
+	Super::FinalizeFrame(SyncState, AuxState);
+
+	// Only pawns whose anim instance reads the snapshot pay for the capture.
+	if (AnimSnapshotBuffer.HasReaders()) {
+		AnimSnapshotBuffer.Publish(*this, GetWorld()->GetDeltaSeconds());
+	}
+}
 
 
 void UGCFCharacterMoverComponent::ApplyMovementConfig_Implementation(const UGCFMovementConfig* Config)
@@ -13,8 +53,12 @@ void UGCFCharacterMoverComponent::ApplyMovementConfig_Implementation(const UGCFM
 		return;
 	}
 
-	// TODO: If this logic needs to be shared across multiple Mover derived classes in the future, 
-	// consider extracting it into a separate handler component or function library.
+	// Pawns with identical configs share one immutable settings instance.
+	if (UGCFMoverSettingsSubsystem* SettingsSubsystem = UGCFMoverSettingsSubsystem::Get(this)) {
+		SettingsSubsystem->ApplyMovementConfig(this, SharedSettings, Config);
+		return;
+	}
+
 	if (UCommonLegacyMovementSettings* LegacyMovementSettings = FindSharedSettings_Mutable<UCommonLegacyMovementSettings>()) {
 
 		// Inject the data-driven config values into Mover's shared settings
@@ -25,17 +69,26 @@ void UGCFCharacterMoverComponent::ApplyMovementConfig_Implementation(const UGCFM
 }
 
 
+UCommonLegacyMovementSettings* UGCFCharacterMoverComponent::GetMutableLegacyMovementSettings()
+{
+	if (UGCFMoverSettingsSubsystem* SettingsSubsystem = UGCFMoverSettingsSubsystem::Get(this)) {
+		return SettingsSubsystem->MakeSettingsPrivate(this, SharedSettings);
+	}
+	return FindSharedSettings_Mutable<UCommonLegacyMovementSettings>();
+}
+
+
 void UGCFCharacterMoverComponent::OnMoverPreSimulationTick(const FMoverTimeStep& TimeStep, const FMoverInputCmdContext& InputCmd)
 {
-	if (const FGCFHumanoidInputs* HumanoidInputs = InputCmd.InputCollection.FindDataByType<FGCFHumanoidInputs>()) {
+	// Pawns driven by a non-humanoid producer have no humanoid inputs and never crouch.
+	const FGCFHumanoidInputs* HumanoidInputs = InputCmd.InputCollection.FindDataByType<FGCFHumanoidInputs>();
 
-		const bool bIsAirborne = HasGameplayTag(Mover_IsFalling, true);
-		if (bIsAirborne) {
-			bWantsToCrouch = false;
-		} else {
-			bWantsToCrouch = HumanoidInputs->bWantsToCrouch;
-		}
+	const bool bIsAirborne = HasGameplayTag(Mover_IsFalling, true);
+	if (bIsAirborne || !HumanoidInputs) {
+		bWantsToCrouch = false;
+	} else {
+		bWantsToCrouch = HumanoidInputs->bWantsToCrouch;
 	}
 
 	Super::OnMoverPreSimulationTick(TimeStep, InputCmd);
-}
\ No newline at end of file
+}
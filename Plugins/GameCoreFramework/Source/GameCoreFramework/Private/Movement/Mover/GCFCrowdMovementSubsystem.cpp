@@ -0,0 +1,267 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Movement/Mover/GCFCrowdMovementSubsystem.h"
+
+#include "MoverComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GCFCrowdMovementSubsystem)
+
+
+namespace GCF::CrowdMovement
+{
+static bool bEnable = false;
+static FAutoConsoleVariableRef CVarEnable(
+	TEXT("GCF.Mover.Crowd.Enable"),
+	bEnable,
+	TEXT("If true, pawns using the GCF crowd walking mode move on batched floor probes instead of per-pawn floor sweeps.")
+);
+
+static float ProbeDepth = 60.0f;
+static FAutoConsoleVariableRef CVarProbeDepth(
+	TEXT("GCF.Mover.Crowd.ProbeDepth"),
+	ProbeDepth,
+	TEXT("Distance (cm) below the bottom of a crowd pawn's collision that the batched floor probe reaches.")
+);
+
+static float MaxProbeOffset = 5.0f;
+static FAutoConsoleVariableRef CVarMaxProbeOffset(
+	TEXT("GCF.Mover.Crowd.MaxProbeOffset"),
+	MaxProbeOffset,
+	TEXT("Horizontal distance (cm) a crowd step may end away from where its floor probe was cast and still use that floor. Farther steps run the standard floor check.")
+);
+}
+
+
+UGCFCrowdMovementSubsystem* UGCFCrowdMovementSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr) {
+		return World->GetSubsystem<UGCFCrowdMovementSubsystem>();
+	}
+	return nullptr;
+}
+
+
+bool UGCFCrowdMovementSubsystem::IsBatchingEnabled()
+{
+	return GCF::CrowdMovement::bEnable;
+}
+
+
+float UGCFCrowdMovementSubsystem::GetMaxProbeOffset()
+{
+	return GCF::CrowdMovement::MaxProbeOffset;
+}
+
+
+bool UGCFCrowdMovementSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+
+void UGCFCrowdMovementSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PreActorTickHandle = FWorldDelegates::OnWorldPreActorTick.AddUObject(this, &ThisClass::HandlePreActorTick);
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &ThisClass::HandlePostActorTick);
+}
+
+
+void UGCFCrowdMovementSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldPreActorTick.Remove(PreActorTickHandle);
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+	PreActorTickHandle.Reset();
+	PostActorTickHandle.Reset();
+
+	SlotIndices.Empty();
+	Movers.Empty();
+	Locations.Empty();
+	Velocities.Empty();
+	HalfHeights.Empty();
+	ProbeLocations.Empty();
+	PendingProbes.Empty();
+	PendingFloors.Empty();
+	Floors.Empty();
+
+	Super::Deinitialize();
+}
+
+
+void UGCFCrowdMovementSubsystem::RegisterCrowdMover(UMoverComponent* MoverComponent)
+{
+	if (!MoverComponent || SlotIndices.Contains(MoverComponent)) {
+		return;
+	}
+
+	SlotIndices.Add(MoverComponent, Movers.Num());
+	Movers.Add(MoverComponent);
+	Locations.AddZeroed();
+	Velocities.AddZeroed();
+	HalfHeights.AddZeroed();
+	ProbeLocations.AddZeroed();
+	PendingProbes.AddDefaulted();
+	PendingFloors.AddDefaulted();
+	Floors.AddDefaulted();
+}
+
+
+void UGCFCrowdMovementSubsystem::UnregisterCrowdMover(UMoverComponent* MoverComponent)
+{
+	if (const int32* Index = SlotIndices.Find(MoverComponent)) {
+		RemoveSlot(*Index);
+	}
+}
+
+
+void UGCFCrowdMovementSubsystem::RemoveSlot(int32 Index)
+{
+	const int32 LastIndex = Movers.Num() - 1;
+
+	SlotIndices.Remove(Movers[Index]);
+	if (Index != LastIndex) {
+		SlotIndices.Add(Movers[LastIndex], Index);
+	}
+
+	Movers.RemoveAtSwap(Index, EAllowShrinking::No);
+	Locations.RemoveAtSwap(Index, EAllowShrinking::No);
+	Velocities.RemoveAtSwap(Index, EAllowShrinking::No);
+	HalfHeights.RemoveAtSwap(Index, EAllowShrinking::No);
+	ProbeLocations.RemoveAtSwap(Index, EAllowShrinking::No);
+	PendingProbes.RemoveAtSwap(Index, EAllowShrinking::No);
+	PendingFloors.RemoveAtSwap(Index, EAllowShrinking::No);
+	Floors.RemoveAtSwap(Index, EAllowShrinking::No);
+}
+
+
+const FGCFCrowdFloor* UGCFCrowdMovementSubsystem::FindFloor(const UMoverComponent* MoverComponent) const
+{
+	const int32* Index = SlotIndices.Find(MoverComponent);
+	if (!Index || Floors[*Index].Frame == 0) {
+		return nullptr;
+	}
+	return &Floors[*Index];
+}
+
+
+void UGCFCrowdMovementSubsystem::HandlePreActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (InWorld != GetWorld()) {
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_GCFCrowdMovement_CollectProbes);
+
+	// Probes issued on the previous frame have completed by now. Collecting them before the Mover components tick
+	// keeps every floor exactly one frame old when it is used.
+	CollectFloorProbes(*InWorld);
+}
+
+
+void UGCFCrowdMovementSubsystem::HandlePostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (InWorld != GetWorld()) {
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_GCFCrowdMovement_IssueProbes);
+
+	if (GCF::CrowdMovement::bEnable && !Movers.IsEmpty()) {
+		IssueFloorProbes(*InWorld, DeltaSeconds);
+	}
+}
+
+
+void UGCFCrowdMovementSubsystem::CollectFloorProbes(UWorld& World)
+{
+	for (int32 Index = 0; Index < Movers.Num(); ++Index) {
+		FTraceHandle& Handle = PendingProbes[Index];
+		if (!Handle.IsValid()) {
+			continue;
+		}
+
+		FTraceDatum Datum;
+		if (World.QueryTraceData(Handle, Datum)) {
+			FGCFCrowdFloor& Floor = Floors[Index];
+			Floor = PendingFloors[Index];
+			if (const FHitResult* Hit = FHitResult::GetFirstBlockingHit(Datum.OutHits)) {
+				Floor.Hit = *Hit;
+				Floor.bBlockingHit = true;
+			} else {
+				Floor.Hit = FHitResult();
+				Floor.bBlockingHit = false;
+			}
+		}
+		Handle.Invalidate();
+	}
+
+	// Solve every floor plane for the resting capsule center height in one pass, so a crowd step only evaluates it.
+	// Pawns without a floor get a finite plane; the crowd mode never reads it.
+	for (FGCFCrowdFloor& Floor : Floors) {
+		const FVector& Normal = Floor.Hit.ImpactNormal;
+		const FVector& Point = Floor.Hit.ImpactPoint;
+		const double InvNormalZ = 1.0 / FMath::Max(Normal.Z, UE_KINDA_SMALL_NUMBER);
+		Floor.SlopeX = -Normal.X * InvNormalZ;
+		Floor.SlopeY = -Normal.Y * InvNormalZ;
+		Floor.CenterHeight = Point.Z - Floor.SlopeX * Point.X - Floor.SlopeY * Point.Y + Floor.HalfHeight + FGCFCrowdFloor::FloorDistance;
+	}
+}
+
+
+void UGCFCrowdMovementSubsystem::IssueFloorProbes(UWorld& World, float DeltaSeconds)
+{
+	// Gather, dropping pawns destroyed without unregistering.
+	for (int32 Index = Movers.Num() - 1; Index >= 0; --Index) {
+		const UMoverComponent* MoverComponent = Movers[Index].Get();
+		const USceneComponent* UpdatedComponent = MoverComponent ? MoverComponent->GetUpdatedComponent() : nullptr;
+		if (!UpdatedComponent) {
+			RemoveSlot(Index);
+			continue;
+		}
+
+		Locations[Index] = UpdatedComponent->GetComponentLocation();
+		Velocities[Index] = MoverComponent->GetVelocity();
+		if (const UCapsuleComponent* Capsule = Cast<UCapsuleComponent>(UpdatedComponent)) {
+			HalfHeights[Index] = Capsule->GetScaledCapsuleHalfHeight();
+		} else {
+			HalfHeights[Index] = UpdatedComponent->Bounds.BoxExtent.Z;
+		}
+	}
+
+	// Extrapolate one frame ahead in a single pass over contiguous arrays; the loop is branch-free so it vectorizes.
+	const int32 Count = Movers.Num();
+	const FVector* RESTRICT LocationData = Locations.GetData();
+	const FVector* RESTRICT VelocityData = Velocities.GetData();
+	FVector* RESTRICT ProbeData = ProbeLocations.GetData();
+	for (int32 Index = 0; Index < Count; ++Index) {
+		ProbeData[Index] = LocationData[Index] + VelocityData[Index] * DeltaSeconds;
+	}
+
+	const uint64 Frame = GFrameCounter;
+	for (int32 Index = 0; Index < Count; ++Index) {
+		const UMoverComponent* MoverComponent = Movers[Index].Get();
+		UPrimitiveComponent* UpdatedPrimitive = Cast<UPrimitiveComponent>(MoverComponent->GetUpdatedComponent());
+		if (!UpdatedPrimitive) {
+			continue;
+		}
+
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(GCFCrowdFloorProbe), false, MoverComponent->GetOwner());
+		FCollisionResponseParams ResponseParams;
+		UpdatedPrimitive->InitSweepCollisionParams(QueryParams, ResponseParams);
+
+		const FVector Start = ProbeLocations[Index];
+		const FVector End = Start - FVector::UpVector * (HalfHeights[Index] + GCF::CrowdMovement::ProbeDepth);
+		PendingProbes[Index] = World.AsyncLineTraceByChannel(EAsyncTraceType::Single, Start, End, UpdatedPrimitive->GetCollisionObjectType(), QueryParams, ResponseParams);
+
+		FGCFCrowdFloor& PendingFloor = PendingFloors[Index];
+		PendingFloor.ProbeLocation = Start;
+		PendingFloor.HalfHeight = HalfHeights[Index];
+		PendingFloor.Frame = Frame;
+	}
+}
+
@@ -0,0 +1,394 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Movement/Mover/GCFMoverBenchmarkSubsystem.h"
+
+#include "GCFShared.h"
+#include "AIController.h"
+#include "CoreGlobals.h"
+#include "EngineUtils.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerStart.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Actor/Avatar/GCFAvatarPawn.h"
+#include "Actor/Humanoid/GCFHumanoid.h"
+#include "InputActionValue.h"
+#include "Movement/Locomotion/GCFLocomotionDirectionComponent.h"
+#include "Movement/Locomotion/GCFLocomotionInputHandler.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GCFMoverBenchmarkSubsystem)
+
+
+#if !UE_BUILD_SHIPPING
+namespace GCF::MoverBenchmark
+{
+bool bSampling = false;
+
+struct FSample
+{
+	uint64 Cycles = 0;
+	int32 Calls = 0;
+};
+
+/** Samples keyed by (component, producer or mode class, phase). */
+static TMap<TPair<const UClass*, EGCFMoverBenchmarkPhase>, FSample> Samples;
+
+void AddSample(const UClass* Category, EGCFMoverBenchmarkPhase Phase, uint64 Cycles)
+{
+	FSample& Sample = Samples.FindOrAdd(TPair<const UClass*, EGCFMoverBenchmarkPhase>(Category, Phase));
+	Sample.Cycles += Cycles;
+	++Sample.Calls;
+}
+
+static const TCHAR* GetPhaseName(EGCFMoverBenchmarkPhase Phase)
+{
+	switch (Phase) {
+		case EGCFMoverBenchmarkPhase::ConvertInput: return TEXT("ConvertInput");
+		case EGCFMoverBenchmarkPhase::ProduceInput: return TEXT("ProduceInput");
+		case EGCFMoverBenchmarkPhase::GenerateMove: return TEXT("GenerateMove");
+		case EGCFMoverBenchmarkPhase::SimulationTick: return TEXT("SimulationTick");
+	}
+	return TEXT("Unknown");
+}
+
+static FString GetCategoryName(const UClass* Category)
+{
+	return Category ? Category->GetName() : FString(TEXT("None"));
+}
+
+static FAutoConsoleCommandWithWorldAndArgs CmdBenchmark(
+	TEXT("GCF.Mover.Benchmark"),
+	TEXT("Spawns scripted Mover pawns, measures the movement stack for a fixed number of frames and writes Saved/GCFBenchmark/<Csv>.csv. ")
+	TEXT("Usage: GCF.Mover.Benchmark [Class=Humanoid|Avatar|/Path.Class_C] [Count=100] [Frames=600] [Warmup=60] [Spacing=300] [Script=Idle|Walk|Mixed] [Csv=Name]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World) {
+		if (UGCFMoverBenchmarkSubsystem* Subsystem = UGCFMoverBenchmarkSubsystem::Get(World)) {
+			Subsystem->StartBenchmark(FString::Join(Args, TEXT(" ")));
+		}
+	})
+);
+
+static FAutoConsoleCommandWithWorld CmdCancel(
+	TEXT("GCF.Mover.Benchmark.Cancel"),
+	TEXT("Stops the running Mover benchmark and destroys its pawns."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World) {
+		if (UGCFMoverBenchmarkSubsystem* Subsystem = UGCFMoverBenchmarkSubsystem::Get(World)) {
+			Subsystem->CancelBenchmark();
+		}
+	})
+);
+}
+#endif
+
+
+UGCFMoverBenchmarkSubsystem* UGCFMoverBenchmarkSubsystem::Get(const UObject* WorldContextObject)
+{
+#if !UE_BUILD_SHIPPING
+	if (UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr) {
+		return World->GetSubsystem<UGCFMoverBenchmarkSubsystem>();
+	}
+#endif
+	return nullptr;
+}
+
+
+bool UGCFMoverBenchmarkSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if UE_BUILD_SHIPPING
+	return false;
+#else
+	return Super::ShouldCreateSubsystem(Outer);
+#endif
+}
+
+
+void UGCFMoverBenchmarkSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+#if !UE_BUILD_SHIPPING
+	FString Options;
+	if (InWorld.IsGameWorld() && FParse::Value(FCommandLine::Get(), TEXT("GCFMoverBenchmark="), Options, false)) {
+		bExitWhenFinished = StartBenchmark(Options);
+	}
+#endif
+}
+
+
+void UGCFMoverBenchmarkSubsystem::Deinitialize()
+{
+	CancelBenchmark();
+
+	Super::Deinitialize();
+}
+
+
+bool UGCFMoverBenchmarkSubsystem::StartBenchmark(const FString& Options)
+{
+#if !UE_BUILD_SHIPPING
+	UWorld* World = GetWorld();
+	if (!World || PreActorTickHandle.IsValid()) {
+		UE_LOG(LogGCFCharacter, Warning, TEXT("GCF.Mover.Benchmark: A benchmark is already running."));
+		return false;
+	}
+
+	FString ClassName = TEXT("Humanoid");
+	FParse::Value(*Options, TEXT("Class="), ClassName);
+	if (ClassName == TEXT("Humanoid")) {
+		PawnClass = AGCFHumanoid::StaticClass();
+	} else if (ClassName == TEXT("Avatar")) {
+		PawnClass = AGCFAvatarPawn::StaticClass();
+	} else {
+		PawnClass = LoadClass<APawn>(nullptr, *ClassName);
+	}
+	if (!PawnClass) {
+		UE_LOG(LogGCFCharacter, Error, TEXT("GCF.Mover.Benchmark: Unknown pawn class '%s'."), *ClassName);
+		return false;
+	}
+
+	PawnCount = 100;
+	MeasuredFrames = 600;
+	WarmupFrames = 60;
+	Spacing = 300.0f;
+	FParse::Value(*Options, TEXT("Count="), PawnCount);
+	FParse::Value(*Options, TEXT("Frames="), MeasuredFrames);
+	FParse::Value(*Options, TEXT("Warmup="), WarmupFrames);
+	FParse::Value(*Options, TEXT("Spacing="), Spacing);
+	PawnCount = FMath::Max(1, PawnCount);
+	MeasuredFrames = FMath::Max(1, MeasuredFrames);
+	WarmupFrames = FMath::Max(0, WarmupFrames);
+
+	FString ScriptName = TEXT("Walk");
+	FParse::Value(*Options, TEXT("Script="), ScriptName);
+	Script = ScriptName == TEXT("Idle") ? EScript::Idle : (ScriptName == TEXT("Mixed") ? EScript::Mixed : EScript::Walk);
+
+	CsvName = FString::Printf(TEXT("MoverBenchmark_%s"), *FDateTime::Now().ToString());
+	FParse::Value(*Options, TEXT("Csv="), CsvName);
+
+	GCF::MoverBenchmark::Samples.Reset();
+	LastCsvPath.Reset();
+	GameThreadMilliseconds = 0.0;
+	SampledFrames = 0;
+	Frame = 0;
+
+	SpawnPawns();
+	PreActorTickHandle = FWorldDelegates::OnWorldPreActorTick.AddUObject(this, &ThisClass::HandlePreActorTick);
+
+	UE_LOG(LogGCFCharacter, Display, TEXT("GCF.Mover.Benchmark: %d x %s, script %s, %d warm-up + %d measured frames."),
+		   Pawns.Num(), *PawnClass->GetName(), *ScriptName, WarmupFrames, MeasuredFrames);
+	return true;
+#else
+	return false;
+#endif
+}
+
+
+bool UGCFMoverBenchmarkSubsystem::IsRunning() const
+{
+#if !UE_BUILD_SHIPPING
+	return PreActorTickHandle.IsValid();
+#else
+	return false;
+#endif
+}
+
+
+void UGCFMoverBenchmarkSubsystem::CancelBenchmark()
+{
+#if !UE_BUILD_SHIPPING
+	if (!PreActorTickHandle.IsValid()) {
+		return;
+	}
+
+	FWorldDelegates::OnWorldPreActorTick.Remove(PreActorTickHandle);
+	PreActorTickHandle.Reset();
+	GCF::MoverBenchmark::bSampling = false;
+	GCF::MoverBenchmark::Samples.Reset();
+	DestroyPawns();
+#endif
+}
+
+
+#if !UE_BUILD_SHIPPING
+void UGCFMoverBenchmarkSubsystem::SpawnPawns()
+{
+	UWorld* World = GetWorld();
+
+	FTransform Origin = FTransform::Identity;
+	for (TActorIterator<APlayerStart> It(World); It; ++It) {
+		Origin = It->GetActorTransform();
+		break;
+	}
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	// Square grid centered on the origin.
+	const int32 Columns = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(PawnCount)));
+	const FVector GridOffset(-0.5f * (Columns - 1) * Spacing, -0.5f * (Columns - 1) * Spacing, 0.0f);
+
+	Pawns.Reset(PawnCount);
+	Controllers.Reset(PawnCount);
+	DirectionComponents.Reset(PawnCount);
+	for (int32 Index = 0; Index < PawnCount; ++Index) {
+		const FVector LocalLocation = GridOffset + FVector((Index / Columns) * Spacing, (Index % Columns) * Spacing, 0.0f);
+		const FTransform SpawnTransform(Origin.GetRotation(), Origin.TransformPosition(LocalLocation));
+
+		APawn* Pawn = World->SpawnActor<APawn>(PawnClass, SpawnTransform, SpawnParameters);
+		if (!Pawn) {
+			continue;
+		}
+
+		// A local controller makes the pawn's input producer run, as it does for any server-side NPC.
+		AAIController* Controller = World->SpawnActor<AAIController>(SpawnParameters);
+		if (Controller) {
+			Controller->Possess(Pawn);
+			Controllers.Add(Controller);
+
+			// Move input is converted by the same component a player controller uses. It binds no input here.
+			UGCFLocomotionDirectionComponent* DirectionComponent = NewObject<UGCFLocomotionDirectionComponent>(Controller);
+			DirectionComponent->RegisterComponent();
+			DirectionComponents.Add(DirectionComponent);
+		} else {
+			DirectionComponents.Add(nullptr);
+		}
+		Pawns.Add(Pawn);
+	}
+}
+
+
+void UGCFMoverBenchmarkSubsystem::DriveScript()
+{
+	if (Script == EScript::Idle) {
+		return;
+	}
+
+	for (int32 Index = 0; Index < Pawns.Num(); ++Index) {
+		APawn* Pawn = Pawns[Index].Get();
+		if (!Pawn || !Pawn->Implements<UGCFLocomotionInputHandler>()) {
+			continue;
+		}
+
+		// Each pawn walks a slow circle with its own phase, so the crowd spreads instead of colliding.
+		// The direction component turns the forward input into a world direction from the control rotation.
+		const float Yaw = FMath::Fmod(Frame * 0.5f + Index * 37.0f, 360.0f);
+		UGCFLocomotionDirectionComponent* DirectionComponent = DirectionComponents[Index].Get();
+		if (AController* Controller = DirectionComponent ? Pawn->GetController() : nullptr) {
+			Controller->SetControlRotation(FRotator(0.0f, Yaw, 0.0f));
+			DirectionComponent->Input_Move(FInputActionValue(FVector2D(1.0, 0.0)));
+		} else {
+			IGCFLocomotionInputHandler::Execute_HandleMoveInput(Pawn, FVector2D(1.0, 0.0), FRotator(0.0f, Yaw, 0.0f));
+		}
+
+		if (Script == EScript::Mixed) {
+			// Staggered jumps every 2 s and crouch phases every 5 s (at 60 Hz), held for one and for 60 frames.
+			const int32 PawnFrame = Frame + Index * 7;
+			IGCFLocomotionInputHandler::Execute_HandleJumpInput(Pawn, PawnFrame % 120 == 0);
+			IGCFLocomotionInputHandler::Execute_HandleCrouchInput(Pawn, PawnFrame % 300 < 60);
+		}
+	}
+}
+
+
+void UGCFMoverBenchmarkSubsystem::HandlePreActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (InWorld != GetWorld()) {
+		return;
+	}
+
+	// GGameThreadTime holds the game thread time of the previous, fully completed frame.
+	if (GCF::MoverBenchmark::bSampling) {
+		GameThreadMilliseconds += FPlatformTime::ToMilliseconds(GGameThreadTime);
+		++SampledFrames;
+	}
+
+	if (Frame >= WarmupFrames + MeasuredFrames) {
+		FinishBenchmark();
+		return;
+	}
+
+	GCF::MoverBenchmark::bSampling = Frame >= WarmupFrames;
+	DriveScript();
+	++Frame;
+}
+
+
+void UGCFMoverBenchmarkSubsystem::FinishBenchmark()
+{
+	FWorldDelegates::OnWorldPreActorTick.Remove(PreActorTickHandle);
+	PreActorTickHandle.Reset();
+	GCF::MoverBenchmark::bSampling = false;
+
+	const int32 LivePawns = Pawns.FilterByPredicate([](const TWeakObjectPtr<APawn>& Pawn) { return Pawn.IsValid(); }).Num();
+	const double AverageFrameMilliseconds = SampledFrames > 0 ? GameThreadMilliseconds / SampledFrames : 0.0;
+	UE_LOG(LogGCFCharacter, Display, TEXT("GCF.Mover.Benchmark: %d pawns, %d frames. Game thread %.3f ms/frame, %.3f us/pawn."),
+		   LivePawns, SampledFrames, AverageFrameMilliseconds, LivePawns > 0 ? AverageFrameMilliseconds * 1000.0 / LivePawns : 0.0);
+
+	for (const TPair<TPair<const UClass*, EGCFMoverBenchmarkPhase>, GCF::MoverBenchmark::FSample>& Pair : GCF::MoverBenchmark::Samples) {
+		const double TotalMilliseconds = FPlatformTime::ToMilliseconds64(Pair.Value.Cycles);
+		UE_LOG(LogGCFCharacter, Display, TEXT(" - %-32s %-14s %8d calls, %.3f us/call"),
+			   *GCF::MoverBenchmark::GetCategoryName(Pair.Key.Key), GCF::MoverBenchmark::GetPhaseName(Pair.Key.Value), Pair.Value.Calls,
+			   Pair.Value.Calls > 0 ? TotalMilliseconds * 1000.0 / Pair.Value.Calls : 0.0);
+	}
+
+	const FString Path = FPaths::ProjectSavedDir() / TEXT("GCFBenchmark") / (CsvName + TEXT(".csv"));
+	if (WriteCsv(Path)) {
+		LastCsvPath = Path;
+		UE_LOG(LogGCFCharacter, Display, TEXT("GCF.Mover.Benchmark: Wrote %s."), *Path);
+	} else {
+		UE_LOG(LogGCFCharacter, Error, TEXT("GCF.Mover.Benchmark: Failed to write %s."), *Path);
+	}
+
+	GCF::MoverBenchmark::Samples.Reset();
+	DestroyPawns();
+
+	if (bExitWhenFinished) {
+		FPlatformMisc::RequestExit(false, TEXT("GCF.Mover.Benchmark"));
+	}
+}
+
+
+bool UGCFMoverBenchmarkSubsystem::WriteCsv(const FString& Path) const
+{
+	const FString PawnClassName = PawnClass ? PawnClass->GetName() : FString();
+	const int32 LivePawns = Pawns.FilterByPredicate([](const TWeakObjectPtr<APawn>& Pawn) { return Pawn.IsValid(); }).Num();
+	const int32 PawnFrames = FMath::Max(1, LivePawns * SampledFrames);
+
+	// One row per measurement; the run parameters are repeated on each row so files can be concatenated.
+	FString Csv = TEXT("PawnClass,Pawns,Frames,Category,Phase,Calls,TotalMs,UsPerCall,UsPerPawnFrame\n");
+
+	Csv += FString::Printf(TEXT("%s,%d,%d,Frame,GameThread,%d,%.4f,%.4f,%.4f\n"),
+		*PawnClassName, LivePawns, SampledFrames, SampledFrames, GameThreadMilliseconds,
+		SampledFrames > 0 ? GameThreadMilliseconds * 1000.0 / SampledFrames : 0.0, GameThreadMilliseconds * 1000.0 / PawnFrames);
+
+	for (const TPair<TPair<const UClass*, EGCFMoverBenchmarkPhase>, GCF::MoverBenchmark::FSample>& Pair : GCF::MoverBenchmark::Samples) {
+		const double TotalMilliseconds = FPlatformTime::ToMilliseconds64(Pair.Value.Cycles);
+		Csv += FString::Printf(TEXT("%s,%d,%d,%s,%s,%d,%.4f,%.4f,%.4f\n"),
+			*PawnClassName, LivePawns, SampledFrames, *GCF::MoverBenchmark::GetCategoryName(Pair.Key.Key), GCF::MoverBenchmark::GetPhaseName(Pair.Key.Value), Pair.Value.Calls,
+			TotalMilliseconds, Pair.Value.Calls > 0 ? TotalMilliseconds * 1000.0 / Pair.Value.Calls : 0.0, TotalMilliseconds * 1000.0 / PawnFrames);
+	}
+
+	return FFileHelper::SaveStringToFile(Csv, *Path);
+}
+
+
+void UGCFMoverBenchmarkSubsystem::DestroyPawns()
+{
+	for (const TWeakObjectPtr<AController>& Controller : Controllers) {
+		if (Controller.IsValid()) {
+			Controller->Destroy();
+		}
+	}
+	for (const TWeakObjectPtr<APawn>& Pawn : Pawns) {
+		if (Pawn.IsValid()) {
+			Pawn->Destroy();
+		}
+	}
+	Controllers.Reset();
+	Pawns.Reset();
+	DirectionComponents.Reset();
+}
+#endif
@@ -3,7 +3,47 @@
 
 #include "Movement/Mover/GCFMoverComponent.h"
 #include "Movement/GCFMovementConfig.h"
+#include "Movement/Mover/GCFMoverLODSubsystem.h"
+#include "Movement/Mover/GCFMoverSettingsSubsystem.h"
 #include "DefaultMovementSet/Settings/CommonLegacyMovementSettings.h"
+#include "Engine/World.h"
+
+
+UGCFMoverComponent::UGCFMoverComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+}
+
+
+void UGCFMoverComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (UGCFMoverLODSubsystem* LODSubsystem = UGCFMoverLODSubsystem::Get(this)) {
+		LODSubsystem->RegisterMoverComponent(this);
+	}
+}
+
+
+void UGCFMoverComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UGCFMoverLODSubsystem* LODSubsystem = UGCFMoverLODSubsystem::Get(this)) {
+		LODSubsystem->UnregisterMoverComponent(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+
+void UGCFMoverComponent::FinalizeFrame(const FMoverSyncState* SyncState, const FMoverAuxStateContext* AuxState)
+{
+	Super::FinalizeFrame(SyncState, AuxState);
+
+	// Only pawns whose anim instance reads the snapshot pay for the capture.
+	if (AnimSnapshotBuffer.HasReaders()) {
+		AnimSnapshotBuffer.Publish(*this, GetWorld()->GetDeltaSeconds());
+	}
+}
 
 
 void UGCFMoverComponent::ApplyMovementConfig_Implementation(const UGCFMovementConfig* Config)
@@ -12,8 +52,12 @@ void UGCFMoverComponent::ApplyMovementConfig_Implementation(const UGCFMovementCo
 		return;
 	}
 
-	// TODO: If this logic needs to be shared across multiple Mover derived classes in the future, 
-	// consider extracting it into a separate handler component or function library.
+	// Pawns with identical configs share one immutable settings instance.
+	if (UGCFMoverSettingsSubsystem* SettingsSubsystem = UGCFMoverSettingsSubsystem::Get(this)) {
+		SettingsSubsystem->ApplyMovementConfig(this, SharedSettings, Config);
+		return;
+	}
+
 	if (UCommonLegacyMovementSettings* LegacyMovementSettings = FindSharedSettings_Mutable<UCommonLegacyMovementSettings>()) {
 
 		// Inject the data-driven config values into Mover's shared settings
@@ -21,4 +65,13 @@ void UGCFMoverComponent::ApplyMovementConfig_Implementation(const UGCFMovementCo
 		LegacyMovementSettings->Acceleration = Config->Acceleration;
 		LegacyMovementSettings->Deceleration = Config->Deceleration;
 	}
-}
\ No newline at end of file
+}
+
+
+UCommonLegacyMovementSettings* UGCFMoverComponent::GetMutableLegacyMovementSettings()
+{
+	if (UGCFMoverSettingsSubsystem* SettingsSubsystem = UGCFMoverSettingsSubsystem::Get(this)) {
+		return SettingsSubsystem->MakeSettingsPrivate(this, SharedSettings);
+	}
+	return FindSharedSettings_Mutable<UCommonLegacyMovementSettings>();
+}
@@ -0,0 +1,308 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Movement/Mover/GCFMoverLODSubsystem.h"
+
+#include "GCFShared.h"
+#include "MoverComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "TimerManager.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GCFMoverLODSubsystem)
+
+
+namespace GCF::MoverLOD
+{
+static bool bEnable = false;
+static FAutoConsoleVariableRef CVarEnable(
+	TEXT("GCF.Mover.LOD.Enable"),
+	bEnable,
+	TEXT("If true, server-side Mover pawns that no player controls lower their net update frequency with their distance to the nearest player view.")
+);
+
+static float EvaluationInterval = 0.25f;
+static FAutoConsoleVariableRef CVarEvaluationInterval(
+	TEXT("GCF.Mover.LOD.EvaluationInterval"),
+	EvaluationInterval,
+	TEXT("Seconds between two tier evaluations. Read at world begin play.")
+);
+
+static FString TierDistances = TEXT("3000,8000,15000");
+static FAutoConsoleVariableRef CVarTierDistances(
+	TEXT("GCF.Mover.LOD.Distances"),
+	TierDistances,
+	TEXT("Comma-separated distances (cm) to the nearest player view at which a pawn enters the Medium, Low and Minimal tiers.")
+);
+
+static FString TierNetUpdateFrequencies = TEXT("0,30,15,5");
+static FAutoConsoleVariableRef CVarTierNetUpdateFrequencies(
+	TEXT("GCF.Mover.LOD.NetUpdateFrequencies"),
+	TierNetUpdateFrequencies,
+	TEXT("Comma-separated net update frequency (Hz) of server NPCs per tier (High, Medium, Low, Minimal). 0 keeps the actor's own value.")
+);
+
+static float Hysteresis = 0.1f;
+static FAutoConsoleVariableRef CVarHysteresis(
+	TEXT("GCF.Mover.LOD.Hysteresis"),
+	Hysteresis,
+	TEXT("Fraction of a tier distance a pawn must move past the threshold before it changes tier again.")
+);
+
+static int32 ForcedTier = INDEX_NONE;
+static FAutoConsoleVariableRef CVarForcedTier(
+	TEXT("GCF.Mover.LOD.ForceTier"),
+	ForcedTier,
+	TEXT("Forces every managed pawn into the given tier (0 = High .. 3 = Minimal). -1 uses distance.")
+);
+
+static constexpr int32 TierCount = static_cast<int32>(EGCFMoverLODTier::Minimal) + 1;
+
+static void ParseTierValues(const FString& Source, TArray<float>& OutValues)
+{
+	TArray<FString> Tokens;
+	Source.ParseIntoArray(Tokens, TEXT(","));
+
+	OutValues.Reset(Tokens.Num());
+	for (const FString& Token : Tokens) {
+		OutValues.Add(FCString::Atof(*Token.TrimStartAndEnd()));
+	}
+}
+
+/** Returns the value for the tier, or 0 (i.e. keep the default) if the list is shorter. */
+static float GetTierValue(const TArray<float>& Values, EGCFMoverLODTier Tier)
+{
+	const int32 Index = static_cast<int32>(Tier);
+	return Values.IsValidIndex(Index) ? Values[Index] : 0.0f;
+}
+
+static EGCFMoverLODTier ComputeTier(float Distance, EGCFMoverLODTier CurrentTier, const TArray<float>& Thresholds)
+{
+	int32 Tier = 0;
+	for (int32 Index = 0; Index < FMath::Min(Thresholds.Num(), TierCount - 1); ++Index) {
+		// Thresholds the pawn has already crossed are widened so it does not flap on the boundary.
+		const float Margin = Index < static_cast<int32>(CurrentTier) ? (1.0f - Hysteresis) : (1.0f + Hysteresis);
+		if (Distance > Thresholds[Index] * Margin) {
+			Tier = Index + 1;
+		}
+	}
+	return static_cast<EGCFMoverLODTier>(Tier);
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorld CmdDump(
+	TEXT("GCF.Mover.LOD.Dump"),
+	TEXT("Logs the number of Mover pawns in each net update frequency tier."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World) {
+		if (UGCFMoverLODSubsystem* Subsystem = UGCFMoverLODSubsystem::Get(World)) {
+			Subsystem->DumpTiers();
+		}
+	})
+);
+#endif
+}
+
+
+UGCFMoverLODSubsystem* UGCFMoverLODSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr) {
+		return World->GetSubsystem<UGCFMoverLODSubsystem>();
+	}
+	return nullptr;
+}
+
+
+bool UGCFMoverLODSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+
+void UGCFMoverLODSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (GCF::MoverLOD::EvaluationInterval > 0.0f) {
+		InWorld.GetTimerManager().SetTimer(EvaluateTimerHandle, FTimerDelegate::CreateUObject(this, &ThisClass::EvaluateTiers), GCF::MoverLOD::EvaluationInterval, true);
+	}
+}
+
+
+void UGCFMoverLODSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld()) {
+		World->GetTimerManager().ClearTimer(EvaluateTimerHandle);
+	}
+	ManagedMovers.Empty();
+
+	Super::Deinitialize();
+}
+
+
+void UGCFMoverLODSubsystem::RegisterMoverComponent(UMoverComponent* MoverComponent)
+{
+	AActor* Owner = MoverComponent ? MoverComponent->GetOwner() : nullptr;
+	if (!Owner || ManagedMovers.ContainsByPredicate([MoverComponent](const FManagedMover& Entry) { return Entry.Component == MoverComponent; })) {
+		return;
+	}
+
+	FManagedMover& Entry = ManagedMovers.AddDefaulted_GetRef();
+	Entry.Component = MoverComponent;
+}
+
+
+void UGCFMoverLODSubsystem::UnregisterMoverComponent(UMoverComponent* MoverComponent)
+{
+	const int32 Index = ManagedMovers.IndexOfByPredicate([MoverComponent](const FManagedMover& Entry) { return Entry.Component == MoverComponent; });
+	if (Index != INDEX_NONE) {
+		RestoreDefaults(ManagedMovers[Index]);
+		ManagedMovers.RemoveAtSwap(Index);
+	}
+}
+
+
+EGCFMoverLODTier UGCFMoverLODSubsystem::GetMoverLODTier(const UMoverComponent* MoverComponent) const
+{
+	const FManagedMover* Entry = ManagedMovers.FindByPredicate([MoverComponent](const FManagedMover& Candidate) { return Candidate.Component == MoverComponent; });
+	return Entry ? Entry->Tier : EGCFMoverLODTier::High;
+}
+
+
+void UGCFMoverLODSubsystem::EvaluateTiers()
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_GCFMoverLOD_EvaluateTiers);
+
+	UWorld* World = GetWorld();
+	if (!World) {
+		return;
+	}
+
+	ManagedMovers.RemoveAllSwap([](const FManagedMover& Entry) { return !Entry.Component.IsValid(); });
+
+	if (!GCF::MoverLOD::bEnable) {
+		for (FManagedMover& Entry : ManagedMovers) {
+			RestoreDefaults(Entry);
+		}
+		return;
+	}
+
+	// Every player's view; only server-side pawns are managed.
+	TArray<FVector, TInlineAllocator<8>> ViewLocations;
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It) {
+		if (const APlayerController* PlayerController = It->Get()) {
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			ViewLocations.Add(ViewLocation);
+		}
+	}
+
+	FTierSettings Settings;
+	GCF::MoverLOD::ParseTierValues(GCF::MoverLOD::TierDistances, Settings.Distances);
+	GCF::MoverLOD::ParseTierValues(GCF::MoverLOD::TierNetUpdateFrequencies, Settings.NetUpdateFrequencies);
+
+	const bool bForced = GCF::MoverLOD::ForcedTier >= 0;
+	const EGCFMoverLODTier ForcedTier = static_cast<EGCFMoverLODTier>(FMath::Clamp(GCF::MoverLOD::ForcedTier, 0, GCF::MoverLOD::TierCount - 1));
+
+	for (FManagedMover& Entry : ManagedMovers) {
+		const UMoverComponent* MoverComponent = Entry.Component.Get();
+		if (!IsLODCandidate(*MoverComponent)) {
+			ApplyTier(Entry, EGCFMoverLODTier::High, Settings);
+			continue;
+		}
+
+		if (bForced) {
+			ApplyTier(Entry, ForcedTier, Settings);
+			continue;
+		}
+
+		// With nobody watching (e.g. an empty dedicated server), every pawn is as far away as it can be.
+		float Distance = TNumericLimits<float>::Max();
+		if (!ViewLocations.IsEmpty()) {
+			const FVector PawnLocation = MoverComponent->GetOwner()->GetActorLocation();
+			float MinDistanceSquared = TNumericLimits<float>::Max();
+			for (const FVector& ViewLocation : ViewLocations) {
+				MinDistanceSquared = FMath::Min(MinDistanceSquared, static_cast<float>(FVector::DistSquared(PawnLocation, ViewLocation)));
+			}
+			Distance = FMath::Sqrt(MinDistanceSquared);
+		}
+
+		ApplyTier(Entry, GCF::MoverLOD::ComputeTier(Distance, Entry.Tier, Settings.Distances), Settings);
+	}
+}
+
+
+bool UGCFMoverLODSubsystem::IsLODCandidate(const UMoverComponent& MoverComponent)
+{
+	// The net update frequency is the only lever, and only the server can change it.
+	const AActor* Owner = MoverComponent.GetOwner();
+	if (!Owner || !Owner->HasAuthority()) {
+		return false;
+	}
+
+	// A player's pawn is simulated from that player's input and must keep full rate.
+	if (const APawn* Pawn = Cast<APawn>(Owner)) {
+		return !Pawn->IsLocallyControlled() && !Pawn->IsPlayerControlled();
+	}
+	return true;
+}
+
+
+void UGCFMoverLODSubsystem::ApplyTier(FManagedMover& Entry, EGCFMoverLODTier NewTier, const FTierSettings& Settings)
+{
+	if (Entry.Tier == NewTier) {
+		return;
+	}
+
+	if (NewTier == EGCFMoverLODTier::High) {
+		RestoreDefaults(Entry);
+		return;
+	}
+
+	AActor* Owner = Entry.Component->GetOwner();
+
+	// Leaving High, the current value is the one to restore later. A value gameplay changed while downgraded replaces it.
+	if (Entry.Tier == EGCFMoverLODTier::High || Owner->GetNetUpdateFrequency() != Entry.AppliedNetUpdateFrequency) {
+		Entry.DefaultNetUpdateFrequency = Owner->GetNetUpdateFrequency();
+	}
+
+	const float NetUpdateFrequency = GCF::MoverLOD::GetTierValue(Settings.NetUpdateFrequencies, NewTier);
+	Entry.AppliedNetUpdateFrequency = NetUpdateFrequency > 0.0f ? FMath::Min(NetUpdateFrequency, Entry.DefaultNetUpdateFrequency) : Entry.DefaultNetUpdateFrequency;
+	Owner->SetNetUpdateFrequency(Entry.AppliedNetUpdateFrequency);
+
+	Entry.Tier = NewTier;
+}
+
+
+void UGCFMoverLODSubsystem::RestoreDefaults(FManagedMover& Entry)
+{
+	if (Entry.Tier == EGCFMoverLODTier::High) {
+		return;
+	}
+
+	// Only a value still holding what this subsystem wrote is restored; anything gameplay set since is kept.
+	if (UMoverComponent* MoverComponent = Entry.Component.Get()) {
+		AActor* Owner = MoverComponent->GetOwner();
+		if (Owner->GetNetUpdateFrequency() == Entry.AppliedNetUpdateFrequency) {
+			Owner->SetNetUpdateFrequency(Entry.DefaultNetUpdateFrequency);
+		}
+	}
+	Entry.Tier = EGCFMoverLODTier::High;
+}
+
+
+void UGCFMoverLODSubsystem::DumpTiers() const
+{
+	int32 TierCounts[GCF::MoverLOD::TierCount] = {};
+	for (const FManagedMover& Entry : ManagedMovers) {
+		++TierCounts[static_cast<int32>(Entry.Tier)];
+	}
+
+	UE_LOG(LogGCFCharacter, Display, TEXT("GCF.Mover.LOD: %d managed pawns (enabled %d, forced tier %d)."), ManagedMovers.Num(), GCF::MoverLOD::bEnable, GCF::MoverLOD::ForcedTier);
+	for (int32 Tier = 0; Tier < GCF::MoverLOD::TierCount; ++Tier) {
+		UE_LOG(LogGCFCharacter, Display, TEXT(" - %-8s %d"), *StaticEnum<EGCFMoverLODTier>()->GetNameStringByValue(Tier), TierCounts[Tier]);
+	}
+}
+
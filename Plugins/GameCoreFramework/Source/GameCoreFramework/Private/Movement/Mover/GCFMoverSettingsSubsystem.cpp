@@ -0,0 +1,189 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Movement/Mover/GCFMoverSettingsSubsystem.h"
+
+#include "GCFShared.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Movement/GCFMovementConfig.h"
+#include "MoverComponent.h"
+#include "MovementMode.h"
+#include "DefaultMovementSet/Settings/CommonLegacyMovementSettings.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GCFMoverSettingsSubsystem)
+
+
+namespace GCF::MoverSettings
+{
+/** Returns true for the properties a movement config writes. */
+static bool IsConfiguredProperty(const FProperty* Property)
+{
+	const FName Name = Property->GetFName();
+	return Name == GET_MEMBER_NAME_CHECKED(UCommonLegacyMovementSettings, MaxSpeed)
+		|| Name == GET_MEMBER_NAME_CHECKED(UCommonLegacyMovementSettings, Acceleration)
+		|| Name == GET_MEMBER_NAME_CHECKED(UCommonLegacyMovementSettings, Deceleration);
+}
+
+static bool HasConfigValues(const UCommonLegacyMovementSettings* Settings, const UGCFMovementConfig* Config)
+{
+	return Settings->MaxSpeed == Config->MaxSpeed && Settings->Acceleration == Config->Acceleration && Settings->Deceleration == Config->Deceleration;
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorld CmdDumpSharedSettings(
+	TEXT("GCF.Mover.DumpSharedSettings"),
+	TEXT("Logs the Mover legacy movement settings instances shared between pawns."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World) {
+		if (UGCFMoverSettingsSubsystem* Subsystem = UGCFMoverSettingsSubsystem::Get(World)) {
+			Subsystem->DumpSharedSettings();
+		}
+	})
+);
+#endif
+}
+
+
+UGCFMoverSettingsSubsystem* UGCFMoverSettingsSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr) {
+		return World->GetSubsystem<UGCFMoverSettingsSubsystem>();
+	}
+	return nullptr;
+}
+
+
+void UGCFMoverSettingsSubsystem::Deinitialize()
+{
+	SharedSettings.Empty();
+	SharedSettingsCount = 0;
+	SharedSettingsReferences.Empty();
+	PrivateSettings.Empty();
+
+	Super::Deinitialize();
+}
+
+
+bool UGCFMoverSettingsSubsystem::ApplyMovementConfig(UMoverComponent* MoverComponent, TArray<TObjectPtr<UObject>>& InOutSettings, const UGCFMovementConfig* Config)
+{
+	const int32 Index = FindLegacySettingsIndex(InOutSettings);
+	if (Index == INDEX_NONE || !Config) {
+		return false;
+	}
+
+	UCommonLegacyMovementSettings* CurrentSettings = CastChecked<UCommonLegacyMovementSettings>(InOutSettings[Index]);
+
+	// A pawn that overrode values at runtime keeps its private copy; only the config values are written.
+	if (PrivateSettings.Contains(CurrentSettings)) {
+		CurrentSettings->MaxSpeed = Config->MaxSpeed;
+		CurrentSettings->Acceleration = Config->Acceleration;
+		CurrentSettings->Deceleration = Config->Deceleration;
+		return true;
+	}
+
+	// Re-applying the values of the shared instance in use is the common case, e.g. on every possession.
+	if (CurrentSettings->GetOuter() == this && GCF::MoverSettings::HasConfigValues(CurrentSettings, Config)) {
+		return true;
+	}
+
+	UCommonLegacyMovementSettings* Shared = FindOrCreateSharedSettings(CurrentSettings, Config);
+	if (Shared != CurrentSettings) {
+		ReplaceSettings(MoverComponent, InOutSettings, Index, Shared);
+	}
+	return true;
+}
+
+
+UCommonLegacyMovementSettings* UGCFMoverSettingsSubsystem::MakeSettingsPrivate(UMoverComponent* MoverComponent, TArray<TObjectPtr<UObject>>& InOutSettings)
+{
+	const int32 Index = FindLegacySettingsIndex(InOutSettings);
+	if (Index == INDEX_NONE) {
+		return nullptr;
+	}
+
+	UCommonLegacyMovementSettings* CurrentSettings = CastChecked<UCommonLegacyMovementSettings>(InOutSettings[Index]);
+	if (PrivateSettings.Contains(CurrentSettings)) {
+		return CurrentSettings;
+	}
+
+	// The component's initial instance is already private; shared instances are copied first.
+	UCommonLegacyMovementSettings* PrivateCopy = CurrentSettings;
+	if (CurrentSettings->GetOuter() != MoverComponent) {
+		PrivateCopy = DuplicateObject(CurrentSettings, MoverComponent);
+		ReplaceSettings(MoverComponent, InOutSettings, Index, PrivateCopy);
+	}
+
+	PrivateSettings.Add(PrivateCopy);
+	return PrivateCopy;
+}
+
+
+int32 UGCFMoverSettingsSubsystem::FindLegacySettingsIndex(const TArray<TObjectPtr<UObject>>& Settings)
+{
+	return Settings.IndexOfByPredicate([](const UObject* Entry) { return Entry && Entry->IsA<UCommonLegacyMovementSettings>(); });
+}
+
+
+bool UGCFMoverSettingsSubsystem::HasSameUnconfiguredValues(const UCommonLegacyMovementSettings* A, const UCommonLegacyMovementSettings* B)
+{
+	if (A->GetClass() != B->GetClass()) {
+		return false;
+	}
+
+	for (TFieldIterator<FProperty> It(A->GetClass()); It; ++It) {
+		if (!GCF::MoverSettings::IsConfiguredProperty(*It) && !It->Identical_InContainer(A, B)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+
+UCommonLegacyMovementSettings* UGCFMoverSettingsSubsystem::FindOrCreateSharedSettings(UCommonLegacyMovementSettings* SourceSettings, const UGCFMovementConfig* Config)
+{
+	TArray<UCommonLegacyMovementSettings*>& Bucket = SharedSettings.FindOrAdd(FSettingsKey{ SourceSettings->GetClass(), Config->MaxSpeed, Config->Acceleration, Config->Deceleration });
+	for (UCommonLegacyMovementSettings* Candidate : Bucket) {
+		if (HasSameUnconfiguredValues(Candidate, SourceSettings)) {
+			return Candidate;
+		}
+	}
+
+	// Copy the source so every value the config does not cover is kept, then apply the config values.
+	UCommonLegacyMovementSettings* Settings = DuplicateObject(SourceSettings, this);
+	Settings->MaxSpeed = Config->MaxSpeed;
+	Settings->Acceleration = Config->Acceleration;
+	Settings->Deceleration = Config->Deceleration;
+
+	Bucket.Add(Settings);
+	SharedSettingsReferences.Add(Settings);
+	++SharedSettingsCount;
+	return Settings;
+}
+
+
+void UGCFMoverSettingsSubsystem::ReplaceSettings(UMoverComponent* MoverComponent, TArray<TObjectPtr<UObject>>& InOutSettings, int32 Index, UCommonLegacyMovementSettings* NewSettings)
+{
+	InOutSettings[Index] = NewSettings;
+
+	// Modes register during component initialization. Before that, they pick up the new entry on their own.
+	if (!MoverComponent || !MoverComponent->HasBeenInitialized()) {
+		return;
+	}
+
+	for (const TPair<FName, TObjectPtr<UBaseMovementMode>>& Pair : MoverComponent->MovementModes) {
+		if (UBaseMovementMode* Mode = Pair.Value) {
+			Mode->OnUnregistered();
+			Mode->OnRegistered(Pair.Key);
+		}
+	}
+}
+
+
+void UGCFMoverSettingsSubsystem::DumpSharedSettings() const
+{
+	UE_LOG(LogGCFCharacter, Display, TEXT("GCF.Mover.DumpSharedSettings: %d shared instances, %d private overrides."), SharedSettingsCount, PrivateSettings.Num());
+	for (const TPair<FSettingsKey, TArray<UCommonLegacyMovementSettings*>>& Pair : SharedSettings) {
+		UE_LOG(LogGCFCharacter, Display, TEXT(" - %s: MaxSpeed %.1f, Acceleration %.1f, Deceleration %.1f, %d variants"),
+			   *GetNameSafe(Pair.Key.SettingsClass), Pair.Key.MaxSpeed, Pair.Key.Acceleration, Pair.Key.Deceleration, Pair.Value.Num());
+	}
+}
@@ -0,0 +1,68 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Movement/Mover/Input/GCFHumanoidInputs.h"
+
+#include "Components/PrimitiveComponent.h"
+#include "Engine/NetSerialization.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GCFHumanoidInputs)
+
+
+bool FGCFHumanoidInputs::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	// Skips FCharacterDefaultInputs::NetSerialize on purpose; every field it writes is written here in quantized form.
+	FMoverDataStructBase::NetSerialize(Ar, Map, bOutSuccess);
+
+	// --- Move intent ---
+	uint32 MoveTypeValue = (uint32)GetMoveInputType();
+	Ar.SerializeInt(MoveTypeValue, 4);
+
+	FVector Move = GetMoveInput();
+	bool bHasMove = !Move.IsNearlyZero();
+	Ar.SerializeBits(&bHasMove, 1);
+	if (bHasMove) {
+		if ((EMoveInputType)MoveTypeValue == EMoveInputType::DirectionalIntent) {
+			// Directional intents are clamped to unit length by SetMoveInput.
+			bOutSuccess &= SerializeFixedVector<1, 16>(Move, Ar);
+		} else {
+			// Velocity inputs are unbounded; keep them at centimeter precision.
+			bOutSuccess &= SerializePackedVector<10, 24>(Move, Ar);
+		}
+	} else {
+		Move = FVector::ZeroVector;
+	}
+	if (Ar.IsLoading()) {
+		SetMoveInput((EMoveInputType)MoveTypeValue, Move);
+	}
+
+	// --- Orientation ---
+	bOutSuccess &= SerializeFixedVector<1, 16>(OrientationIntent, Ar);
+	ControlRotation.SerializeCompressedShort(Ar);
+
+	// --- Flags ---
+	Ar.SerializeBits(&bIsJumpJustPressed, 1);
+	Ar.SerializeBits(&bIsJumpPressed, 1);
+	Ar.SerializeBits(&bWantsToCrouch, 1);
+
+	// --- Optional fields ---
+	bool bHasSuggestedMode = !SuggestedMovementMode.IsNone();
+	Ar.SerializeBits(&bHasSuggestedMode, 1);
+	if (bHasSuggestedMode) {
+		Ar << SuggestedMovementMode;
+	} else if (Ar.IsLoading()) {
+		SuggestedMovementMode = NAME_None;
+	}
+
+	Ar.SerializeBits(&bUsingMovementBase, 1);
+	if (bUsingMovementBase) {
+		Ar << MovementBase;
+		Ar << MovementBaseBoneName;
+	} else if (Ar.IsLoading()) {
+		MovementBase = nullptr;
+		MovementBaseBoneName = NAME_None;
+	}
+
+	bOutSuccess &= !Ar.IsError();
+	return true;
+}
@@ -0,0 +1,153 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Movement/Mover/Mode/GCFCrowdWalkingMode.h"
+#include "MoverComponent.h"
+#include "MoverDataModelTypes.h"
+#include "MoverSimulationTypes.h"
+#include "DefaultMovementSet/Settings/CommonLegacyMovementSettings.h"
+#include "GameFramework/Pawn.h"
+#include "MoveLibrary/FloorQueryUtils.h"
+#include "Movement/Mover/GCFCrowdMovementSubsystem.h"
+#include "Movement/Mover/GCFMoverBenchmarkSubsystem.h"
+
+
+void UGCFCrowdWalkingMode::OnRegistered(const FName ModeName)
+{
+	Super::OnRegistered(ModeName);
+
+	if (UGCFCrowdMovementSubsystem* CrowdSubsystem = UGCFCrowdMovementSubsystem::Get(this)) {
+		CrowdSubsystem->RegisterCrowdMover(GetMoverComponent());
+	}
+}
+
+
+void UGCFCrowdWalkingMode::OnUnregistered()
+{
+	if (UGCFCrowdMovementSubsystem* CrowdSubsystem = UGCFCrowdMovementSubsystem::Get(this)) {
+		CrowdSubsystem->UnregisterCrowdMover(GetMoverComponent());
+	}
+
+	Super::OnUnregistered();
+}
+
+
+void UGCFCrowdWalkingMode::SimulationTick_Implementation(const FSimulationTickParams& Params, FMoverTickEndData& OutputState)
+{
+	GCF_MOVER_BENCHMARK_SCOPE(this, SimulationTick);
+
+	UGCFCrowdMovementSubsystem* CrowdSubsystem = UGCFCrowdMovementSubsystem::IsBatchingEnabled() ? UGCFCrowdMovementSubsystem::Get(this) : nullptr;
+	if (!CrowdSubsystem) {
+		Super::SimulationTick_Implementation(Params, OutputState);
+		return;
+	}
+
+	FCrowdMoveResult Result;
+	if (!ComputeCrowdMove(*CrowdSubsystem, Params, Result)) {
+		CrowdSubsystem->RecordFallbackStep();
+		Super::SimulationTick_Implementation(Params, OutputState);
+		return;
+	}
+
+	if (!ApplyCrowdMove(Params, Result, OutputState)) {
+		CrowdSubsystem->RecordFallbackStep();
+		Super::SimulationTick_Implementation(Params, OutputState);
+		return;
+	}
+	CrowdSubsystem->RecordBatchedStep();
+}
+
+
+bool UGCFCrowdWalkingMode::ComputeCrowdMove(const UGCFCrowdMovementSubsystem& CrowdSubsystem, const FSimulationTickParams& Params, FCrowdMoveResult& OutResult) const
+{
+	const UMoverComponent* MoverComponent = GetMoverComponent();
+	const AActor* Owner = MoverComponent ? MoverComponent->GetOwner() : nullptr;
+	if (!Owner || !Owner->HasAuthority()) {
+		return false;
+	}
+
+	// Player pawns are predicted by their client with the standard path; both sides must agree.
+	if (const APawn* Pawn = Cast<APawn>(Owner); Pawn && Pawn->IsPlayerControlled()) {
+		return false;
+	}
+
+	// The batched probes are cast along world Z.
+	if (!MoverComponent->GetUpDirection().Equals(FVector::UpVector)) {
+		return false;
+	}
+
+	const FGCFCrowdFloor* Floor = CrowdSubsystem.FindFloor(MoverComponent);
+	const UCommonLegacyMovementSettings* Settings = MoverComponent->FindSharedSettings<UCommonLegacyMovementSettings>();
+	const FMoverDefaultSyncState* StartingSyncState = Params.StartState.SyncState.SyncStateCollection.FindDataByType<FMoverDefaultSyncState>();
+	const float DeltaSeconds = Params.TimeStep.StepMs * 0.001f;
+	if (!Floor || !Floor->bBlockingHit || !Settings || !StartingSyncState || DeltaSeconds <= 0.0f) {
+		return false;
+	}
+
+	// Based movement and probes older than the previous frame are left to the standard path.
+	if (StartingSyncState->GetMovementBase() || GFrameCounter - Floor->Frame > 1) {
+		return false;
+	}
+
+	const FVector& FloorNormal = Floor->Hit.ImpactNormal;
+	if (FloorNormal.Z < Settings->MaxWalkSlopeCosine) {
+		return false;
+	}
+
+	const FVector StartLocation = StartingSyncState->GetLocation_WorldSpace();
+	FVector Location = StartLocation + Params.ProposedMove.LinearVelocity * DeltaSeconds;
+
+	// The probe only proves there is floor right under where it was cast. Anywhere farther, a ledge or a gap
+	// could lie between, which the swept move does not catch; the standard floor check runs instead.
+	if (FVector::DistSquared2D(Location, Floor->ProbeLocation) > FMath::Square(UGCFCrowdMovementSubsystem::GetMaxProbeOffset())) {
+		return false;
+	}
+
+	Location.Z = Floor->GetCenterHeight(Location);
+
+	if (FMath::Abs(Location.Z - StartLocation.Z) > Settings->MaxStepHeight) {
+		return false;
+	}
+
+	OutResult.Location = Location;
+	OutResult.Velocity = (Location - StartLocation) / DeltaSeconds;
+	OutResult.AngularVelocityDegrees = Params.ProposedMove.AngularVelocityDegrees;
+	OutResult.Orientation = (StartingSyncState->GetOrientation_WorldSpace() + FRotator::MakeFromEuler(Params.ProposedMove.AngularVelocityDegrees * DeltaSeconds)).GetNormalized();
+	OutResult.Floor = Floor;
+	return true;
+}
+
+
+bool UGCFCrowdWalkingMode::ApplyCrowdMove(const FSimulationTickParams& Params, const FCrowdMoveResult& Result, FMoverTickEndData& OutputState) const
+{
+	USceneComponent* UpdatedComponent = Params.MovingComps.UpdatedComponent.Get();
+	if (!UpdatedComponent) {
+		return false;
+	}
+
+	// A swept move is still needed for walls and other pawns, but it is a single sweep with no floor query or slide.
+	const FVector StartLocation = UpdatedComponent->GetComponentLocation();
+	const FQuat StartRotation = UpdatedComponent->GetComponentQuat();
+	FHitResult Hit;
+	UpdatedComponent->MoveComponent(Result.Location - StartLocation, Result.Orientation.Quaternion(), true, &Hit);
+	if (Hit.bBlockingHit || Hit.bStartPenetrating) {
+		UpdatedComponent->SetWorldLocationAndRotation(StartLocation, StartRotation);
+		return false;
+	}
+
+	FMoverDefaultSyncState& OutputSyncState = OutputState.SyncState.SyncStateCollection.FindOrAddMutableDataByType<FMoverDefaultSyncState>();
+	OutputSyncState.SetTransforms_WorldSpace(Result.Location, Result.Orientation, Result.Velocity, Result.AngularVelocityDegrees);
+	OutputSyncState.MoveDirectionIntent = Params.ProposedMove.bHasDirIntent ? Params.ProposedMove.DirectionIntent : FVector::ZeroVector;
+	OutputState.MovementEndState.RemainingMs = 0.0f;
+
+	// Keep the floor the standard GenerateMove reads from the blackboard current.
+	if (UMoverBlackboard* SimBlackboard = GetMoverComponent()->GetSimBlackboard_Mutable()) {
+		FFloorCheckResult FloorResult;
+		FloorResult.bBlockingHit = true;
+		FloorResult.bWalkableFloor = true;
+		FloorResult.FloorDist = FGCFCrowdFloor::FloorDistance;
+		FloorResult.HitResult = Result.Floor->Hit;
+		SimBlackboard->Set(CommonBlackboard::LastFloorResult, FloorResult);
+	}
+	return true;
+}
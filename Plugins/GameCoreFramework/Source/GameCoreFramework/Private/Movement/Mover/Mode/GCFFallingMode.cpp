@@ -4,9 +4,20 @@
 #include "Movement/Mover/Mode/GCFFallingMode.h"
 #include "MoverComponent.h"
 #include "MoverDataModelTypes.h"
+#include "Movement/Mover/GCFMoverBenchmarkSubsystem.h"
 
 
 void UGCFFallingMode::GenerateMove_Implementation(const FMoverTickStartData& StartState, const FMoverTimeStep& TimeStep, FProposedMove& OutProposedMove) const
 {
+	GCF_MOVER_BENCHMARK_SCOPE(this, GenerateMove);
+
 	Super::GenerateMove_Implementation(StartState, TimeStep, OutProposedMove);
-}
\ No newline at end of file
+}
+
+
+void UGCFFallingMode::SimulationTick_Implementation(const FSimulationTickParams& Params, FMoverTickEndData& OutputState)
+{
+	GCF_MOVER_BENCHMARK_SCOPE(this, SimulationTick);
+
+	Super::SimulationTick_Implementation(Params, OutputState);
+}
@@ -4,9 +4,20 @@
 #include "Movement/Mover/Mode/GCFFlyingMode.h"
 #include "MoverComponent.h"
 #include "MoverDataModelTypes.h"
+#include "Movement/Mover/GCFMoverBenchmarkSubsystem.h"
 
 
 void UGCFFlyingMode::GenerateMove_Implementation(const FMoverTickStartData& StartState, const FMoverTimeStep& TimeStep, FProposedMove& OutProposedMove) const
 {
+	GCF_MOVER_BENCHMARK_SCOPE(this, GenerateMove);
+
 	Super::GenerateMove_Implementation(StartState, TimeStep, OutProposedMove);
-}
\ No newline at end of file
+}
+
+
+void UGCFFlyingMode::SimulationTick_Implementation(const FSimulationTickParams& Params, FMoverTickEndData& OutputState)
+{
+	GCF_MOVER_BENCHMARK_SCOPE(this, SimulationTick);
+
+	Super::SimulationTick_Implementation(Params, OutputState);
+}
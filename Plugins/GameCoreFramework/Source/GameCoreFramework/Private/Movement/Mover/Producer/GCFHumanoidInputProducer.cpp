@@ -3,21 +3,21 @@
 
 #include "Movement/Mover/Producer/GCFHumanoidInputProducer.h"
 #include "Movement/Mover/Input/GCFHumanoidInputs.h"
-#include "Movement/Locomotion/GCFLocomotionInputProvider.h"
+#include "Movement/Mover/GCFMoverBenchmarkSubsystem.h"
 
 
 void UGCFHumanoidInputProducer::ProduceInput_Implementation(int32 SimTime, FMoverInputCmdContext& InputCmdResult)
 {
+	GCF_MOVER_BENCHMARK_SCOPE(this, ProduceInput);
+
+	// Add the humanoid inputs before the base class runs. They extend FCharacterDefaultInputs, so the base class
+	// finds and fills them instead of adding a second, unquantized default input struct.
+	FGCFHumanoidInputs& HumanoidInputs = InputCmdResult.InputCollection.FindOrAddMutableDataByType<FGCFHumanoidInputs>();
+
 	// Call the base class to handle standard directional movement and jumps via interface.
 	Super::ProduceInput_Implementation(SimTime, InputCmdResult);
 
-	APawn* OwnerPawn = Cast<APawn>(GetOwner());
-	if (OwnerPawn && OwnerPawn->IsLocallyControlled()) {
-
-		if (OwnerPawn->Implements<UGCFLocomotionInputProvider>()) {
-			// --- Crouch Handling ---
-			FGCFHumanoidInputs& HumanoidInputs = InputCmdResult.InputCollection.FindOrAddMutableDataByType<FGCFHumanoidInputs>();
-			HumanoidInputs.bWantsToCrouch = IGCFLocomotionInputProvider::Execute_GetWantsToCrouch(OwnerPawn);
-		}
-	}
-}
\ No newline at end of file
+	// --- Crouch Handling ---
+	APawn* OwnerPawn = GetLocallyControlledOwner();
+	HumanoidInputs.bWantsToCrouch = OwnerPawn && GetProviderCallMode(OwnerPawn) != EGCFProviderCallMode::None && ReadWantsToCrouch(OwnerPawn);
+}
@@ -3,14 +3,92 @@
 
 #include "Movement/Mover/Producer/GCFLocomotionInputProducer.h"
 #include "Movement/Locomotion/GCFLocomotionInputProvider.h"
+#include "Movement/Mover/GCFMoverBenchmarkSubsystem.h"
+#include "System/GCFInputLatencyTracker.h"
+#include "System/Binder/GCFPawnPossessionBinder.h"
+#include "System/Binder/GCFPawnControllerAssignedBinder.h"
+#include "Components/GameFrameworkComponentManager.h"
+#include "Engine/World.h"
+
+
+namespace GCF::LocomotionInputProducer
+{
+static bool bUseNativeProvider = true;
+static FAutoConsoleVariableRef CVarUseNativeProvider(
+	TEXT("GCF.Mover.NativeInputProvider"),
+	bUseNativeProvider,
+	TEXT("If true, input producers call C++ locomotion input providers directly instead of through reflection. Applied when a producer resolves its provider.")
+);
+
+/** True if the class (or its native parent) implements the function in C++ and no Blueprint overrides it. */
+static bool IsNativeFunction(const UClass* Class, FName FunctionName)
+{
+	const UFunction* Function = Class->FindFunctionByName(FunctionName);
+	return Function && Function->HasAnyFunctionFlags(FUNC_Native);
+}
+}
+
+
+void UGCFLocomotionInputProducer::BeginPlay()
+{
+	Super::BeginPlay();
+
+	RefreshOwnerState();
+
+	if (APawn* OwnerPawn = CachedOwnerPawn) {
+		if (UGameFrameworkComponentManager* GFCM = UGameFrameworkComponentManager::GetForActor(OwnerPawn)) {
+			PossessionBinders.Emplace(FGCFPawnPossessionBinder::CreateBinder(
+				GFCM, OwnerPawn, FGCFBooleanStateSignature::CreateUObject(this, &ThisClass::HandlePossessionChanged)));
+
+			// The pawn's controller can replicate after the possession event on clients.
+			PossessionBinders.Emplace(FGCFPawnControllerAssignedBinder::CreateBinder(
+				GFCM, OwnerPawn, FGCFBooleanStateSignature::CreateUObject(this, &ThisClass::HandlePossessionChanged)));
+		}
+	}
+}
+
+
+void UGCFLocomotionInputProducer::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	FGCFInputLatencyTracker::ForgetLocomotionInput(CachedOwnerPawn);
+
+	PossessionBinders.Empty();
+	CachedOwnerPawn = nullptr;
+	bOwnerLocallyControlled = false;
+	NativeProvider = nullptr;
+	ProviderCallMode = EGCFProviderCallMode::Unresolved;
+
+	Super::EndPlay(EndPlayReason);
+}
+
+
+void UGCFLocomotionInputProducer::HandlePossessionChanged(AActor* Actor, bool bPossessed)
+{
+	RefreshOwnerState();
+}
+
+
+void UGCFLocomotionInputProducer::RefreshOwnerState()
+{
+	CachedOwnerPawn = Cast<APawn>(GetOwner());
+	bOwnerLocallyControlled = CachedOwnerPawn && CachedOwnerPawn->IsLocallyControlled();
+
+	// Only locally controlled pawns read the provider, so the resolution is deferred until then.
+	ProviderCallMode = EGCFProviderCallMode::Unresolved;
+	if (bOwnerLocallyControlled) {
+		ResolveProvider(CachedOwnerPawn, GCF::LocomotionInputProducer::bUseNativeProvider);
+	}
+}
 
 
 void UGCFLocomotionInputProducer::ProduceInput_Implementation(int32 SimTime, FMoverInputCmdContext& InputCmdResult)
 {
-    APawn* OwnerPawn = Cast<APawn>(GetOwner());
-    if (!OwnerPawn) {
-        return;
-    }
+	GCF_MOVER_BENCHMARK_SCOPE(this, ProduceInput);
+
+	APawn* OwnerPawn = CachedOwnerPawn;
+	if (!OwnerPawn) {
+		return;
+	}
 
 	// Retrieve or create the standard character input buffer for this simulation frame.
 	FCharacterDefaultInputs& InputData = InputCmdResult.InputCollection.FindOrAddMutableDataByType<FCharacterDefaultInputs>();
@@ -19,27 +97,116 @@ void UGCFLocomotionInputProducer::ProduceInput_Implementation(int32 SimTime, FMo
 
 	// We only poll input from locally controlled pawns. 
 	// Simulated proxies will have their inputs populated via Network Prediction replication.
-	if (OwnerPawn->IsLocallyControlled()) {
+	if (bOwnerLocallyControlled) {
 
 		// Extract the cached movement vector (calculated from Enhanced Input / Gameplay Tags)
 		// securely via the provider interface, decoupling the producer from the specific Pawn class.
-		if (OwnerPawn->Implements<UGCFLocomotionInputProvider>()) {
+		ReadLocomotionIntents(OwnerPawn, DesiredMove, DesiredOrientation, InputData.bIsJumpPressed, InputData.bIsJumpJustPressed);
+		FGCFInputLatencyTracker::ConsumeLocomotionInput(OwnerPawn);
+	}
+	// Inject the final directional intent into Mover's input buffer.
+	InputData.SetMoveInput(EMoveInputType::DirectionalIntent, DesiredMove);
+	InputData.OrientationIntent = DesiredOrientation;
+}
+
+
+UGCFLocomotionInputProducer::EGCFProviderCallMode UGCFLocomotionInputProducer::GetProviderCallMode(APawn* OwnerPawn)
+{
+	if (ProviderCallMode == EGCFProviderCallMode::Unresolved) {
+		ResolveProvider(OwnerPawn, GCF::LocomotionInputProducer::bUseNativeProvider);
+	}
+	return ProviderCallMode;
+}
+
+
+void UGCFLocomotionInputProducer::ResolveProvider(APawn* OwnerPawn, bool bAllowNative)
+{
+	NativeProvider = nullptr;
+	ProviderCallMode = EGCFProviderCallMode::None;
+
+	if (!OwnerPawn || !OwnerPawn->Implements<UGCFLocomotionInputProvider>()) {
+		return;
+	}
+
+	// Blueprint-only implementers have no native interface pointer.
+	IGCFLocomotionInputProvider* Interface = Cast<IGCFLocomotionInputProvider>(OwnerPawn);
+
+	bool bAllNative = bAllowNative && Interface != nullptr;
+	if (bAllNative) {
+		static const FName FunctionNames[] = {
+			GET_FUNCTION_NAME_CHECKED(IGCFLocomotionInputProvider, GetMovementIntent),
+			GET_FUNCTION_NAME_CHECKED(IGCFLocomotionInputProvider, GetOrientationIntent),
+			GET_FUNCTION_NAME_CHECKED(IGCFLocomotionInputProvider, GetIsJumpPressed),
+			GET_FUNCTION_NAME_CHECKED(IGCFLocomotionInputProvider, GetIsJumpJustPressed),
+			GET_FUNCTION_NAME_CHECKED(IGCFLocomotionInputProvider, ConsumeJumpJustPressed),
+			GET_FUNCTION_NAME_CHECKED(IGCFLocomotionInputProvider, GetWantsToCrouch),
+		};
+
+		// A Blueprint subclass overriding any of the events must go through Execute_.
+		for (const FName& FunctionName : FunctionNames) {
+			if (!GCF::LocomotionInputProducer::IsNativeFunction(OwnerPawn->GetClass(), FunctionName)) {
+				bAllNative = false;
+				break;
+			}
+		}
+	}
+
+	if (bAllNative) {
+		NativeProvider = Interface;
+		ProviderCallMode = EGCFProviderCallMode::Native;
+	} else {
+		ProviderCallMode = EGCFProviderCallMode::Reflected;
+	}
+}
+
+
+void UGCFLocomotionInputProducer::ReadLocomotionIntents(APawn* OwnerPawn, FVector& OutMove, FVector& OutOrientation, bool& bOutJumpPressed, bool& bOutJumpJustPressed)
+{
+	switch (GetProviderCallMode(OwnerPawn)) {
+		case EGCFProviderCallMode::Native:
+		{
+			OutMove = NativeProvider->GetMovementIntent_Implementation();
+			OutOrientation = NativeProvider->GetOrientationIntent_Implementation();
+			bOutJumpPressed = NativeProvider->GetIsJumpPressed_Implementation();
+			bOutJumpJustPressed = NativeProvider->GetIsJumpJustPressed_Implementation();
+
+			if (bOutJumpJustPressed) {
+				NativeProvider->ConsumeJumpJustPressed_Implementation();
+			}
+			break;
+		}
+		case EGCFProviderCallMode::Reflected:
+		{
 			// --- Movement Handling ---
-			DesiredMove = IGCFLocomotionInputProvider::Execute_GetMovementIntent(OwnerPawn);
+			OutMove = IGCFLocomotionInputProvider::Execute_GetMovementIntent(OwnerPawn);
 
 			// --- Orientation Handling ---
-			DesiredOrientation = IGCFLocomotionInputProvider::Execute_GetOrientationIntent(OwnerPawn);
+			OutOrientation = IGCFLocomotionInputProvider::Execute_GetOrientationIntent(OwnerPawn);
 
 			// --- Jump Handling ---
-			InputData.bIsJumpPressed = IGCFLocomotionInputProvider::Execute_GetIsJumpPressed(OwnerPawn);
-			InputData.bIsJumpJustPressed = IGCFLocomotionInputProvider::Execute_GetIsJumpJustPressed(OwnerPawn);
+			bOutJumpPressed = IGCFLocomotionInputProvider::Execute_GetIsJumpPressed(OwnerPawn);
+			bOutJumpJustPressed = IGCFLocomotionInputProvider::Execute_GetIsJumpJustPressed(OwnerPawn);
 
-			if (InputData.bIsJumpJustPressed) {
+			if (bOutJumpJustPressed) {
 				IGCFLocomotionInputProvider::Execute_ConsumeJumpJustPressed(OwnerPawn);
 			}
+			break;
 		}
+		default:
+			break;
 	}
-	// Inject the final directional intent into Mover's input buffer.
-	InputData.SetMoveInput(EMoveInputType::DirectionalIntent, DesiredMove);
-	InputData.OrientationIntent = DesiredOrientation;
-}
\ No newline at end of file
+}
+
+
+bool UGCFLocomotionInputProducer::ReadWantsToCrouch(APawn* OwnerPawn)
+{
+	switch (GetProviderCallMode(OwnerPawn)) {
+		case EGCFProviderCallMode::Native:
+			return NativeProvider->GetWantsToCrouch_Implementation();
+		case EGCFProviderCallMode::Reflected:
+			return IGCFLocomotionInputProvider::Execute_GetWantsToCrouch(OwnerPawn);
+		default:
+			return false;
+	}
+}
+
@@ -28,6 +28,7 @@
 #include "Player/GCFControllerPossessionComponent.h"
 #include "Input/GCFInputBindingManagerComponent.h"
 #include "Input/GCFPlayerInputBridgeComponent.h"
+#include "System/GCFInputLatencyTracker.h"
 #include "Input/GCFInputContextComponent.h"
 #include "Input/GCFAbilityInputRouterComponent.h"
 #include "System/Lifecycle/GCFPossessionContextComponent.h"
@@ -145,13 +146,11 @@ void AGCFPlayerController::BeginPlay()
 	Super::BeginPlay();
 
 	if (UWorld* World = GetWorld()) {
-		UGameplayMessageSubsystem& MessageSubsystem = UGameplayMessageSubsystem::Get(World);
-		MessageHandle = MakeUnique<FGCFMessageSubscription>(
-			World,
-			MessageSubsystem.RegisterListener<FGCFPolicyChangedCursorMessage>(
-			GCFGameplayTags::Message_PolicyChange_Cursor,
-			this,
-			&ThisClass::OnCameraModeMessageReceived));
+		if (UGCFNativeMessageSubsystem* MessageSubsystem = World->GetSubsystem<UGCFNativeMessageSubsystem>()) {
+			MessageHandle = MakeUnique<FGCFMessageSubscription>(
+				World,
+				MessageSubsystem->RegisterListener<FGCFPolicyChangedCursorMessage>(this, &ThisClass::OnCameraModeMessageReceived));
+		}
 	}
 }
 
@@ -408,6 +407,8 @@ void AGCFPlayerController::PostProcessInput(const float DeltaTime, const bool bG
 	{
 		GCFASC->ProcessAbilityInput(DeltaTime, bGamePaused);
 	}
+	// Presses that did not activate anything this frame are not ability latency samples.
+	FGCFInputLatencyTracker::ClearPendingAbilityInputs();
 
 	Super::PostProcessInput(DeltaTime, bGamePaused);
 }
@@ -558,7 +559,7 @@ void AGCFPlayerController::RemoveDelegate(const FDelegateHandle& Handle)
 }
 
 
-void AGCFPlayerController::OnCameraModeMessageReceived(FGameplayTag Channel, const FGCFPolicyChangedCursorMessage& Message)
+void AGCFPlayerController::OnCameraModeMessageReceived(const FGCFPolicyChangedCursorMessage& Message)
 {
 	if (Message.Controller == this) {
 		SetShowMouseCursor(Message.bShowCursor);
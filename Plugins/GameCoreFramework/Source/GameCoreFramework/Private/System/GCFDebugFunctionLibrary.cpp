@@ -5,10 +5,10 @@
 
 #include "GCFShared.h"
 #include "Common/GCFTypes.h"
+#include "System/GCFDebugSubsystem.h"
 #include "System/Lifecycle/GCFPawnReadyStateComponent.h"
 #include "System/Lifecycle/GCFPlayerReadyStateComponent.h"
 #include "Player/GCFControllerPossessionComponent.h"
-#include "GameFramework/GameplayMessageSubsystem.h"
 
 
 FText UGCFDebugFunctionLibrary::FormatLogMessage(EGCFDebugLogVerbosity InLogType, const FString& InMessage)
@@ -35,14 +35,25 @@ FText UGCFDebugFunctionLibrary::FormatLogMessage(EGCFDebugLogVerbosity InLogType
 }
 
 
-void UGCFDebugFunctionLibrary::SendLogMessage(const UObject* WorldContext, EGCFDebugLogVerbosity Type, const FString& Msg)
+bool UGCFDebugFunctionLibrary::IsDebugChannelActive(const UObject* WorldContext)
 {
 #if !UE_BUILD_SHIPPING
-    FGCFDebugLogEntry Payload;
-    Payload.LogType = Type;
-    Payload.Message = Msg;
+    if (const UGCFDebugSubsystem* DebugSubsystem = UGCFDebugSubsystem::Get(WorldContext)) {
+        return DebugSubsystem->HasDebugListeners();
+    }
+#endif
+    return false;
+}
 
-    UGameplayMessageSubsystem::Get(WorldContext).BroadcastMessage(GCFGameplayTags::Message_Debug_Log, Payload);
+
+void UGCFDebugFunctionLibrary::SendLogMessage(const UObject* WorldContext, EGCFDebugLogVerbosity Type, const FString& Msg)
+{
+#if !UE_BUILD_SHIPPING
+    if (UGCFDebugSubsystem* DebugSubsystem = UGCFDebugSubsystem::Get(WorldContext)) {
+        if (DebugSubsystem->HasDebugListeners()) {
+            DebugSubsystem->AddLogEntry(Type, Msg);
+        }
+    }
 #endif
 }
 
@@ -50,13 +61,18 @@ void UGCFDebugFunctionLibrary::SendLogMessage(const UObject* WorldContext, EGCFD
 void UGCFDebugFunctionLibrary::SendStateMessage(const UObject* WorldContext, EGCFDebugStateCategory Category, const FString& NewValue, const FLinearColor& DisplayColor)
 {
 #if !UE_BUILD_SHIPPING
+    UGCFDebugSubsystem* DebugSubsystem = UGCFDebugSubsystem::Get(WorldContext);
+    if (!DebugSubsystem || !DebugSubsystem->HasDebugListeners()) {
+        return;
+    }
+
     FGCFDebugStateEntry Payload;
     Payload.Category = Category;
     Payload.Label = GetEnumName(Category);
     Payload.Value = NewValue;
     Payload.DisplayColor = DisplayColor;
 
-    UGameplayMessageSubsystem::Get(WorldContext).BroadcastMessage(GCFGameplayTags::Message_Debug_State, Payload);
+    DebugSubsystem->PublishStateEntry(Payload);
 #endif
 }
 
@@ -64,13 +80,18 @@ void UGCFDebugFunctionLibrary::SendStateMessage(const UObject* WorldContext, EGC
 void UGCFDebugFunctionLibrary::SendPlayerStateBitMessage(const UObject* WorldContext, EGCFDebugStateCategory Category, EGCFPlayerReadyState State, const FLinearColor& DisplayColor)
 {
 #if !UE_BUILD_SHIPPING
+    UGCFDebugSubsystem* DebugSubsystem = UGCFDebugSubsystem::Get(WorldContext);
+    if (!DebugSubsystem || !DebugSubsystem->HasDebugListeners()) {
+        return;
+    }
+
     FGCFDebugStateEntry Payload;
     Payload.Category = Category;
     Payload.Label = GetEnumName(Category);
     Payload.Value = GetBitflagsString(State);
     Payload.DisplayColor = DisplayColor;
 
-    UGameplayMessageSubsystem::Get(WorldContext).BroadcastMessage(GCFGameplayTags::Message_Debug_State, Payload);
+    DebugSubsystem->PublishStateEntry(Payload);
 #endif
 }
 
@@ -78,12 +99,17 @@ void UGCFDebugFunctionLibrary::SendPlayerStateBitMessage(const UObject* WorldCon
 void UGCFDebugFunctionLibrary::SendPawnStateBitMessage(const UObject* WorldContext, EGCFDebugStateCategory Category, EGCFPawnReadyState State, const FLinearColor& DisplayColor)
 {
 #if !UE_BUILD_SHIPPING
+    UGCFDebugSubsystem* DebugSubsystem = UGCFDebugSubsystem::Get(WorldContext);
+    if (!DebugSubsystem || !DebugSubsystem->HasDebugListeners()) {
+        return;
+    }
+
     FGCFDebugStateEntry Payload;
     Payload.Category = Category;
     Payload.Label = GetEnumName(Category);
     Payload.Value = GetBitflagsString(State);
     Payload.DisplayColor = DisplayColor;
 
-    UGameplayMessageSubsystem::Get(WorldContext).BroadcastMessage(GCFGameplayTags::Message_Debug_State, Payload);
+    DebugSubsystem->PublishStateEntry(Payload);
 #endif
 }
\ No newline at end of file
@@ -0,0 +1,280 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "System/GCFDebugSubsystem.h"
+
+#include "GCFShared.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "GameFramework/GameplayMessageSubsystem.h"
+#include "Messages/GCFNativeMessageSubsystem.h"
+#include "System/GCFDebugFunctionLibrary.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GCFDebugSubsystem)
+
+
+namespace GCF::Debug
+{
+static bool bAlwaysBroadcast = false;
+static FAutoConsoleVariableRef CVarAlwaysBroadcast(
+	TEXT("GCF.Debug.AlwaysBroadcast"),
+	bAlwaysBroadcast,
+	TEXT("If true, debug messages are emitted even when no debug listener is registered, for consumers that cannot register (e.g. external tools).")
+);
+
+static float SnapshotRefreshRate = 4.0f;
+static FAutoConsoleVariableRef CVarSnapshotRefreshRate(
+	TEXT("GCF.Debug.SnapshotRefreshRate"),
+	SnapshotRefreshRate,
+	TEXT("Rate (Hz) at which changed debug snapshots are published to message-driven debug widgets. 0 disables publishing. Read at world begin play.")
+);
+
+static constexpr int32 MaxLogEntries = 64;
+
+/** Publishes on the typed native channel, then on the tag channel the Blueprint debug widgets listen on. */
+template<typename TMessage>
+static void PublishMessage(UGCFNativeMessageSubsystem* NativeSubsystem, UGameplayMessageSubsystem& MessageSubsystem, const FGameplayTag& Channel, const TMessage& Message)
+{
+	if (NativeSubsystem) {
+		NativeSubsystem->BroadcastMessage(Message);
+	}
+	MessageSubsystem.BroadcastMessage(Channel, Message);
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorld CmdDumpSnapshot(
+	TEXT("GCF.Debug.DumpSnapshot"),
+	TEXT("Logs the current debug state, input and log snapshot of the world."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World) {
+		if (UGCFDebugSubsystem* DebugSubsystem = UGCFDebugSubsystem::Get(World)) {
+			DebugSubsystem->DumpSnapshot();
+		}
+	})
+);
+#endif
+}
+
+
+UGCFDebugSubsystem* UGCFDebugSubsystem::Get(const UObject* WorldContextObject)
+{
+#if !UE_BUILD_SHIPPING
+	if (UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr) {
+		return World->GetSubsystem<UGCFDebugSubsystem>();
+	}
+#endif
+	return nullptr;
+}
+
+
+bool UGCFDebugSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if UE_BUILD_SHIPPING
+	return false;
+#else
+	return Super::ShouldCreateSubsystem(Outer);
+#endif
+}
+
+
+void UGCFDebugSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (GCF::Debug::SnapshotRefreshRate > 0.0f) {
+		InWorld.GetTimerManager().SetTimer(PublishTimerHandle, FTimerDelegate::CreateUObject(this, &ThisClass::PublishPendingEntries), 1.0f / GCF::Debug::SnapshotRefreshRate, true);
+	}
+}
+
+
+void UGCFDebugSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld()) {
+		World->GetTimerManager().ClearTimer(PublishTimerHandle);
+	}
+	StateSlots.Empty();
+	InputSlot = FGCFDebugInputSlot();
+	LogEntries.Empty();
+
+	Super::Deinitialize();
+}
+
+
+void UGCFDebugSubsystem::RegisterDebugListener(UObject* Listener)
+{
+	if (Listener) {
+		Listeners.AddUnique(Listener);
+	}
+}
+
+
+void UGCFDebugSubsystem::UnregisterDebugListener(UObject* Listener)
+{
+	Listeners.RemoveAll([Listener](const TWeakObjectPtr<UObject>& Entry) {
+		return !Entry.IsValid() || Entry.Get() == Listener;
+	});
+}
+
+
+bool UGCFDebugSubsystem::HasDebugListeners() const
+{
+	if (GCF::Debug::bAlwaysBroadcast) {
+		return true;
+	}
+
+	for (const TWeakObjectPtr<UObject>& Listener : Listeners) {
+		if (Listener.IsValid()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+
+void UGCFDebugSubsystem::AddLogEntry(EGCFDebugLogVerbosity Verbosity, const FString& Message)
+{
+	FGCFDebugLogEntry Entry;
+	Entry.LogType = Verbosity;
+	Entry.Message = Message;
+
+	// LogSequence counts every entry ever added; the slot is derived from it.
+	const int32 SlotIndex = LogSequence % GCF::Debug::MaxLogEntries;
+	if (LogEntries.IsValidIndex(SlotIndex)) {
+		LogEntries[SlotIndex] = MoveTemp(Entry);
+	} else {
+		LogEntries.Add(MoveTemp(Entry));
+	}
+	++LogSequence;
+}
+
+
+void UGCFDebugSubsystem::PublishStateEntry(const FGCFDebugStateEntry& Entry)
+{
+	GCF::Debug::PublishMessage(UGCFNativeMessageSubsystem::Get(this), UGameplayMessageSubsystem::Get(this), GCFGameplayTags::Message_Debug_State, Entry);
+}
+
+
+void UGCFDebugSubsystem::RefreshDirtySlots()
+{
+	for (TPair<EGCFDebugStateCategory, FGCFDebugStateSlot>& Pair : StateSlots) {
+		FGCFDebugStateSlot& Slot = Pair.Value;
+		if (!Slot.bDirty) {
+			continue;
+		}
+
+		Slot.bDirty = false;
+		if (Slot.ValueGetter.IsBound()) {
+			Slot.Cached.Category = Pair.Key;
+			Slot.Cached.Label = UGCFDebugFunctionLibrary::GetEnumName(Pair.Key);
+			Slot.Cached.Value = Slot.ValueGetter.Execute();
+			Slot.bPendingPublish = true;
+		}
+	}
+
+	if (InputSlot.bDirty) {
+		InputSlot.bDirty = false;
+		if (InputSlot.Builder.IsBound()) {
+			InputSlot.Cached.Groups.Reset();
+			InputSlot.Builder.Execute(InputSlot.Cached);
+			InputSlot.bPendingPublish = true;
+		}
+	}
+}
+
+
+TArray<FGCFDebugStateEntry> UGCFDebugSubsystem::GetStateSnapshot()
+{
+	RefreshDirtySlots();
+
+	TArray<FGCFDebugStateEntry> Entries;
+	Entries.Reserve(StateSlots.Num());
+	for (const TPair<EGCFDebugStateCategory, FGCFDebugStateSlot>& Pair : StateSlots) {
+		if (Pair.Value.Cached.Category != EGCFDebugStateCategory::None) {
+			Entries.Add(Pair.Value.Cached);
+		}
+	}
+	return Entries;
+}
+
+
+FGCFDebugInputSnapshot UGCFDebugSubsystem::GetInputSnapshot()
+{
+	RefreshDirtySlots();
+	return InputSlot.Cached;
+}
+
+
+TArray<FGCFDebugLogEntry> UGCFDebugSubsystem::GetLogEntriesSince(int32 Sequence, int32& OutLatestSequence) const
+{
+	OutLatestSequence = LogSequence;
+
+	// Entries older than the ring buffer capacity are gone.
+	const int32 FirstSequence = FMath::Max3(Sequence, LogSequence - GCF::Debug::MaxLogEntries, 0);
+
+	TArray<FGCFDebugLogEntry> Entries;
+	Entries.Reserve(LogSequence - FirstSequence);
+	for (int32 i = FirstSequence; i < LogSequence; ++i) {
+		Entries.Add(LogEntries[i % GCF::Debug::MaxLogEntries]);
+	}
+	return Entries;
+}
+
+
+void UGCFDebugSubsystem::PublishPendingEntries()
+{
+	if (!HasDebugListeners()) {
+		return;
+	}
+
+	RefreshDirtySlots();
+
+	UGCFNativeMessageSubsystem* NativeSubsystem = UGCFNativeMessageSubsystem::Get(this);
+	UGameplayMessageSubsystem& MessageSubsystem = UGameplayMessageSubsystem::Get(this);
+
+	for (TPair<EGCFDebugStateCategory, FGCFDebugStateSlot>& Pair : StateSlots) {
+		if (Pair.Value.bPendingPublish) {
+			Pair.Value.bPendingPublish = false;
+			GCF::Debug::PublishMessage(NativeSubsystem, MessageSubsystem, GCFGameplayTags::Message_Debug_State, Pair.Value.Cached);
+		}
+	}
+
+	if (InputSlot.bPendingPublish) {
+		InputSlot.bPendingPublish = false;
+		GCF::Debug::PublishMessage(NativeSubsystem, MessageSubsystem, GCFGameplayTags::Message_Debug_Input, InputSlot.Cached);
+	}
+
+	if (LastPublishedLogSequence != LogSequence) {
+		int32 LatestSequence = 0;
+		for (const FGCFDebugLogEntry& Entry : GetLogEntriesSince(LastPublishedLogSequence, LatestSequence)) {
+			GCF::Debug::PublishMessage(NativeSubsystem, MessageSubsystem, GCFGameplayTags::Message_Debug_Log, Entry);
+		}
+		LastPublishedLogSequence = LatestSequence;
+	}
+}
+
+
+void UGCFDebugSubsystem::DumpSnapshot()
+{
+	UE_LOG(LogGCFSystem, Display, TEXT("=== GCF Debug Snapshot ==="));
+
+	UE_LOG(LogGCFSystem, Display, TEXT("--- State ---"));
+	for (const FGCFDebugStateEntry& Entry : GetStateSnapshot()) {
+		UE_LOG(LogGCFSystem, Display, TEXT(" - %-20s %s"), *Entry.Label, *Entry.Value);
+	}
+
+	UE_LOG(LogGCFSystem, Display, TEXT("--- Input ---"));
+	for (const FGCFDebugInputGroup& Group : GetInputSnapshot().Groups) {
+		UE_LOG(LogGCFSystem, Display, TEXT(" > %s"), *Group.GroupName);
+		for (const FString& Binding : Group.ActiveBindings) {
+			UE_LOG(LogGCFSystem, Display, TEXT("    - %s"), *Binding);
+		}
+	}
+
+	UE_LOG(LogGCFSystem, Display, TEXT("--- Log ---"));
+	int32 LatestSequence = 0;
+	for (const FGCFDebugLogEntry& Entry : GetLogEntriesSince(0, LatestSequence)) {
+		UE_LOG(LogGCFSystem, Display, TEXT(" [%s] %s"), *UGCFDebugFunctionLibrary::GetEnumName(Entry.LogType), *Entry.Message);
+	}
+
+	UE_LOG(LogGCFSystem, Display, TEXT("=========================="));
+}
@@ -8,6 +8,7 @@
 #include "GameFramework/GameplayMessageSubsystem.h"
 #include "Experience/GCFExperienceManagerComponent.h"
 #include "Messages/GCFVerbMessage.h"
+#include "Messages/GCFVerbMessageHelpers.h"
 #include "Player/GCFPlayerState.h"
 #include "Net/UnrealNetwork.h"
 
@@ -113,6 +114,29 @@ void AGCFGameState::MulticastReliableMessageToClients_Implementation(const FGCFV
 	MulticastMessageToClients_Implementation(Message);
 }
 
+void AGCFGameState::SendMessageToRelevantClients(const FGCFVerbMessage& Message)
+{
+	if (!HasAuthority())
+	{
+		return;
+	}
+
+	if (Message.Relevancy == EGCFVerbMessageRelevancy::All)
+	{
+		MulticastMessageToClients(Message);
+		return;
+	}
+
+	for (APlayerState* PlayerState : PlayerArray)
+	{
+		AGCFPlayerState* GCFPlayerState = Cast<AGCFPlayerState>(PlayerState);
+		if (GCFPlayerState && UGCFVerbMessageHelpers::IsMessageRelevantToPlayer(Message, GCFPlayerState->GetPlayerController()))
+		{
+			GCFPlayerState->ClientBroadcastMessage(Message);
+		}
+	}
+}
+
 float AGCFGameState::GetServerFPS() const
 {
 	return ServerFPS;
@@ -0,0 +1,298 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "System/GCFInputLatencyTracker.h"
+
+#if GCF_WITH_INPUT_LATENCY
+
+#include "GCFShared.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.inl"
+#include "UObject/ObjectKey.h"
+
+
+DECLARE_STATS_GROUP(TEXT("GCF Input Latency"), STATGROUP_GCFInputLatency, STATCAT_Advanced);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Locomotion Intent (ms)"), STAT_GCFInputLatency_LocomotionMs, STATGROUP_GCFInputLatency);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Locomotion Intent (frames)"), STAT_GCFInputLatency_LocomotionFrames, STATGROUP_GCFInputLatency);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Ability Activation (ms)"), STAT_GCFInputLatency_AbilityMs, STATGROUP_GCFInputLatency);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ability Activation (frames)"), STAT_GCFInputLatency_AbilityFrames, STATGROUP_GCFInputLatency);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Server Ability Activation (ms)"), STAT_GCFInputLatency_ServerAbilityMs, STATGROUP_GCFInputLatency);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Server Ability Activation (frames)"), STAT_GCFInputLatency_ServerAbilityFrames, STATGROUP_GCFInputLatency);
+
+UE_TRACE_CHANNEL_DEFINE(GCFInputLatencyChannel)
+
+UE_TRACE_EVENT_BEGIN(GCFInputLatency, Sample)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint8, Stage)
+	UE_TRACE_EVENT_FIELD(uint32, Frames)
+	UE_TRACE_EVENT_FIELD(float, Milliseconds)
+UE_TRACE_EVENT_END()
+
+
+namespace GCF::InputLatency
+{
+static bool bEnabled = false;
+static FAutoConsoleVariableRef CVarEnabled(
+	TEXT("GCF.Input.Latency.Enable"),
+	bEnabled,
+	TEXT("If true, input events are timestamped and the latency until the simulation consumes them is recorded.")
+);
+
+static int32 MaxPendingFrames = 60;
+static FAutoConsoleVariableRef CVarMaxPendingFrames(
+	TEXT("GCF.Input.Latency.MaxPendingFrames"),
+	MaxPendingFrames,
+	TEXT("Locomotion stamps that were not consumed within this many frames are discarded without being reported.")
+);
+
+/** Upper bounds (exclusive) of the millisecond buckets. The last bucket collects everything above. */
+static constexpr double MillisecondBuckets[] = { 1.0, 2.0, 4.0, 8.0, 16.7, 33.3, 66.7 };
+static constexpr int32 NumMillisecondBuckets = UE_ARRAY_COUNT(MillisecondBuckets) + 1;
+
+/** Frame buckets 0..(NumFrameBuckets - 2); the last bucket collects everything above. */
+static constexpr int32 NumFrameBuckets = 8;
+
+struct FHistogram
+{
+	int32 FrameCounts[NumFrameBuckets] = {};
+	int32 MillisecondCounts[NumMillisecondBuckets] = {};
+	int32 SampleCount = 0;
+	double TotalMilliseconds = 0.0;
+	double MaxMilliseconds = 0.0;
+	uint64 MaxFrames = 0;
+
+	void Add(uint64 Frames, double Milliseconds)
+	{
+		FrameCounts[FMath::Min<uint64>(Frames, NumFrameBuckets - 1)]++;
+
+		int32 Bucket = 0;
+		while (Bucket < UE_ARRAY_COUNT(MillisecondBuckets) && Milliseconds >= MillisecondBuckets[Bucket]) {
+			++Bucket;
+		}
+		MillisecondCounts[Bucket]++;
+
+		SampleCount++;
+		TotalMilliseconds += Milliseconds;
+		MaxMilliseconds = FMath::Max(MaxMilliseconds, Milliseconds);
+		MaxFrames = FMath::Max(MaxFrames, Frames);
+	}
+};
+
+static FHistogram Histograms[(uint8)EGCFInputLatencyStage::Max];
+static TMap<FGameplayTag, FGCFInputTimestamp> PendingAbilityInputs;
+static TMap<FObjectKey, FGCFInputTimestamp> PendingLocomotionInputs;
+static FGCFInputTimestamp PendingServerAbilityRequest;
+static uint64 LastPruneFrame = 0;
+
+static const TCHAR* GetStageName(EGCFInputLatencyStage Stage)
+{
+	switch (Stage) {
+		case EGCFInputLatencyStage::LocomotionIntent:	return TEXT("LocomotionIntent");
+		case EGCFInputLatencyStage::AbilityActivation:	return TEXT("AbilityActivation");
+		case EGCFInputLatencyStage::ServerAbilityActivation:	return TEXT("ServerAbilityActivation");
+		default:										return TEXT("Unknown");
+	}
+}
+
+static FGCFInputTimestamp Now()
+{
+	return FGCFInputTimestamp{ FPlatformTime::Cycles64(), GFrameCounter };
+}
+
+static bool IsStale(const FGCFInputTimestamp& Stamp)
+{
+	return GFrameCounter - Stamp.Frame > (uint64)FMath::Max(MaxPendingFrames, 0);
+}
+
+/** Discards stale locomotion stamps. Runs at most once per frame. */
+static void PruneLocomotionInputs()
+{
+	if (LastPruneFrame == GFrameCounter) {
+		return;
+	}
+	LastPruneFrame = GFrameCounter;
+
+	for (auto It = PendingLocomotionInputs.CreateIterator(); It; ++It) {
+		if (IsStale(It.Value())) {
+			It.RemoveCurrent();
+		}
+	}
+}
+
+static void Report(EGCFInputLatencyStage Stage, const FGCFInputTimestamp& Start)
+{
+	const uint64 Frames = GFrameCounter - Start.Frame;
+	const double Milliseconds = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - Start.Cycles);
+
+	Histograms[(uint8)Stage].Add(Frames, Milliseconds);
+
+	switch (Stage) {
+		case EGCFInputLatencyStage::LocomotionIntent:
+			SET_FLOAT_STAT(STAT_GCFInputLatency_LocomotionMs, Milliseconds);
+			SET_DWORD_STAT(STAT_GCFInputLatency_LocomotionFrames, Frames);
+			break;
+		case EGCFInputLatencyStage::AbilityActivation:
+			SET_FLOAT_STAT(STAT_GCFInputLatency_AbilityMs, Milliseconds);
+			SET_DWORD_STAT(STAT_GCFInputLatency_AbilityFrames, Frames);
+			break;
+		case EGCFInputLatencyStage::ServerAbilityActivation:
+			SET_FLOAT_STAT(STAT_GCFInputLatency_ServerAbilityMs, Milliseconds);
+			SET_DWORD_STAT(STAT_GCFInputLatency_ServerAbilityFrames, Frames);
+			break;
+		default:
+			break;
+	}
+
+	UE_TRACE_LOG(GCFInputLatency, Sample, GCFInputLatencyChannel)
+		<< Sample.Cycle(FPlatformTime::Cycles64())
+		<< Sample.Stage((uint8)Stage)
+		<< Sample.Frames((uint32)Frames)
+		<< Sample.Milliseconds((float)Milliseconds);
+}
+
+static FAutoConsoleCommand CmdDump(
+	TEXT("GCF.Input.Latency.Dump"),
+	TEXT("Logs the input latency histogram of every stage."),
+	FConsoleCommandDelegate::CreateStatic(&FGCFInputLatencyTracker::DumpHistograms)
+);
+
+static FAutoConsoleCommand CmdReset(
+	TEXT("GCF.Input.Latency.Reset"),
+	TEXT("Clears the input latency histograms."),
+	FConsoleCommandDelegate::CreateStatic(&FGCFInputLatencyTracker::Reset)
+);
+}
+
+
+bool FGCFInputLatencyTracker::IsEnabled()
+{
+	return GCF::InputLatency::bEnabled;
+}
+
+
+void FGCFInputLatencyTracker::MarkAbilityInput(const FGameplayTag& InputTag)
+{
+	if (IsEnabled()) {
+		GCF::InputLatency::PendingAbilityInputs.Add(InputTag, GCF::InputLatency::Now());
+	}
+}
+
+
+void FGCFInputLatencyTracker::ReportAbilityActivation(const FGameplayTagContainer& InputTags)
+{
+	if (!IsEnabled() || GCF::InputLatency::PendingAbilityInputs.IsEmpty()) {
+		return;
+	}
+
+	for (const FGameplayTag& Tag : InputTags) {
+		FGCFInputTimestamp Start;
+		if (GCF::InputLatency::PendingAbilityInputs.RemoveAndCopyValue(Tag, Start)) {
+			GCF::InputLatency::Report(EGCFInputLatencyStage::AbilityActivation, Start);
+			return;
+		}
+	}
+}
+
+
+void FGCFInputLatencyTracker::ClearPendingAbilityInputs()
+{
+	GCF::InputLatency::PendingAbilityInputs.Reset();
+}
+
+
+void FGCFInputLatencyTracker::MarkLocomotionInput(const UObject* Pawn)
+{
+	if (IsEnabled() && Pawn) {
+		GCF::InputLatency::PruneLocomotionInputs();
+
+		// Keep the oldest unconsumed stamp.
+		GCF::InputLatency::PendingLocomotionInputs.FindOrAdd(FObjectKey(Pawn), GCF::InputLatency::Now());
+	}
+}
+
+
+void FGCFInputLatencyTracker::ConsumeLocomotionInput(const UObject* Pawn)
+{
+	if (!IsEnabled() || GCF::InputLatency::PendingLocomotionInputs.IsEmpty()) {
+		return;
+	}
+
+	FGCFInputTimestamp Start;
+	if (GCF::InputLatency::PendingLocomotionInputs.RemoveAndCopyValue(FObjectKey(Pawn), Start) && !GCF::InputLatency::IsStale(Start)) {
+		GCF::InputLatency::Report(EGCFInputLatencyStage::LocomotionIntent, Start);
+	}
+}
+
+
+void FGCFInputLatencyTracker::ForgetLocomotionInput(const UObject* Pawn)
+{
+	if (Pawn) {
+		GCF::InputLatency::PendingLocomotionInputs.Remove(FObjectKey(Pawn));
+	}
+}
+
+
+void FGCFInputLatencyTracker::MarkServerAbilityRequest()
+{
+	if (IsEnabled()) {
+		GCF::InputLatency::PendingServerAbilityRequest = GCF::InputLatency::Now();
+	}
+}
+
+
+void FGCFInputLatencyTracker::ReportServerAbilityActivation()
+{
+	if (IsEnabled() && GCF::InputLatency::PendingServerAbilityRequest.IsSet()) {
+		GCF::InputLatency::Report(EGCFInputLatencyStage::ServerAbilityActivation, GCF::InputLatency::PendingServerAbilityRequest);
+		GCF::InputLatency::PendingServerAbilityRequest = FGCFInputTimestamp();
+	}
+}
+
+
+void FGCFInputLatencyTracker::ClearServerAbilityRequest()
+{
+	GCF::InputLatency::PendingServerAbilityRequest = FGCFInputTimestamp();
+}
+
+
+void FGCFInputLatencyTracker::DumpHistograms()
+{
+	using namespace GCF::InputLatency;
+
+	UE_LOG(LogGCFSystem, Display, TEXT("=== GCF Input Latency ==="));
+	for (uint8 StageIndex = 0; StageIndex < (uint8)EGCFInputLatencyStage::Max; ++StageIndex) {
+		const FHistogram& Histogram = Histograms[StageIndex];
+		UE_LOG(LogGCFSystem, Display, TEXT("--- %s: %d samples, avg %.2f ms, max %.2f ms, max %llu frames ---"),
+			   GetStageName((EGCFInputLatencyStage)StageIndex), Histogram.SampleCount,
+			   Histogram.SampleCount > 0 ? Histogram.TotalMilliseconds / Histogram.SampleCount : 0.0, Histogram.MaxMilliseconds, Histogram.MaxFrames);
+
+		for (int32 i = 0; i < NumFrameBuckets; ++i) {
+			UE_LOG(LogGCFSystem, Display, TEXT("    %d%s frames: %d"), i, i == NumFrameBuckets - 1 ? TEXT("+") : TEXT(""), Histogram.FrameCounts[i]);
+		}
+		for (int32 i = 0; i < NumMillisecondBuckets; ++i) {
+			if (i < UE_ARRAY_COUNT(MillisecondBuckets)) {
+				UE_LOG(LogGCFSystem, Display, TEXT("    < %5.1f ms: %d"), MillisecondBuckets[i], Histogram.MillisecondCounts[i]);
+			} else {
+				UE_LOG(LogGCFSystem, Display, TEXT("   >= %5.1f ms: %d"), MillisecondBuckets[i - 1], Histogram.MillisecondCounts[i]);
+			}
+		}
+	}
+	UE_LOG(LogGCFSystem, Display, TEXT("========================="));
+}
+
+
+void FGCFInputLatencyTracker::Reset()
+{
+	using namespace GCF::InputLatency;
+
+	for (FHistogram& Histogram : Histograms) {
+		Histogram = FHistogram();
+	}
+	PendingAbilityInputs.Reset();
+	PendingLocomotionInputs.Reset();
+	PendingServerAbilityRequest = FGCFInputTimestamp();
+}
+
+#endif
@@ -9,6 +9,7 @@
 #include "System/Predicate/GCFGameplayTagPredicate.h"
 #include "Components/GameFrameworkComponentManager.h"
 #include "System/GCFDebugFunctionLibrary.h"
+#include "System/GCFDebugSubsystem.h"
 
 
 UGCFPawnReadyStateComponent::UGCFPawnReadyStateComponent(const FObjectInitializer& ObjectInitializer)
@@ -64,16 +65,24 @@ void UGCFPawnReadyStateComponent::Reevaluate()
 		OnReadyStateChangedBP.Broadcast(NewState);
 		OnReadyStateChangedNative.Broadcast(MakeSnapshot(NewState));
 
-		// Send debug message,
-		if (APawn* Pawn = GetPawn<APawn>()) {
-			if (Pawn->IsLocallyControlled()) {
-				UGCFDebugFunctionLibrary::SendPawnStateBitMessage(this, EGCFDebugStateCategory::ReadyStatePawn, NewState);
+		// Mark debug state dirty. Formatting is deferred until a debug consumer pulls the snapshot.
+		if (UGCFDebugSubsystem* DebugSubsystem = UGCFDebugSubsystem::Get(this)) {
+			if (APawn* Pawn = GetPawn<APawn>()) {
+				if (Pawn->IsLocallyControlled()) {
+					DebugSubsystem->MarkStateDirty(EGCFDebugStateCategory::ReadyStatePawn, this, &ThisClass::GetDebugStateValue);
+				}
 			}
 		}
 	}
 }
 
 
+FString UGCFPawnReadyStateComponent::GetDebugStateValue() const
+{
+	return UGCFDebugFunctionLibrary::GetBitflagsString(CachedState);
+}
+
+
 void UGCFPawnReadyStateComponent::HandleOnActorInitStateChanged(const FActorInitStateChangedParams& Params)
 {
 	Reevaluate();
@@ -9,6 +9,7 @@
 #include "System/Predicate/GCFGameplayTagPredicate.h"
 #include "Components/GameFrameworkComponentManager.h"
 #include "System/GCFDebugFunctionLibrary.h"
+#include "System/GCFDebugSubsystem.h"
 
 
 UGCFPlayerReadyStateComponent::UGCFPlayerReadyStateComponent(const FObjectInitializer& ObjectInitializer)
@@ -63,11 +64,13 @@ void UGCFPlayerReadyStateComponent::Reevaluate()
 		OnReadyStateChangedBP.Broadcast(NewState);
 		OnReadyStateChangedNative.Broadcast(MakeSnapshot(NewState));
 
-		// Send debug message.
-		if (APlayerState* PS = GetPlayerState<APlayerState>()) {
-			if (APlayerController* Controller = PS->GetPlayerController()) {
-				if (Controller->IsLocalController()) {
-					UGCFDebugFunctionLibrary::SendPlayerStateBitMessage(this, EGCFDebugStateCategory::ReadyStatePlayer, NewState);
+		// Mark debug state dirty. Formatting is deferred until a debug consumer pulls the snapshot.
+		if (UGCFDebugSubsystem* DebugSubsystem = UGCFDebugSubsystem::Get(this)) {
+			if (APlayerState* PS = GetPlayerState<APlayerState>()) {
+				if (APlayerController* Controller = PS->GetPlayerController()) {
+					if (Controller->IsLocalController()) {
+						DebugSubsystem->MarkStateDirty(EGCFDebugStateCategory::ReadyStatePlayer, this, &ThisClass::GetDebugStateValue);
+					}
 				}
 			}
 		}
@@ -75,6 +78,12 @@ void UGCFPlayerReadyStateComponent::Reevaluate()
 }
 
 
+FString UGCFPlayerReadyStateComponent::GetDebugStateValue() const
+{
+	return UGCFDebugFunctionLibrary::GetBitflagsString(CachedState);
+}
+
+
 void UGCFPlayerReadyStateComponent::HandleOnActorInitStateChanged(const FActorInitStateChangedParams& Params)
 {
 	Reevaluate();
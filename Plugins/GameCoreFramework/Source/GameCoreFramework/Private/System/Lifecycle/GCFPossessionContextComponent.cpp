@@ -9,6 +9,7 @@
 #include "System/Lifecycle/GCFStateFunctionLibrary.h"
 #include "System/Lifecycle/GCFGameFeatureFunctionLibrary.h"
 #include "System/GCFDebugFunctionLibrary.h"
+#include "System/GCFDebugSubsystem.h"
 #include "GameFramework/PlayerState.h"
 
 
@@ -57,12 +58,24 @@ void UGCFPossessionContextComponent::HandlePawnChanged(APawn* OldPawn, APawn* Ne
 	CheckAndUpdatePlayerPossessionState();
 
 	if (IsLocalController()) {
-		UGCFDebugFunctionLibrary::SendLogMessage(this, EGCFDebugLogVerbosity::Info, FString::Printf(TEXT("PawnChanged: %s to %s"), *GetNameSafe(OldPawn), *GetNameSafe(NewPawn)));
-		UGCFDebugFunctionLibrary::SendStateMessage(this, EGCFDebugStateCategory::Possession, *GetNameSafe(NewPawn));
+		if (UGCFDebugSubsystem* DebugSubsystem = UGCFDebugSubsystem::Get(this)) {
+			DebugSubsystem->MarkStateDirty(EGCFDebugStateCategory::Possession, this, &ThisClass::GetDebugStateValue);
+
+			if (DebugSubsystem->HasDebugListeners()) {
+				DebugSubsystem->AddLogEntry(EGCFDebugLogVerbosity::Info, FString::Printf(TEXT("PawnChanged: %s to %s"), *GetNameSafe(OldPawn), *GetNameSafe(NewPawn)));
+			}
+		}
 	}
 }
 
 
+FString UGCFPossessionContextComponent::GetDebugStateValue() const
+{
+	const AController* Controller = GetController<AController>();
+	return GetNameSafe(Controller ? Controller->GetPawn() : nullptr);
+}
+
+
 void UGCFPossessionContextComponent::CheckAndUpdatePlayerPossessionState()
 {
 	if (APlayerState* PlayerState = UGCFActorFunctionLibrary::ResolvePlayerState(this)) {
@@ -0,0 +1,87 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Animation/GCFAvatarAnimInstance.h"
+
+#include "Animation/GCFMoverAnimSnapshot.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/GCFMovementTestTypes.h"
+#include "Tests/GCFTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Reads the anim instance's gathered state. */
+struct FGCFAvatarAnimInstanceTestAccess
+{
+	static bool ReadsSnapshot(const UGCFAvatarAnimInstance& AnimInstance) { return AnimInstance.bReadSnapshot; }
+	static FVector GetVelocity(const UGCFAvatarAnimInstance& AnimInstance) { return AnimInstance.Velocity; }
+	static float GetGroundSpeed(const UGCFAvatarAnimInstance& AnimInstance) { return AnimInstance.GroundSpeed; }
+};
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFAvatarAnimSnapshotFallbackTest, "GameCoreFramework.Animation.AvatarAnimInstance.SnapshotFallback",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFAvatarAnimSnapshotFallbackTest::RunTest(const FString& Parameters)
+{
+	using namespace GCF::Tests;
+
+	FScopedTestWorld World(true);
+	SpawnTestFloor(World.Get());
+
+	AGCFTestMoverPawn* Pawn = World->SpawnActor<AGCFTestMoverPawn>(FVector(0.0, 0.0, 100.0), FRotator::ZeroRotator);
+	AGCFTestMoverPawn* UnwatchedPawn = World->SpawnActor<AGCFTestMoverPawn>(FVector(500.0, 0.0, 100.0), FRotator::ZeroRotator);
+	if (!TestNotNull(TEXT("Test pawn spawned"), Pawn) || !TestNotNull(TEXT("Unwatched pawn spawned"), UnwatchedPawn)) {
+		return false;
+	}
+	Pawn->MoveIntent = FVector::ForwardVector;
+	TestFalse(TEXT("The Mover component has no tick of its own"), Pawn->MoverComponent->PrimaryComponentTick.bCanEverTick);
+
+	USkeletalMeshComponent* Mesh = NewObject<USkeletalMeshComponent>(Pawn);
+	Mesh->SetupAttachment(Pawn->GetRootComponent());
+	Mesh->RegisterComponent();
+	UGCFAvatarAnimInstance* AnimInstance = NewObject<UGCFAvatarAnimInstance>(Mesh);
+	AnimInstance->NativeInitializeAnimation();
+
+	const FGCFMoverAnimSnapshotBuffer& SnapshotBuffer = Pawn->MoverComponent->GetAnimSnapshotBuffer();
+	TestTrue(TEXT("The anim instance registers as a reader"), SnapshotBuffer.HasReaders());
+
+	// Land and start walking.
+	World.Tick(30);
+	TestFalse(TEXT("A pawn without a reader never publishes"), UnwatchedPawn->MoverComponent->GetAnimSnapshotBuffer().HasSnapshot());
+
+	// Updated in the frame Mover finalized, the worker thread reads the snapshot.
+	++GFrameCounter;
+	World->Tick(LEVELTICK_All, 1.0f / 60.0f);
+	TestTrue(TEXT("Snapshot published this frame"), SnapshotBuffer.IsPublishedInFrame(GFrameCounter));
+	AnimInstance->NativeUpdateAnimation(1.0f / 60.0f);
+	AnimInstance->NativeThreadSafeUpdateAnimation(1.0f / 60.0f);
+	TestTrue(TEXT("Current snapshot is read"), FGCFAvatarAnimInstanceTestAccess::ReadsSnapshot(*AnimInstance));
+	TestEqual(TEXT("Snapshot velocity"), FGCFAvatarAnimInstanceTestAccess::GetVelocity(*AnimInstance), SnapshotBuffer.Read().Velocity);
+	TestTrue(TEXT("Pawn is walking"), FGCFAvatarAnimInstanceTestAccess::GetGroundSpeed(*AnimInstance) > 10.0f);
+
+	// In a frame Mover did not finalize, the snapshot is stale and the data is gathered directly.
+	++GFrameCounter;
+	AnimInstance->NativeUpdateAnimation(1.0f / 60.0f);
+	AnimInstance->NativeThreadSafeUpdateAnimation(1.0f / 60.0f);
+	TestFalse(TEXT("Stale snapshot is not read"), FGCFAvatarAnimInstanceTestAccess::ReadsSnapshot(*AnimInstance));
+	TestEqual(TEXT("Velocity gathered from the Mover component"), FGCFAvatarAnimInstanceTestAccess::GetVelocity(*AnimInstance), Pawn->MoverComponent->GetVelocity());
+
+	// The next finalized frame publishes again.
+	++GFrameCounter;
+	World->Tick(LEVELTICK_All, 1.0f / 60.0f);
+	AnimInstance->NativeUpdateAnimation(1.0f / 60.0f);
+	TestTrue(TEXT("Snapshot is read again"), FGCFAvatarAnimInstanceTestAccess::ReadsSnapshot(*AnimInstance));
+
+	// Without a reader, the component stops publishing.
+	AnimInstance->NativeUninitializeAnimation();
+	TestFalse(TEXT("The anim instance unregisters"), SnapshotBuffer.HasReaders());
+	++GFrameCounter;
+	World->Tick(LEVELTICK_All, 1.0f / 60.0f);
+	TestFalse(TEXT("Nothing is published without a reader"), SnapshotBuffer.IsPublishedInFrame(GFrameCounter));
+
+	return true;
+}
+
+#endif
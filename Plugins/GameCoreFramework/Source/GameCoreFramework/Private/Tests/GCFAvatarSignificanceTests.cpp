@@ -0,0 +1,54 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Animation/GCFAvatarSignificanceSubsystem.h"
+
+#include "Actor/Avatar/GCFAvatarPawn.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/GCFTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFAvatarSignificanceTierTest, "GameCoreFramework.Animation.AvatarSignificance.Tiers",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFAvatarSignificanceTierTest::RunTest(const FString& Parameters)
+{
+	using namespace GCF::Tests;
+
+	FScopedConsoleVariable Enable(TEXT("GCF.Anim.Significance.Enable"), TEXT("1"));
+
+	FScopedTestWorld World(true);
+	UGCFAvatarSignificanceSubsystem* SignificanceSubsystem = World->GetSubsystem<UGCFAvatarSignificanceSubsystem>();
+	AGCFAvatarPawn* Avatar = World->SpawnActor<AGCFAvatarPawn>();
+	if (!TestNotNull(TEXT("Significance subsystem"), SignificanceSubsystem) || !TestNotNull(TEXT("Avatar spawned"), Avatar)
+		|| !TestNotNull(TEXT("Avatar mesh"), Avatar->GetSkeletalMeshComponent())) {
+		return false;
+	}
+	USkeletalMeshComponent* Mesh = Avatar->GetSkeletalMeshComponent();
+	const EVisibilityBasedAnimTickOption DefaultTickOption = Mesh->VisibilityBasedAnimTickOption;
+
+	// A standalone world without a local player is not a dedicated server; nothing is throttled.
+	SignificanceSubsystem->EvaluateSignificance();
+	TestEqual(TEXT("No local view outside a dedicated server keeps the full tier"), Avatar->GetAnimUpdateTier(), EGCFAnimUpdateTier::Full);
+
+	// The authority keeps the pose of far avatars current for hit detection.
+	Avatar->SetGCFSignificance(0.0f, EGCFAnimUpdateTier::Minimal);
+	TestEqual(TEXT("Minimal tier on the authority keeps the pose ticking"), Mesh->VisibilityBasedAnimTickOption, DefaultTickOption);
+	TestEqual(TEXT("Minimal tier lowers the mesh tick rate"), Mesh->GetComponentTickInterval(), UGCFAvatarSignificanceSubsystem::GetTierTickInterval(EGCFAnimUpdateTier::Minimal));
+
+	// A client only skips the pose of avatars it does not render.
+	Avatar->SetGCFSignificance(1.0f, EGCFAnimUpdateTier::Full);
+	Avatar->SetRole(ROLE_SimulatedProxy);
+	Avatar->SetGCFSignificance(0.0f, EGCFAnimUpdateTier::Minimal);
+	TestEqual(TEXT("Minimal tier on a client skips unrendered poses"), Mesh->VisibilityBasedAnimTickOption, EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered);
+
+	Avatar->SetGCFSignificance(1.0f, EGCFAnimUpdateTier::Full);
+	TestEqual(TEXT("Full tier restores the tick option"), Mesh->VisibilityBasedAnimTickOption, DefaultTickOption);
+	Avatar->SetRole(ROLE_Authority);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,187 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Tests/GCFMovementTestTypes.h"
+
+#include "Components/CapsuleComponent.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/GCFTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Reaches the component's ground trace internals so traces can be issued and inspected directly. */
+struct FGCFCharacterMovementComponentTestAccess
+{
+	/** Runs one synchronous ground trace as GetGroundInfo builds it. Returns the ground distance, or a negative value without a hit. */
+	static double TraceGroundDistance(UGCFCharacterMovementComponent& Component, bool bFixedLength)
+	{
+		UGCFCharacterMovementComponent::FGroundTraceRequest Request;
+		Component.BuildGroundTrace(Request, bFixedLength);
+
+		FHitResult HitResult;
+		if (!Component.GetWorld()->LineTraceSingleByChannel(HitResult, Request.Start, Request.End, Request.CollisionChannel, Request.QueryParams, Request.ResponseParams)) {
+			return -1.0;
+		}
+		return HitResult.Distance - Request.CapsuleHalfHeight;
+	}
+
+	/** Issues an async ground trace without a result delegate, to time the game-thread cost of issuing alone. */
+	static void IssueAsyncTrace(UGCFCharacterMovementComponent& Component)
+	{
+		UGCFCharacterMovementComponent::FGroundTraceRequest Request;
+		Component.BuildGroundTrace(Request);
+		Component.GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Single, Request.Start, Request.End, Request.CollisionChannel, Request.QueryParams, Request.ResponseParams);
+	}
+
+	static bool HasAsyncResult(const UGCFCharacterMovementComponent& Component)
+	{
+		return Component.AsyncGroundTraceFrame != 0;
+	}
+
+	static bool HasPendingAsyncTrace(const UGCFCharacterMovementComponent& Component)
+	{
+		return Component.GetWorld()->IsTraceHandleValid(Component.PendingGroundTraceHandle, false);
+	}
+};
+
+
+namespace GCF::Tests
+{
+static constexpr int32 GroundTraceCharacterCount = 1000;
+static constexpr int32 GroundTraceRounds = 20;
+
+/** Height of the capsule bottom above the floor when a character is spawned. */
+static constexpr double GroundTraceSpawnHeight = 500.0;
+
+/** GroundDistance reported without a ground hit. */
+static constexpr float NoGroundDistance = 100000.0f;
+
+/** Spawns a falling character whose capsule bottom is Height above the floor. */
+static AGCFTestCharacter* SpawnFallingCharacter(UWorld* World, const FVector2D& Position, double Height)
+{
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AGCFTestCharacter* Character = World->SpawnActor<AGCFTestCharacter>(FVector(Position, 0.0), FRotator::ZeroRotator, SpawnParameters);
+	if (Character) {
+		const double HalfHeight = Character->GetCapsuleComponent()->GetUnscaledCapsuleHalfHeight();
+		Character->SetActorLocation(FVector(Position, Height + HalfHeight));
+		Character->GetCharacterMovement()->SetMovementMode(MOVE_Falling);
+		Character->GetCharacterMovement()->Velocity = FVector(0.0, 0.0, -800.0);
+	}
+	return Character;
+}
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFCharacterGroundInfoTest, "GameCoreFramework.Movement.Character.GroundInfo",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFCharacterGroundInfoTest::RunTest(const FString& Parameters)
+{
+	using namespace GCF::Tests;
+
+	FScopedTestWorld World(true);
+	SpawnTestFloor(World.Get());
+
+	FScopedConsoleVariable AsyncTrace(TEXT("GCF.Character.AsyncGroundTrace"), TEXT("0"));
+	FScopedConsoleVariable MaxStaleFrames(TEXT("GCF.Character.AsyncGroundTraceMaxStaleFrames"), TEXT("4"));
+
+	AGCFTestCharacter* Near = SpawnFallingCharacter(World.Get(), FVector2D(0.0, 0.0), GroundTraceSpawnHeight);
+	AGCFTestCharacter* Far = SpawnFallingCharacter(World.Get(), FVector2D(500.0, 0.0), 50000.0);
+	AGCFTestCharacter* NoReuse = SpawnFallingCharacter(World.Get(), FVector2D(1000.0, 0.0), GroundTraceSpawnHeight);
+	if (!TestNotNull(TEXT("Near character"), Near) || !TestNotNull(TEXT("Far character"), Far) || !TestNotNull(TEXT("No-reuse character"), NoReuse)) {
+		return false;
+	}
+
+	// Synchronous trace: the distance to the floor, or the sentinel when the adaptive trace ends in the air.
+	++GFrameCounter;
+	TestEqual(TEXT("Sync ground distance"), Near->GetGCFMovement()->GetGroundInfo().GroundDistance, (float)GroundTraceSpawnHeight, 1.0f);
+	TestEqual(TEXT("No hit reports the no-ground sentinel"), Far->GetGCFMovement()->GetGroundInfo().GroundDistance, NoGroundDistance);
+
+	// Async trace: the previous result, corrected by the fall since it was issued, matches a fresh trace.
+	AsyncTrace.Set(TEXT("1"));
+	++GFrameCounter;
+	Near->GetGCFMovement()->GetGroundInfo();
+	World.Tick(2);
+
+	if (TestTrue(TEXT("Async result arrived"), FGCFCharacterMovementComponentTestAccess::HasAsyncResult(*Near->GetGCFMovement()))) {
+		const float AsyncDistance = Near->GetGCFMovement()->GetGroundInfo().GroundDistance;
+		const double FreshDistance = FGCFCharacterMovementComponentTestAccess::TraceGroundDistance(*Near->GetGCFMovement(), false);
+		TestTrue(TEXT("Character fell between the async trace and its use"), FreshDistance < GroundTraceSpawnHeight - 1.0);
+		TestEqual(TEXT("Corrected async distance matches a fresh trace"), (double)AsyncDistance, FreshDistance, 0.5);
+	}
+
+	// A staleness limit of 0 disables the async path instead of being raised to 1.
+	MaxStaleFrames.Set(TEXT("0"));
+	++GFrameCounter;
+	NoReuse->GetGCFMovement()->GetGroundInfo();
+	TestFalse(TEXT("No async trace is issued with a staleness limit of 0"), FGCFCharacterMovementComponentTestAccess::HasPendingAsyncTrace(*NoReuse->GetGCFMovement()));
+
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFCharacterGroundTraceBenchmarkTest, "GameCoreFramework.Movement.Character.GroundTraceBenchmark",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFCharacterGroundTraceBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace GCF::Tests;
+
+	FScopedTestWorld World(true);
+	SpawnTestFloor(World.Get());
+
+	// A falling crowd on a grid, far enough apart not to hit each other.
+	const int32 GridSize = FMath::CeilToInt(FMath::Sqrt((float)GroundTraceCharacterCount));
+	TArray<UGCFCharacterMovementComponent*> Components;
+	for (int32 i = 0; i < GroundTraceCharacterCount; ++i) {
+		const FVector2D Position((i % GridSize) * 200.0, (i / GridSize) * 200.0);
+		AGCFTestCharacter* Character = SpawnFallingCharacter(World.Get(), Position, GroundTraceSpawnHeight);
+		if (!TestNotNull(TEXT("Character spawned"), Character)) {
+			return false;
+		}
+		Components.Add(Character->GetGCFMovement());
+	}
+
+	int32 AdaptiveHits = 0;
+	for (UGCFCharacterMovementComponent* Component : Components) {
+		AdaptiveHits += FGCFCharacterMovementComponentTestAccess::TraceGroundDistance(*Component, false) >= 0.0 ? 1 : 0;
+	}
+	TestEqual(TEXT("Every adaptive trace reaches the floor"), AdaptiveHits, Components.Num());
+
+	auto MeasureSync = [&Components](bool bFixedLength) {
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Round = 0; Round < GroundTraceRounds; ++Round) {
+			for (UGCFCharacterMovementComponent* Component : Components) {
+				FGCFCharacterMovementComponentTestAccess::TraceGroundDistance(*Component, bFixedLength);
+			}
+		}
+		return FPlatformTime::Seconds() - StartTime;
+	};
+
+	const double FixedSeconds = MeasureSync(true);
+	const double AdaptiveSeconds = MeasureSync(false);
+
+	// Only the game-thread cost of issuing is measured; the world tick afterwards completes and discards the traces.
+	double AsyncSeconds = 0.0;
+	for (int32 Round = 0; Round < GroundTraceRounds; ++Round) {
+		const double StartTime = FPlatformTime::Seconds();
+		for (UGCFCharacterMovementComponent* Component : Components) {
+			FGCFCharacterMovementComponentTestAccess::IssueAsyncTrace(*Component);
+		}
+		AsyncSeconds += FPlatformTime::Seconds() - StartTime;
+		World.Tick();
+	}
+
+	const int32 TraceCount = Components.Num() * GroundTraceRounds;
+	AddInfo(FString::Printf(TEXT("%d falling characters x %d rounds. Sync fixed: %.3f ms (%.3f us/trace), sync adaptive: %.3f ms (%.3f us/trace), async issue: %.3f ms (%.3f us/trace)"),
+		Components.Num(), GroundTraceRounds,
+		FixedSeconds * 1000.0, FixedSeconds * 1e6 / TraceCount,
+		AdaptiveSeconds * 1000.0, AdaptiveSeconds * 1e6 / TraceCount,
+		AsyncSeconds * 1000.0, AsyncSeconds * 1e6 / TraceCount));
+	return true;
+}
+
+#endif
@@ -0,0 +1,166 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Movement/Mover/GCFCrowdMovementSubsystem.h"
+
+#include "Misc/AutomationTest.h"
+#include "Tests/GCFMovementTestTypes.h"
+#include "Tests/GCFTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GCF::Tests
+{
+static constexpr int32 CrowdLaneCount = 8;
+static constexpr double CrowdLaneSpacing = 400.0;
+
+/** Distance along Y between a standard pawn and its crowd counterpart. */
+static constexpr double CrowdLaneOffset = CrowdLaneCount * CrowdLaneSpacing + CrowdLaneSpacing;
+
+static constexpr int32 CrowdFrameCount = 240;
+static constexpr double CrowdLocationTolerance = 1.0;
+static constexpr double CrowdVelocityTolerance = 1.0;
+
+/**
+ * Builds an 8 degree ramp running up along +X that ends in a ledge at X ~ 785 (Z ~ 111),
+ * above a flat floor at Z = -400. The geometry does not change along Y, so every lane sees the same ground.
+ */
+static void SpawnCrowdTestGround(UWorld* World)
+{
+	SpawnTestBox(World, FVector(0.0, 0.0, -50.0), FVector(800.0, 2.0 * CrowdLaneOffset, 50.0), FRotator(8.0, 0.0, 0.0));
+	SpawnTestBox(World, FVector(0.0, 0.0, -450.0), FVector(100000.0, 100000.0, 50.0));
+}
+
+template <typename PawnType>
+static PawnType* SpawnWalkingPawn(UWorld* World, double LaneY)
+{
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	PawnType* Pawn = World->SpawnActor<PawnType>(FVector(-600.0, LaneY, 100.0), FRotator::ZeroRotator, SpawnParameters);
+	if (Pawn) {
+		Pawn->MoveIntent = FVector::ForwardVector;
+	}
+	return Pawn;
+}
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFCrowdWalkingEquivalenceTest, "GameCoreFramework.Movement.CrowdWalking.Equivalence",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFCrowdWalkingEquivalenceTest::RunTest(const FString& Parameters)
+{
+	using namespace GCF::Tests;
+
+	FScopedConsoleVariable Enable(TEXT("GCF.Mover.Crowd.Enable"), TEXT("1"));
+
+	FScopedTestWorld World(true);
+	SpawnCrowdTestGround(World.Get());
+
+	UGCFCrowdMovementSubsystem* CrowdSubsystem = World->GetSubsystem<UGCFCrowdMovementSubsystem>();
+	if (!TestNotNull(TEXT("Crowd subsystem"), CrowdSubsystem)) {
+		return false;
+	}
+
+	// Every standard pawn walks up the ramp and off the ledge next to a crowd pawn doing the same.
+	TArray<AGCFTestMoverPawn*> StandardPawns;
+	TArray<AGCFTestCrowdPawn*> CrowdPawns;
+	for (int32 Lane = 0; Lane < CrowdLaneCount; ++Lane) {
+		const double LaneY = -CrowdLaneOffset + Lane * CrowdLaneSpacing;
+		StandardPawns.Add(SpawnWalkingPawn<AGCFTestMoverPawn>(World.Get(), LaneY));
+		CrowdPawns.Add(SpawnWalkingPawn<AGCFTestCrowdPawn>(World.Get(), LaneY + CrowdLaneOffset));
+		if (!TestNotNull(TEXT("Standard pawn spawned"), StandardPawns.Last()) || !TestNotNull(TEXT("Crowd pawn spawned"), CrowdPawns.Last())) {
+			return false;
+		}
+	}
+
+	const uint64 StartBatchedSteps = CrowdSubsystem->GetBatchedStepCount();
+	const uint64 StartFallbackSteps = CrowdSubsystem->GetFallbackStepCount();
+	const FVector Offset(0.0, CrowdLaneOffset, 0.0);
+
+	double MaxLocationError = 0.0;
+	double MaxVelocityError = 0.0;
+	int32 MismatchCount = 0;
+	for (int32 Frame = 0; Frame < CrowdFrameCount; ++Frame) {
+		World.Tick();
+
+		for (int32 Lane = 0; Lane < CrowdLaneCount; ++Lane) {
+			const UGCFCharacterMoverComponent* Standard = StandardPawns[Lane]->MoverComponent;
+			const UGCFCharacterMoverComponent* Crowd = CrowdPawns[Lane]->MoverComponent;
+
+			const double LocationError = FVector::Dist(StandardPawns[Lane]->GetActorLocation() + Offset, CrowdPawns[Lane]->GetActorLocation());
+			const double VelocityError = FVector::Dist2D(Standard->GetVelocity(), Crowd->GetVelocity());
+			MaxLocationError = FMath::Max(MaxLocationError, LocationError);
+			MaxVelocityError = FMath::Max(MaxVelocityError, VelocityError);
+			if (LocationError > CrowdLocationTolerance || VelocityError > CrowdVelocityTolerance) {
+				++MismatchCount;
+			}
+		}
+	}
+
+	const uint64 BatchedSteps = CrowdSubsystem->GetBatchedStepCount() - StartBatchedSteps;
+	const uint64 FallbackSteps = CrowdSubsystem->GetFallbackStepCount() - StartFallbackSteps;
+	AddInfo(FString::Printf(TEXT("%d lanes, %d frames: %llu batched and %llu standard crowd steps. Location error max %.3f cm, horizontal velocity error max %.3f cm/s."),
+		CrowdLaneCount, CrowdFrameCount, BatchedSteps, FallbackSteps, MaxLocationError, MaxVelocityError));
+
+	// The comparison only means something if both paths were exercised: the ramp by the batched step, the ledge by the fallback.
+	TestTrue(TEXT("Crowd pawns moved on the batched floor"), BatchedSteps > 0);
+	TestTrue(TEXT("Crowd pawns fell back at the ledge"), FallbackSteps > 0);
+	TestTrue(TEXT("Standard pawns walked off the ledge"), StandardPawns[0]->GetActorLocation().X > 1000.0 && StandardPawns[0]->GetActorLocation().Z < -200.0);
+	TestEqual(TEXT("Frames where a crowd pawn differs from its standard counterpart"), MismatchCount, 0);
+
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFCrowdWalkingProbeTrustTest, "GameCoreFramework.Movement.CrowdWalking.ProbeTrust",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFCrowdWalkingProbeTrustTest::RunTest(const FString& Parameters)
+{
+	using namespace GCF::Tests;
+
+	FScopedConsoleVariable Enable(TEXT("GCF.Mover.Crowd.Enable"), TEXT("1"));
+	FScopedConsoleVariable MaxProbeOffset(TEXT("GCF.Mover.Crowd.MaxProbeOffset"), TEXT("5"));
+
+	FScopedTestWorld World(true);
+	SpawnTestFloor(World.Get());
+
+	UGCFCrowdMovementSubsystem* CrowdSubsystem = World->GetSubsystem<UGCFCrowdMovementSubsystem>();
+	AGCFTestCrowdPawn* Pawn = SpawnWalkingPawn<AGCFTestCrowdPawn>(World.Get(), 0.0);
+	if (!TestNotNull(TEXT("Crowd subsystem"), CrowdSubsystem) || !TestNotNull(TEXT("Crowd pawn spawned"), Pawn)) {
+		return false;
+	}
+
+	// Land and reach walking speed.
+	World.Tick(60);
+	const FGCFCrowdFloor* Floor = CrowdSubsystem->FindFloor(Pawn->MoverComponent);
+	if (!TestNotNull(TEXT("Floor probed"), Floor)) {
+		return false;
+	}
+	TestEqual(TEXT("Probe is from the previous frame"), GFrameCounter - Floor->Frame, uint64(1));
+	TestEqual(TEXT("Solved center height"), Floor->GetCenterHeight(Pawn->GetActorLocation()), 88.0 + FGCFCrowdFloor::FloorDistance, 0.01);
+
+	uint64 BatchedSteps = CrowdSubsystem->GetBatchedStepCount();
+	World.Tick(10);
+	TestTrue(TEXT("Steps near the probe use the batched floor"), CrowdSubsystem->GetBatchedStepCount() > BatchedSteps);
+
+	// With no trust radius, every step has to run the standard floor check.
+	MaxProbeOffset.Set(TEXT("0"));
+	BatchedSteps = CrowdSubsystem->GetBatchedStepCount();
+	const uint64 FallbackSteps = CrowdSubsystem->GetFallbackStepCount();
+	World.Tick(10);
+	TestEqual(TEXT("No batched step beyond the trust radius"), CrowdSubsystem->GetBatchedStepCount(), BatchedSteps);
+	TestTrue(TEXT("Steps beyond the trust radius fall back"), CrowdSubsystem->GetFallbackStepCount() > FallbackSteps);
+
+	// Disabled, the crowd mode is plain walking.
+	Enable.Set(TEXT("0"));
+	BatchedSteps = CrowdSubsystem->GetBatchedStepCount();
+	World.Tick(10);
+	TestEqual(TEXT("No batched step while disabled"), CrowdSubsystem->GetBatchedStepCount(), BatchedSteps);
+
+	return true;
+}
+
+#endif
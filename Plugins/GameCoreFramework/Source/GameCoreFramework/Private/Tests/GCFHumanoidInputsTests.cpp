@@ -0,0 +1,160 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Movement/Mover/Input/GCFHumanoidInputs.h"
+
+#include "Misc/AutomationTest.h"
+#include "UObject/CoreNet.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GCF::Tests
+{
+/** Input send rate from Config/DefaultNetworkPrediction.ini (FixedTickFrameRate x IndependentTickInputSendCount). */
+static constexpr int32 InputTickRate = 60;
+static constexpr int32 InputSendCount = 6;
+
+/** Largest error a 16-bit fixed unit component may introduce. */
+static constexpr double UnitVectorTolerance = 1.0e-3;
+
+/** Largest error of a compressed-short rotator component, in degrees. */
+static constexpr double RotationTolerance = 0.01;
+
+template<typename TInputs>
+static int64 MeasureBits(const TInputs& Inputs)
+{
+	TInputs WriteCopy = Inputs;
+	FNetBitWriter Writer(nullptr, 1024);
+	bool bSuccess = false;
+	WriteCopy.NetSerialize(Writer, nullptr, bSuccess);
+	return Writer.GetNumBits();
+}
+
+static bool RoundTrip(const FGCFHumanoidInputs& Source, FGCFHumanoidInputs& OutResult)
+{
+	FGCFHumanoidInputs WriteCopy = Source;
+	FNetBitWriter Writer(nullptr, 1024);
+	bool bWriteSuccess = false;
+	WriteCopy.NetSerialize(Writer, nullptr, bWriteSuccess);
+
+	FNetBitReader Reader(nullptr, Writer.GetData(), Writer.GetNumBits());
+	bool bReadSuccess = false;
+	OutResult.NetSerialize(Reader, nullptr, bReadSuccess);
+
+	return bWriteSuccess && bReadSuccess && !Reader.IsError() && Reader.AtEnd();
+}
+
+static FGCFHumanoidInputs MakeMovingInputs()
+{
+	FGCFHumanoidInputs Inputs;
+	Inputs.SetMoveInput(EMoveInputType::DirectionalIntent, FVector(0.6, -0.8, 0.0));
+	Inputs.OrientationIntent = FVector(0.6, -0.8, 0.0);
+	Inputs.ControlRotation = FRotator(-12.5, 143.0, 0.0);
+	return Inputs;
+}
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFHumanoidInputsRoundTripTest, "GameCoreFramework.Movement.HumanoidInputs.RoundTrip",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFHumanoidInputsRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace GCF::Tests;
+
+	FGCFHumanoidInputs Standing;
+	Standing.OrientationIntent = FVector::ForwardVector;
+
+	FGCFHumanoidInputs Moving = MakeMovingInputs();
+
+	FGCFHumanoidInputs CrouchJump = MakeMovingInputs();
+	CrouchJump.bWantsToCrouch = true;
+	CrouchJump.bIsJumpPressed = true;
+	CrouchJump.bIsJumpJustPressed = true;
+	CrouchJump.SuggestedMovementMode = TEXT("Falling");
+
+	FGCFHumanoidInputs Velocity;
+	Velocity.SetMoveInput(EMoveInputType::Velocity, FVector(250.0, -30.0, 12.0));
+	Velocity.OrientationIntent = FVector::RightVector;
+
+	const TPair<const TCHAR*, const FGCFHumanoidInputs*> Cases[] = {
+		{ TEXT("Standing"), &Standing },
+		{ TEXT("Moving"), &Moving },
+		{ TEXT("CrouchJump"), &CrouchJump },
+		{ TEXT("Velocity"), &Velocity },
+	};
+
+	for (const TPair<const TCHAR*, const FGCFHumanoidInputs*>& Case : Cases) {
+		const FGCFHumanoidInputs& Source = *Case.Value;
+
+		// Start from different values so a field the reader skips is detected.
+		FGCFHumanoidInputs Result = MakeMovingInputs();
+		Result.bWantsToCrouch = !Source.bWantsToCrouch;
+		Result.bIsJumpPressed = !Source.bIsJumpPressed;
+		Result.SuggestedMovementMode = TEXT("Stale");
+
+		if (!TestTrue(FString::Printf(TEXT("%s: serializes without error"), Case.Key), RoundTrip(Source, Result))) {
+			continue;
+		}
+
+		const double MoveTolerance = Source.GetMoveInputType() == EMoveInputType::Velocity ? 0.1 : UnitVectorTolerance;
+		TestEqual(FString::Printf(TEXT("%s: move type"), Case.Key), Result.GetMoveInputType(), Source.GetMoveInputType());
+		TestTrue(FString::Printf(TEXT("%s: move input"), Case.Key), Result.GetMoveInput().Equals(Source.GetMoveInput(), MoveTolerance));
+		TestTrue(FString::Printf(TEXT("%s: orientation intent"), Case.Key), Result.OrientationIntent.Equals(Source.OrientationIntent, UnitVectorTolerance));
+		TestTrue(FString::Printf(TEXT("%s: control rotation"), Case.Key), Result.ControlRotation.Equals(Source.ControlRotation, RotationTolerance));
+		TestEqual(FString::Printf(TEXT("%s: jump pressed"), Case.Key), Result.bIsJumpPressed, Source.bIsJumpPressed);
+		TestEqual(FString::Printf(TEXT("%s: jump just pressed"), Case.Key), Result.bIsJumpJustPressed, Source.bIsJumpJustPressed);
+		TestEqual(FString::Printf(TEXT("%s: crouch"), Case.Key), Result.bWantsToCrouch, Source.bWantsToCrouch);
+		TestEqual(FString::Printf(TEXT("%s: suggested mode"), Case.Key), Result.SuggestedMovementMode, Source.SuggestedMovementMode);
+	}
+
+	// Mover's modes look the inputs up as FCharacterDefaultInputs; the derived struct has to satisfy that lookup.
+	FMoverDataCollection Collection;
+	FGCFHumanoidInputs& Added = Collection.FindOrAddMutableDataByType<FGCFHumanoidInputs>();
+	TestTrue(TEXT("Default input lookup finds the humanoid inputs"), Collection.FindDataByType<FCharacterDefaultInputs>() == &Added);
+
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFHumanoidInputsBandwidthTest, "GameCoreFramework.Movement.HumanoidInputs.Bandwidth",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFHumanoidInputsBandwidthTest::RunTest(const FString& Parameters)
+{
+	using namespace GCF::Tests;
+
+	FGCFHumanoidInputs Standing;
+	Standing.OrientationIntent = FVector::ForwardVector;
+	const FGCFHumanoidInputs Moving = MakeMovingInputs();
+
+	// The same intents as Mover's default inputs, which humanoid pawns sent before.
+	FCharacterDefaultInputs DefaultStanding;
+	DefaultStanding.OrientationIntent = Standing.OrientationIntent;
+	FCharacterDefaultInputs DefaultMoving;
+	DefaultMoving.SetMoveInput(EMoveInputType::DirectionalIntent, Moving.GetMoveInput());
+	DefaultMoving.OrientationIntent = Moving.OrientationIntent;
+	DefaultMoving.ControlRotation = Moving.ControlRotation;
+
+	const double CommandsPerSecond = (double)InputTickRate * InputSendCount;
+	const TPair<const TCHAR*, TPair<int64, int64>> Rows[] = {
+		{ TEXT("Standing"), { MeasureBits(DefaultStanding), MeasureBits(Standing) } },
+		{ TEXT("Moving"), { MeasureBits(DefaultMoving), MeasureBits(Moving) } },
+	};
+
+	for (const TPair<const TCHAR*, TPair<int64, int64>>& Row : Rows) {
+		const int64 DefaultBits = Row.Value.Key;
+		const int64 HumanoidBits = Row.Value.Value;
+		AddInfo(FString::Printf(TEXT("%s at %d Hz x %d sends: FCharacterDefaultInputs %lld bits/cmd (%.1f bytes/s), FGCFHumanoidInputs %lld bits/cmd (%.1f bytes/s)"),
+			Row.Key, InputTickRate, InputSendCount,
+			DefaultBits, DefaultBits * CommandsPerSecond / 8.0, HumanoidBits, HumanoidBits * CommandsPerSecond / 8.0));
+
+	}
+
+	// A zero move intent is a single bit, so the common standing frame has to be cheaper than Mover's format.
+	TestTrue(TEXT("Standing humanoid inputs are smaller than the default inputs"), Rows[0].Value.Value < Rows[0].Value.Key);
+
+	return true;
+}
+
+#endif
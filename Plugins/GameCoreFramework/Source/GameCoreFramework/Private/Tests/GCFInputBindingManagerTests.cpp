@@ -0,0 +1,157 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Input/GCFInputBindingManagerComponent.h"
+#include "Input/GCFInputComponent.h"
+#include "Input/GCFPawnInputBridgeComponent.h"
+#include "Input/GCFPlayerInputBridgeComponent.h"
+#include "InputMappingContext.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/GCFTestWorld.h"
+#include "TimerManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Reaches the manager's private state so the test does not need the full input readiness chain. */
+struct FGCFInputBindingManagerTestAccess
+{
+	static void EnableInput(UGCFInputBindingManagerComponent& Manager)
+	{
+		Manager.HandleInputContextStateChanged(EGCFInputContextState::PlayerReady | EGCFInputContextState::PawnReady, true);
+	}
+
+	static void Register(UGCFInputBindingManagerComponent& Manager, UObject* Binder, FName KeyName, FGCFInputBindNativeDelegate&& Delegate)
+	{
+		Manager.RegisterInputBinding_Internal(Binder, KeyName, MoveTemp(Delegate));
+	}
+
+	static void Evaluate(UGCFInputBindingManagerComponent& Manager) { Manager.EvaluateBindingConditions(); }
+	static void ClearPawnBindings(UGCFInputBindingManagerComponent& Manager) { Manager.ClearBindingsOnContextChange(); }
+	static int32 GetPendingCount(const UGCFInputBindingManagerComponent& Manager) { return Manager.PendingBindings.Num(); }
+	static int32 GetActiveCount(const UGCFInputBindingManagerComponent& Manager) { return Manager.ActiveBindingGroups.Num(); }
+
+	static void AddAppliedContext(UGCFInputBindingManagerComponent& Manager, const UInputMappingContext* Context)
+	{
+		FGCFInputMappingContextInfo& Info = Manager.AppliedPawnIMCs.AddDefaulted_GetRef();
+		Info.InputMapping = Context;
+	}
+
+	static void Unpossess(UGCFInputBindingManagerComponent& Manager, APawn* Pawn) { Manager.HandlePawnPossessionStateChanged(Pawn, false); }
+	static int32 GetAppliedContextCount(const UGCFInputBindingManagerComponent& Manager) { return Manager.AppliedPawnIMCs.Num(); }
+	static bool IsClearPending(const UGCFInputBindingManagerComponent& Manager)
+	{
+		return Manager.GetWorld()->GetTimerManager().IsTimerActive(Manager.DeferredIMCClearHandle);
+	}
+};
+
+
+namespace GCF::Tests
+{
+static constexpr int32 InputBindingBinderCount = 500;
+
+/** Binding delegate with one receipt that does not touch Enhanced Input, counting how often it ran. */
+static FGCFInputBindNativeDelegate MakeCountingBinding(int32& ExecuteCount)
+{
+	FGCFInputBindNativeDelegate Delegate;
+	Delegate.BindLambda([&ExecuteCount](UGCFInputComponent*, TScriptInterface<IGCFInputConfigProvider>) {
+		++ExecuteCount;
+		return TArray<FGCFBindingReceipt>{ FGCFBindingReceipt(nullptr, FGameplayTag(), ETriggerEvent::Triggered) };
+	});
+	return Delegate;
+}
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFInputBindingManagerScaleTest, "GameCoreFramework.Input.BindingManager.ManyBinders",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFInputBindingManagerScaleTest::RunTest(const FString& Parameters)
+{
+	GCF::Tests::FScopedTestWorld World;
+
+	APlayerController* PC = World->SpawnActor<APlayerController>();
+	APawn* Pawn = World->SpawnActor<APawn>();
+	if (!TestNotNull(TEXT("Controller spawned"), PC) || !TestNotNull(TEXT("Pawn spawned"), Pawn)) {
+		return false;
+	}
+	PC->SetPawn(Pawn);
+
+	// Both input config providers and the input component, which is all ProcessPendingBindings requires.
+	NewObject<UGCFPlayerInputBridgeComponent>(PC)->RegisterComponent();
+	NewObject<UGCFPawnInputBridgeComponent>(Pawn)->RegisterComponent();
+	PC->InputComponent = NewObject<UGCFInputComponent>(PC);
+
+	UGCFInputBindingManagerComponent* Manager = NewObject<UGCFInputBindingManagerComponent>(PC);
+	Manager->RegisterComponent();
+	FGCFInputBindingManagerTestAccess::EnableInput(*Manager);
+
+	// Binders outered to the Controller are Controller-persistent, binders outered to the Pawn are Pawn-dependent.
+	TArray<UObject*> Binders;
+	TArray<int32> ExecuteCounts;
+	ExecuteCounts.SetNumZeroed(GCF::Tests::InputBindingBinderCount * 2);
+
+	const double RegisterStartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < GCF::Tests::InputBindingBinderCount; ++i) {
+		UObject* PersistentBinder = Binders.Add_GetRef(NewObject<UObject>(PC));
+		FGCFInputBindingManagerTestAccess::Register(*Manager, PersistentBinder, TEXT("Binding"), GCF::Tests::MakeCountingBinding(ExecuteCounts[i * 2]));
+
+		UObject* PawnBinder = Binders.Add_GetRef(NewObject<UObject>(Pawn));
+		FGCFInputBindingManagerTestAccess::Register(*Manager, PawnBinder, TEXT("Binding"), GCF::Tests::MakeCountingBinding(ExecuteCounts[i * 2 + 1]));
+	}
+	const double RegisterSeconds = FPlatformTime::Seconds() - RegisterStartTime;
+
+	const int32 BindingCount = GCF::Tests::InputBindingBinderCount * 2;
+	TestEqual(TEXT("Every binder has an active group"), FGCFInputBindingManagerTestAccess::GetActiveCount(*Manager), BindingCount);
+	TestEqual(TEXT("Only Controller-persistent binders stay pending"), FGCFInputBindingManagerTestAccess::GetPendingCount(*Manager), GCF::Tests::InputBindingBinderCount);
+	TestFalse(TEXT("Every binder ran exactly once"), ExecuteCounts.ContainsByPredicate([](int32 Count) { return Count != 1; }));
+
+	// A full re-evaluation with every binder already active, as on possession and input context changes.
+	const double EvaluateStartTime = FPlatformTime::Seconds();
+	FGCFInputBindingManagerTestAccess::Evaluate(*Manager);
+	const double EvaluateSeconds = FPlatformTime::Seconds() - EvaluateStartTime;
+
+	TestFalse(TEXT("Active Controller-persistent binders are not executed again"), ExecuteCounts.ContainsByPredicate([](int32 Count) { return Count != 1; }));
+	TestEqual(TEXT("Re-evaluation keeps one group per binder"), FGCFInputBindingManagerTestAccess::GetActiveCount(*Manager), BindingCount);
+
+	// Unpossession clears only the Pawn-dependent groups.
+	FGCFInputBindingManagerTestAccess::ClearPawnBindings(*Manager);
+	TestEqual(TEXT("Pawn-dependent groups are cleared"), FGCFInputBindingManagerTestAccess::GetActiveCount(*Manager), GCF::Tests::InputBindingBinderCount);
+
+	AddInfo(FString::Printf(TEXT("%d binders. Register (incl. evaluation per binder): %.3f ms, Full evaluation: %.3f ms"),
+		BindingCount, RegisterSeconds * 1000.0, EvaluateSeconds * 1000.0));
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFInputBindingManagerEndPlayClearTest, "GameCoreFramework.Input.BindingManager.EndPlayFlushesDeferredClear",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFInputBindingManagerEndPlayClearTest::RunTest(const FString& Parameters)
+{
+	GCF::Tests::FScopedTestWorld World(true);
+
+	APlayerController* PC = World->SpawnActor<APlayerController>();
+	APawn* Pawn = World->SpawnActor<APawn>();
+	if (!TestNotNull(TEXT("Controller spawned"), PC) || !TestNotNull(TEXT("Pawn spawned"), Pawn)) {
+		return false;
+	}
+
+	UGCFInputBindingManagerComponent* Manager = NewObject<UGCFInputBindingManagerComponent>(PC);
+	Manager->RegisterComponent();
+	FGCFInputBindingManagerTestAccess::AddAppliedContext(*Manager, NewObject<UInputMappingContext>(GetTransientPackage()));
+
+	// Unpossession defers the context removal to the next tick, then the component ends play before that tick.
+	FGCFInputBindingManagerTestAccess::Unpossess(*Manager, Pawn);
+	TestTrue(TEXT("Unpossession schedules the deferred clear"), FGCFInputBindingManagerTestAccess::IsClearPending(*Manager));
+	TestEqual(TEXT("Contexts stay applied until the deferred clear runs"), FGCFInputBindingManagerTestAccess::GetAppliedContextCount(*Manager), 1);
+
+	Manager->DestroyComponent();
+	TestEqual(TEXT("EndPlay runs the pending clear instead of dropping it"), FGCFInputBindingManagerTestAccess::GetAppliedContextCount(*Manager), 0);
+	TestFalse(TEXT("The deferred clear timer is cancelled"), FGCFInputBindingManagerTestAccess::IsClearPending(*Manager));
+	return true;
+}
+
+#endif
@@ -0,0 +1,81 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Input/GCFInputConfig.h"
+#include "Common/GCFGameplayTags.h"
+#include "InputAction.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GCF::Tests
+{
+static FGCFInputAction MakeInputAction(const UInputAction* Action, const FGameplayTag& Tag)
+{
+	FGCFInputAction Entry;
+	Entry.InputAction = Action;
+	Entry.InputTag = Tag;
+	return Entry;
+}
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFInputConfigIndexTest, "GameCoreFramework.Input.InputConfigIndex",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFInputConfigIndexTest::RunTest(const FString& Parameters)
+{
+	const UInputAction* MoveFirst = NewObject<UInputAction>(GetTransientPackage());
+	const UInputAction* MoveSecond = NewObject<UInputAction>(GetTransientPackage());
+	const UInputAction* Jump = NewObject<UInputAction>(GetTransientPackage());
+	const UInputAction* Interact = NewObject<UInputAction>(GetTransientPackage());
+
+	UGCFInputConfig* Config = NewObject<UGCFInputConfig>(GetTransientPackage());
+
+	// Duplicate tag: the first entry wins.
+	Config->NativeInputActions.Add(GCF::Tests::MakeInputAction(MoveFirst, GCFGameplayTags::InputTag_Move));
+	Config->NativeInputActions.Add(GCF::Tests::MakeInputAction(MoveSecond, GCFGameplayTags::InputTag_Move));
+	// An entry without an action is skipped, so the later valid entry wins.
+	Config->NativeInputActions.Add(GCF::Tests::MakeInputAction(nullptr, GCFGameplayTags::InputTag_Jump));
+	Config->NativeInputActions.Add(GCF::Tests::MakeInputAction(Jump, GCFGameplayTags::InputTag_Jump));
+
+	Config->AbilityInputActions.Add(GCF::Tests::MakeInputAction(Interact, GCFGameplayTags::InputTag_Interact));
+	Config->AbilityInputActions.Add(GCF::Tests::MakeInputAction(MoveSecond, GCFGameplayTags::InputTag_Interact));
+
+	const TArray<FGameplayTag> TagsToCheck = {
+		GCFGameplayTags::InputTag_Move,
+		GCFGameplayTags::InputTag_Jump,
+		GCFGameplayTags::InputTag_Interact,
+		GCFGameplayTags::InputTag_Crouch, // Missing from both lists
+		FGameplayTag(),
+	};
+
+	// A config created at runtime has no index yet, so these lookups use the linear search.
+	TArray<const UInputAction*> LinearNative;
+	TArray<const UInputAction*> LinearAbility;
+	for (const FGameplayTag& Tag : TagsToCheck) {
+		LinearNative.Add(Config->FindNativeInputActionForTag(Tag, false));
+		LinearAbility.Add(Config->FindAbilityInputActionForTag(Tag, false));
+	}
+
+	Config->RebuildInputActionIndex();
+
+	for (int32 i = 0; i < TagsToCheck.Num(); ++i) {
+		const FString TagName = TagsToCheck[i].ToString();
+		TestTrue(FString::Printf(TEXT("Native lookup for [%s] matches the linear search"), *TagName),
+			Config->FindNativeInputActionForTag(TagsToCheck[i], false) == LinearNative[i]);
+		TestTrue(FString::Printf(TEXT("Ability lookup for [%s] matches the linear search"), *TagName),
+			Config->FindAbilityInputActionForTag(TagsToCheck[i], false) == LinearAbility[i]);
+	}
+
+	TestTrue(TEXT("Duplicate native tag resolves to the first entry"), Config->FindNativeInputActionForTag(GCFGameplayTags::InputTag_Move, false) == MoveFirst);
+	TestTrue(TEXT("Null action entry is skipped"), Config->FindNativeInputActionForTag(GCFGameplayTags::InputTag_Jump, false) == Jump);
+	TestTrue(TEXT("Duplicate ability tag resolves to the first entry"), Config->FindAbilityInputActionForTag(GCFGameplayTags::InputTag_Interact, false) == Interact);
+	TestNull(TEXT("Missing native tag is not found"), Config->FindNativeInputActionForTag(GCFGameplayTags::InputTag_Crouch, false));
+	TestNull(TEXT("Missing ability tag is not found"), Config->FindAbilityInputActionForTag(GCFGameplayTags::InputTag_Move, false));
+	TestNull(TEXT("Empty tag is not found"), Config->FindNativeInputActionForTag(FGameplayTag(), false));
+	return true;
+}
+
+#endif
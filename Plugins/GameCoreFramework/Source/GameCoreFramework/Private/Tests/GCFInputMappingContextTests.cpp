@@ -0,0 +1,70 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Tests/GCFInputTestTypes.h"
+
+#include "Input/GCFInputFunctionLibrary.h"
+#include "Actor/Data/GCFPawnData.h"
+#include "InputMappingContext.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GCFInputTestTypes)
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GCF::Tests
+{
+static constexpr int32 MappingContextCount = 6;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFInputMappingContextBatchTest, "GameCoreFramework.Input.MappingContextBatch",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFInputMappingContextBatchTest::RunTest(const FString& Parameters)
+{
+	UGCFTestEnhancedInputSubsystem* Subsystem = NewObject<UGCFTestEnhancedInputSubsystem>(GetTransientPackage());
+
+	TArray<FGCFInputMappingContextInfo> Contexts;
+	for (int32 i = 0; i < GCF::Tests::MappingContextCount; ++i) {
+		FGCFInputMappingContextInfo& Info = Contexts.AddDefaulted_GetRef();
+		Info.InputMapping = NewObject<UInputMappingContext>(GetTransientPackage());
+		Info.Priority = i;
+	}
+
+	// Possession: every context of the pawn is applied at once.
+	TestTrue(TEXT("Adding the contexts modified the subsystem"), UGCFInputFunctionLibrary::ModifyMappingContexts(Subsystem, Contexts));
+	TestEqual(TEXT("Adding six contexts rebuilds once"), Subsystem->RebuildCount, 1);
+	for (const FGCFInputMappingContextInfo& Info : Contexts) {
+		TestTrue(TEXT("Added context is applied"), Subsystem->HasMappingContext(Info.InputMapping));
+	}
+
+	// Pawn swap: half of the contexts are replaced.
+	TArray<const UInputMappingContext*> ContextsToRemove;
+	TArray<FGCFInputMappingContextInfo> ContextsToAdd;
+	for (int32 i = 0; i < GCF::Tests::MappingContextCount / 2; ++i) {
+		ContextsToRemove.Add(Contexts[i].InputMapping);
+
+		FGCFInputMappingContextInfo& Info = ContextsToAdd.AddDefaulted_GetRef();
+		Info.InputMapping = NewObject<UInputMappingContext>(GetTransientPackage());
+		Info.Priority = i;
+	}
+
+	TestTrue(TEXT("Swapping contexts modified the subsystem"), UGCFInputFunctionLibrary::ModifyMappingContexts(Subsystem, ContextsToAdd, ContextsToRemove));
+	TestEqual(TEXT("Swapping three of six contexts rebuilds once more"), Subsystem->RebuildCount, 2);
+	for (const UInputMappingContext* Removed : ContextsToRemove) {
+		TestFalse(TEXT("Removed context is no longer applied"), Subsystem->HasMappingContext(Removed));
+	}
+	for (const FGCFInputMappingContextInfo& Info : ContextsToAdd) {
+		TestTrue(TEXT("Swapped-in context is applied"), Subsystem->HasMappingContext(Info.InputMapping));
+	}
+
+	// An empty batch, or one with only null entries, does not rebuild.
+	TestFalse(TEXT("Empty batch reports no change"), UGCFInputFunctionLibrary::ModifyMappingContexts(Subsystem, {}));
+	TestFalse(TEXT("Batch of null contexts reports no change"), UGCFInputFunctionLibrary::ModifyMappingContexts(Subsystem, { FGCFInputMappingContextInfo() }));
+	TestEqual(TEXT("No-op batches do not rebuild"), Subsystem->RebuildCount, 2);
+	return true;
+}
+
+#endif
@@ -0,0 +1,48 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EnhancedInputSubsystemInterface.h"
+#include "EnhancedPlayerInput.h"
+#include "GCFInputTestTypes.generated.h"
+
+/**
+ * @brief Headless Enhanced Input subsystem for automation tests.
+ *
+ * Owns its own player input, so mapping contexts can be applied without a local player or viewport,
+ * and counts how often the control mappings were actually rebuilt.
+ */
+UCLASS(Transient, HideDropdown)
+class UGCFTestEnhancedInputSubsystem : public UObject, public IEnhancedInputSubsystemInterface
+{
+	GENERATED_BODY()
+
+public:
+	UGCFTestEnhancedInputSubsystem()
+	{
+		if (!HasAnyFlags(RF_ClassDefaultObject)) {
+			PlayerInput = CreateDefaultSubobject<UEnhancedPlayerInput>(TEXT("PlayerInput"));
+		}
+	}
+
+	//~IEnhancedInputSubsystemInterface
+	virtual UEnhancedPlayerInput* GetPlayerInput() const override { return PlayerInput; }
+	virtual TMap<TWeakObjectPtr<const UInputAction>, FInjectedInput>& GetContinuouslyInjectedInputs() override { return ContinuouslyInjectedInputs; }
+	//~End of IEnhancedInputSubsystemInterface
+
+	/** Number of completed control mapping rebuilds. */
+	int32 RebuildCount = 0;
+
+protected:
+	//~IEnhancedInputSubsystemInterface
+	virtual void ControlMappingsRebuiltThisFrame() override { ++RebuildCount; }
+	//~End of IEnhancedInputSubsystemInterface
+
+private:
+	UPROPERTY(Transient)
+	TObjectPtr<UEnhancedPlayerInput> PlayerInput;
+
+	TMap<TWeakObjectPtr<const UInputAction>, FInjectedInput> ContinuouslyInjectedInputs;
+};
@@ -0,0 +1,125 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Tests/GCFMovementTestTypes.h"
+
+#include "Movement/Mover/Producer/GCFLocomotionInputProducer.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/GCFTestWorld.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GCFMovementTestTypes)
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Reaches the producer's provider resolution so both call paths can be driven directly. */
+struct FGCFLocomotionInputProducerTestAccess
+{
+	struct FIntents
+	{
+		FVector Move = FVector::ZeroVector;
+		FVector Orientation = FVector::ZeroVector;
+		bool bJumpPressed = false;
+		bool bJumpJustPressed = false;
+		bool bWantsToCrouch = false;
+	};
+
+	/** Resolves the provider with or without the native path. Returns true if the native path was selected. */
+	static bool Resolve(UGCFLocomotionInputProducer& Producer, APawn* Pawn, bool bAllowNative)
+	{
+		Producer.ResolveProvider(Pawn, bAllowNative);
+		return Producer.ProviderCallMode == UGCFLocomotionInputProducer::EGCFProviderCallMode::Native;
+	}
+
+	static FIntents Read(UGCFLocomotionInputProducer& Producer, APawn* Pawn)
+	{
+		FIntents Intents;
+		Producer.ReadLocomotionIntents(Pawn, Intents.Move, Intents.Orientation, Intents.bJumpPressed, Intents.bJumpJustPressed);
+		Intents.bWantsToCrouch = Producer.ReadWantsToCrouch(Pawn);
+		return Intents;
+	}
+};
+
+
+namespace GCF::Tests
+{
+static constexpr int32 InputProducerPawnCount = 500;
+static constexpr int32 InputProducerFrameCount = 100;
+
+/** Gives every test pawn distinct intents so a mixed-up read is detected. */
+static void SetTestIntents(AGCFTestLocomotionPawn& Pawn, int32 Index)
+{
+	Pawn.MovementIntent = FVector(Index, -Index, 0.0);
+	Pawn.OrientationIntent = FVector(0.0, Index, 1.0);
+	Pawn.bJumpPressed = (Index % 2) == 0;
+	Pawn.bJumpJustPressed = (Index % 3) == 0;
+	Pawn.bWantsToCrouch = (Index % 5) == 0;
+}
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFLocomotionInputProducerPathTest, "GameCoreFramework.Movement.InputProducer.NativeProvider",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFLocomotionInputProducerPathTest::RunTest(const FString& Parameters)
+{
+	GCF::Tests::FScopedTestWorld World;
+
+	TArray<AGCFTestLocomotionPawn*> Pawns;
+	TArray<UGCFLocomotionInputProducer*> Producers;
+	for (int32 i = 0; i < GCF::Tests::InputProducerPawnCount; ++i) {
+		AGCFTestLocomotionPawn* Pawn = World->SpawnActor<AGCFTestLocomotionPawn>();
+		if (!TestNotNull(TEXT("Test pawn spawned"), Pawn)) {
+			return false;
+		}
+		UGCFLocomotionInputProducer* Producer = NewObject<UGCFLocomotionInputProducer>(Pawn);
+		Producer->RegisterComponent();
+		Pawns.Add(Pawn);
+		Producers.Add(Producer);
+	}
+
+	// Equivalence: both paths read the same intents and consume the jump flag the same way.
+	for (int32 i = 0; i < Pawns.Num(); ++i) {
+		TestTrue(TEXT("A C++ provider resolves to the native path"), FGCFLocomotionInputProducerTestAccess::Resolve(*Producers[i], Pawns[i], true));
+		GCF::Tests::SetTestIntents(*Pawns[i], i);
+		const FGCFLocomotionInputProducerTestAccess::FIntents Native = FGCFLocomotionInputProducerTestAccess::Read(*Producers[i], Pawns[i]);
+		const bool bNativeConsumed = !Pawns[i]->bJumpJustPressed;
+
+		TestFalse(TEXT("Disallowing the native path resolves to reflection"), FGCFLocomotionInputProducerTestAccess::Resolve(*Producers[i], Pawns[i], false));
+		GCF::Tests::SetTestIntents(*Pawns[i], i);
+		const FGCFLocomotionInputProducerTestAccess::FIntents Reflected = FGCFLocomotionInputProducerTestAccess::Read(*Producers[i], Pawns[i]);
+		const bool bReflectedConsumed = !Pawns[i]->bJumpJustPressed;
+
+		if (!Native.Move.Equals(Reflected.Move) || !Native.Orientation.Equals(Reflected.Orientation)
+			|| Native.bJumpPressed != Reflected.bJumpPressed || Native.bJumpJustPressed != Reflected.bJumpJustPressed
+			|| Native.bWantsToCrouch != Reflected.bWantsToCrouch || bNativeConsumed != bReflectedConsumed) {
+			AddError(FString::Printf(TEXT("Native and reflected reads differ for pawn %d."), i));
+		}
+		TestTrue(TEXT("Native read returns the pawn's own intent"), Native.Move.Equals(Pawns[i]->MovementIntent));
+		TestTrue(TEXT("Just-pressed jump is consumed after the read"), bNativeConsumed);
+	}
+
+	// Timing over the isolated test pawns, so no live input state is consumed.
+	auto Measure = [&Pawns, &Producers](bool bAllowNative) {
+		for (int32 i = 0; i < Pawns.Num(); ++i) {
+			FGCFLocomotionInputProducerTestAccess::Resolve(*Producers[i], Pawns[i], bAllowNative);
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < GCF::Tests::InputProducerFrameCount; ++Frame) {
+			for (int32 i = 0; i < Pawns.Num(); ++i) {
+				FGCFLocomotionInputProducerTestAccess::Read(*Producers[i], Pawns[i]);
+			}
+		}
+		return FPlatformTime::Seconds() - StartTime;
+	};
+
+	const double NativeSeconds = Measure(true);
+	const double ReflectedSeconds = Measure(false);
+
+	AddInfo(FString::Printf(TEXT("%d pawns x %d frames. Native path: %.3f ms, Reflected path: %.3f ms"),
+		GCF::Tests::InputProducerPawnCount, GCF::Tests::InputProducerFrameCount, NativeSeconds * 1000.0, ReflectedSeconds * 1000.0));
+	return true;
+}
+
+#endif
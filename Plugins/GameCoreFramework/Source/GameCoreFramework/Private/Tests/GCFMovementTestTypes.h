@@ -0,0 +1,117 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/Pawn.h"
+#include "MoverDataModelTypes.h"
+#include "MoverSimulationTypes.h"
+#include "Movement/GCFCharacterMovementComponent.h"
+#include "Movement/Mover/GCFCharacterMoverComponent.h"
+#include "Movement/Mover/Mode/GCFCrowdWalkingMode.h"
+#include "Movement/Mover/Mode/GCFFallingMode.h"
+#include "Movement/Mover/Mode/GCFWalkingMode.h"
+#include "Movement/Locomotion/GCFLocomotionInputProvider.h"
+#include "GCFMovementTestTypes.generated.h"
+
+/**
+ * @brief Pawn with a native locomotion input provider, used by automation tests instead of live player pawns.
+ */
+UCLASS(Transient, HideDropdown, NotBlueprintable)
+class AGCFTestLocomotionPawn : public APawn, public IGCFLocomotionInputProvider
+{
+	GENERATED_BODY()
+
+public:
+	//~IGCFLocomotionInputProvider interface
+	virtual FVector GetMovementIntent_Implementation() const override { return MovementIntent; }
+	virtual FVector GetOrientationIntent_Implementation() const override { return OrientationIntent; }
+	virtual bool GetIsJumpPressed_Implementation() const override { return bJumpPressed; }
+	virtual bool GetIsJumpJustPressed_Implementation() const override { return bJumpJustPressed; }
+	virtual void ConsumeJumpJustPressed_Implementation() override { bJumpJustPressed = false; }
+	virtual bool GetWantsToCrouch_Implementation() const override { return bWantsToCrouch; }
+	//~End of IGCFLocomotionInputProvider interface
+
+	FVector MovementIntent = FVector::ZeroVector;
+	FVector OrientationIntent = FVector::ForwardVector;
+	bool bJumpPressed = false;
+	bool bJumpJustPressed = false;
+	bool bWantsToCrouch = false;
+};
+
+/**
+ * @brief Bare character using the GCF movement component, without the GCF pawn extension setup.
+ */
+UCLASS(Transient, HideDropdown, NotBlueprintable)
+class AGCFTestCharacter : public ACharacter
+{
+	GENERATED_BODY()
+
+public:
+	AGCFTestCharacter(const FObjectInitializer& ObjectInitializer)
+		: Super(ObjectInitializer.SetDefaultSubobjectClass<UGCFCharacterMovementComponent>(ACharacter::CharacterMovementComponentName))
+	{
+	}
+
+	UGCFCharacterMovementComponent* GetGCFMovement() const { return CastChecked<UGCFCharacterMovementComponent>(GetCharacterMovement()); }
+};
+
+/**
+ * @brief Bare capsule pawn driven by the GCF character Mover component, used as a stand-in for NPCs.
+ * Walks and falls with the GCF modes and produces its own input: a constant move intent, zero by default.
+ */
+UCLASS(Transient, HideDropdown, NotBlueprintable)
+class AGCFTestMoverPawn : public APawn, public IMoverInputProducerInterface
+{
+	GENERATED_BODY()
+
+public:
+	static inline const FName WalkingModeName = TEXT("WalkingMode");
+
+	AGCFTestMoverPawn(const FObjectInitializer& ObjectInitializer)
+		: Super(ObjectInitializer)
+	{
+		UCapsuleComponent* Capsule = CreateDefaultSubobject<UCapsuleComponent>(TEXT("Capsule"));
+		Capsule->InitCapsuleSize(34.0f, 88.0f);
+		Capsule->SetCollisionProfileName(UCollisionProfile::Pawn_ProfileName);
+		RootComponent = Capsule;
+
+		MoverComponent = CreateDefaultSubobject<UGCFCharacterMoverComponent>(TEXT("MoverComponent"));
+		MoverComponent->MovementModes.Add(DefaultModeNames::Walking, CreateDefaultSubobject<UGCFWalkingMode>(WalkingModeName));
+		MoverComponent->MovementModes.Add(DefaultModeNames::Falling, CreateDefaultSubobject<UGCFFallingMode>(TEXT("FallingMode")));
+		MoverComponent->StartingMovementMode = DefaultModeNames::Falling;
+	}
+
+	//~IMoverInputProducerInterface interface
+	virtual void ProduceInput_Implementation(int32 SimTimeMs, FMoverInputCmdContext& InputCmdResult) override
+	{
+		FCharacterDefaultInputs& Inputs = InputCmdResult.InputCollection.FindOrAddMutableDataByType<FCharacterDefaultInputs>();
+		Inputs.SetMoveInput(EMoveInputType::DirectionalIntent, MoveIntent);
+		Inputs.OrientationIntent = MoveIntent.IsNearlyZero() ? GetActorForwardVector() : MoveIntent;
+	}
+	//~End of IMoverInputProducerInterface interface
+
+	UPROPERTY()
+	TObjectPtr<UGCFCharacterMoverComponent> MoverComponent;
+
+	FVector MoveIntent = FVector::ZeroVector;
+};
+
+/**
+ * @brief Test Mover pawn walking with the crowd walking mode instead of the GCF walking mode.
+ */
+UCLASS(Transient, HideDropdown, NotBlueprintable)
+class AGCFTestCrowdPawn : public AGCFTestMoverPawn
+{
+	GENERATED_BODY()
+
+public:
+	AGCFTestCrowdPawn(const FObjectInitializer& ObjectInitializer)
+		: Super(ObjectInitializer.SetDefaultSubobjectClass<UGCFCrowdWalkingMode>(AGCFTestMoverPawn::WalkingModeName))
+	{
+	}
+};
@@ -0,0 +1,83 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Movement/Mover/GCFMoverBenchmarkSubsystem.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Tests/GCFTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && !UE_BUILD_SHIPPING
+
+namespace GCF::Tests
+{
+static constexpr int32 MoverBenchmarkWarmupFrames = 10;
+static constexpr int32 MoverBenchmarkMeasuredFrames = 60;
+
+/** Returns the rows of the benchmark CSV whose Category and Phase columns match. */
+static TArray<FString> FindBenchmarkRows(const TArray<FString>& Lines, const FString& Category, const TCHAR* Phase)
+{
+	return Lines.FilterByPredicate([&Category, Phase](const FString& Line) {
+		TArray<FString> Columns;
+		Line.ParseIntoArray(Columns, TEXT(","), false);
+		return Columns.Num() > 4 && Columns[3] == Category && Columns[4] == Phase;
+	});
+}
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFMoverBenchmarkTest, "GameCoreFramework.Movement.MoverBenchmark",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFMoverBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace GCF::Tests;
+
+	FScopedTestWorld World(true);
+	SpawnTestFloor(World.Get());
+
+	UGCFMoverBenchmarkSubsystem* Benchmark = UGCFMoverBenchmarkSubsystem::Get(World.Get());
+	if (!TestNotNull(TEXT("Benchmark subsystem"), Benchmark)) {
+		return false;
+	}
+
+	const FString Options = FString::Printf(TEXT("Class=Humanoid Count=25 Frames=%d Warmup=%d Spacing=300 Script=Mixed Csv=GCFAutomationMoverBenchmark"),
+		MoverBenchmarkMeasuredFrames, MoverBenchmarkWarmupFrames);
+	if (!TestTrue(TEXT("Benchmark started"), Benchmark->StartBenchmark(Options))) {
+		return false;
+	}
+
+	// One extra frame writes the results.
+	World.Tick(MoverBenchmarkWarmupFrames + MoverBenchmarkMeasuredFrames + 1);
+	if (!TestFalse(TEXT("Benchmark finished after its frames"), Benchmark->IsRunning())) {
+		Benchmark->CancelBenchmark();
+		return false;
+	}
+
+	const FString& CsvPath = Benchmark->GetLastCsvPath();
+	TArray<FString> Lines;
+	if (!TestTrue(TEXT("CSV written"), !CsvPath.IsEmpty() && FFileHelper::LoadFileToStringArray(Lines, *CsvPath))) {
+		return false;
+	}
+
+	TestEqual(TEXT("CSV header"), Lines.Num() > 0 ? Lines[0] : FString(), FString(TEXT("PawnClass,Pawns,Frames,Category,Phase,Calls,TotalMs,UsPerCall,UsPerPawnFrame")));
+	TestEqual(TEXT("One frame time row"), FindBenchmarkRows(Lines, TEXT("Frame"), TEXT("GameThread")).Num(), 1);
+	TestEqual(TEXT("Direction component sampled"), FindBenchmarkRows(Lines, TEXT("GCFLocomotionDirectionComponent"), TEXT("ConvertInput")).Num(), 1);
+
+	const int32 ProducerRows = Lines.FilterByPredicate([](const FString& Line) { return Line.Contains(TEXT(",ProduceInput,")); }).Num();
+	const int32 ModeRows = Lines.FilterByPredicate([](const FString& Line) { return Line.Contains(TEXT(",GenerateMove,")); }).Num();
+	const int32 StepRows = Lines.FilterByPredicate([](const FString& Line) { return Line.Contains(TEXT(",SimulationTick,")); }).Num();
+	TestTrue(TEXT("Input producers sampled"), ProducerRows > 0);
+	TestTrue(TEXT("Movement modes sampled"), ModeRows > 0);
+	TestTrue(TEXT("Movement mode simulation steps sampled"), StepRows > 0);
+
+	for (int32 i = 1; i < Lines.Num(); ++i) {
+		AddInfo(Lines[i]);
+	}
+
+	IFileManager::Get().Delete(*CsvPath);
+	return true;
+}
+
+#endif
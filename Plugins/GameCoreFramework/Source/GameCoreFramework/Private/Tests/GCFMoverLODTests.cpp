@@ -0,0 +1,92 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Movement/Mover/GCFMoverLODSubsystem.h"
+
+#include "Misc/AutomationTest.h"
+#include "Tests/GCFMovementTestTypes.h"
+#include "Tests/GCFTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GCF::Tests
+{
+/** Spawns Mover pawns on a grid above the test floor. */
+static TArray<AGCFTestMoverPawn*> SpawnMoverPawnGrid(UWorld* World, int32 Count, double Spacing)
+{
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	const int32 GridSize = FMath::CeilToInt(FMath::Sqrt((float)Count));
+	TArray<AGCFTestMoverPawn*> Pawns;
+	for (int32 i = 0; i < Count; ++i) {
+		const FVector Location((i % GridSize) * Spacing, (i / GridSize) * Spacing, 100.0);
+		if (AGCFTestMoverPawn* Pawn = World->SpawnActor<AGCFTestMoverPawn>(Location, FRotator::ZeroRotator, SpawnParameters)) {
+			Pawns.Add(Pawn);
+		}
+	}
+	return Pawns;
+}
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFMoverLODTierTest, "GameCoreFramework.Movement.MoverLOD.Tiers",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFMoverLODTierTest::RunTest(const FString& Parameters)
+{
+	using namespace GCF::Tests;
+
+	FScopedConsoleVariable Enable(TEXT("GCF.Mover.LOD.Enable"), TEXT("1"));
+	FScopedConsoleVariable ForceTier(TEXT("GCF.Mover.LOD.ForceTier"), TEXT("-1"));
+	FScopedConsoleVariable NetUpdateFrequencies(TEXT("GCF.Mover.LOD.NetUpdateFrequencies"), TEXT("0,30,15,5"));
+
+	FScopedTestWorld World(true);
+	SpawnTestFloor(World.Get());
+
+	UGCFMoverLODSubsystem* LODSubsystem = World->GetSubsystem<UGCFMoverLODSubsystem>();
+	const TArray<AGCFTestMoverPawn*> Pawns = SpawnMoverPawnGrid(World.Get(), 2, 500.0);
+	if (!TestNotNull(TEXT("LOD subsystem"), LODSubsystem) || !TestEqual(TEXT("Pawns spawned"), Pawns.Num(), 2)) {
+		return false;
+	}
+
+	AGCFTestMoverPawn* Pawn = Pawns[0];
+	UGCFCharacterMoverComponent* Mover = Pawn->MoverComponent;
+	const float DefaultNetUpdateFrequency = Pawn->GetNetUpdateFrequency();
+	const float DefaultComponentTickInterval = Mover->GetComponentTickInterval();
+
+	// Gameplay owns the actor tick; the LOD must never touch it.
+	Pawn->SetActorTickInterval(0.2f);
+
+	ForceTier.Set(TEXT("3"));
+	LODSubsystem->EvaluateTiers();
+	TestEqual(TEXT("Forced tier applies"), LODSubsystem->GetMoverLODTier(Mover), EGCFMoverLODTier::Minimal);
+	TestEqual(TEXT("Net update frequency follows the tier"), Pawn->GetNetUpdateFrequency(), FMath::Min(5.0f, DefaultNetUpdateFrequency));
+	TestEqual(TEXT("Mover tick interval is untouched"), Mover->GetComponentTickInterval(), DefaultComponentTickInterval);
+	TestEqual(TEXT("Actor tick interval is untouched"), Pawn->GetActorTickInterval(), 0.2f);
+
+	// A value gameplay changes while the pawn is downgraded survives the restore.
+	Pawn->SetNetUpdateFrequency(50.0f);
+	ForceTier.Set(TEXT("0"));
+	LODSubsystem->EvaluateTiers();
+	TestEqual(TEXT("Back to High"), LODSubsystem->GetMoverLODTier(Mover), EGCFMoverLODTier::High);
+	TestEqual(TEXT("Gameplay net update frequency is kept"), Pawn->GetNetUpdateFrequency(), 50.0f);
+	TestEqual(TEXT("Actor tick interval is still untouched"), Pawn->GetActorTickInterval(), 0.2f);
+
+	// Disabling the LOD restores every downgraded pawn.
+	AGCFTestMoverPawn* OtherPawn = Pawns[1];
+	const float OtherDefaultNetUpdateFrequency = OtherPawn->GetNetUpdateFrequency();
+	ForceTier.Set(TEXT("2"));
+	LODSubsystem->EvaluateTiers();
+	TestEqual(TEXT("Other pawn downgraded"), LODSubsystem->GetMoverLODTier(OtherPawn->MoverComponent), EGCFMoverLODTier::Low);
+	TestEqual(TEXT("Other pawn net update frequency follows the tier"), OtherPawn->GetNetUpdateFrequency(), FMath::Min(15.0f, OtherDefaultNetUpdateFrequency));
+
+	Enable.Set(TEXT("0"));
+	LODSubsystem->EvaluateTiers();
+	TestEqual(TEXT("Disabled LOD restores High"), LODSubsystem->GetMoverLODTier(OtherPawn->MoverComponent), EGCFMoverLODTier::High);
+	TestEqual(TEXT("Disabled LOD restores the net update frequency"), OtherPawn->GetNetUpdateFrequency(), OtherDefaultNetUpdateFrequency);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,107 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Movement/Mover/GCFMoverSettingsSubsystem.h"
+
+#include "DefaultMovementSet/Settings/CommonLegacyMovementSettings.h"
+#include "Misc/AutomationTest.h"
+#include "Movement/GCFMovementConfig.h"
+#include "Tests/GCFMovementTestTypes.h"
+#include "Tests/GCFTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Reads the settings instance the walking mode cached when it registered, i.e. the values it actually moves with. */
+struct FGCFMoverSettingsTestAccess
+{
+	static const UCommonLegacyMovementSettings* GetWalkingSettings(const AGCFTestMoverPawn& Pawn)
+	{
+		const UGCFWalkingMode* WalkingMode = Cast<UGCFWalkingMode>(Pawn.MoverComponent->MovementModes.FindRef(DefaultModeNames::Walking));
+		return WalkingMode ? WalkingMode->CommonLegacySettings.Get() : nullptr;
+	}
+};
+
+
+namespace GCF::Tests
+{
+static UCommonLegacyMovementSettings* GetLegacySettings(const AGCFTestMoverPawn& Pawn)
+{
+	return Pawn.MoverComponent->FindSharedSettings_Mutable<UCommonLegacyMovementSettings>();
+}
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFMoverSettingsSharingTest, "GameCoreFramework.Movement.MoverSettings.Sharing",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFMoverSettingsSharingTest::RunTest(const FString& Parameters)
+{
+	using namespace GCF::Tests;
+
+	FScopedTestWorld World(true);
+	UGCFMoverSettingsSubsystem* Subsystem = World->GetSubsystem<UGCFMoverSettingsSubsystem>();
+	AGCFTestMoverPawn* PawnA = World->SpawnActor<AGCFTestMoverPawn>();
+	AGCFTestMoverPawn* PawnB = World->SpawnActor<AGCFTestMoverPawn>();
+	AGCFTestMoverPawn* PawnC = World->SpawnActor<AGCFTestMoverPawn>();
+	if (!TestNotNull(TEXT("Settings subsystem"), Subsystem) || !TestNotNull(TEXT("Pawn A"), PawnA) || !TestNotNull(TEXT("Pawn B"), PawnB) || !TestNotNull(TEXT("Pawn C"), PawnC)) {
+		return false;
+	}
+
+	UGCFMovementConfig* Config = NewObject<UGCFMovementConfig>(World.Get());
+	Config->MaxSpeed = 450.0f;
+	Config->Acceleration = 1500.0f;
+	Config->Deceleration = 2500.0f;
+
+	// Pawn C starts with a value the config does not cover, as a differently authored pawn would.
+	UCommonLegacyMovementSettings* OwnSettingsA = GetLegacySettings(*PawnA);
+	GetLegacySettings(*PawnC)->GroundFriction = 2.0f;
+	const float DefaultFriction = OwnSettingsA->GroundFriction;
+	TestTrue(TEXT("The walking mode starts on the component's own instance"), FGCFMoverSettingsTestAccess::GetWalkingSettings(*PawnA) == OwnSettingsA);
+
+	IGCFMovementConfigReceiver::Execute_ApplyMovementConfig(PawnA->MoverComponent, Config);
+	IGCFMovementConfigReceiver::Execute_ApplyMovementConfig(PawnB->MoverComponent, Config);
+	IGCFMovementConfigReceiver::Execute_ApplyMovementConfig(PawnC->MoverComponent, Config);
+
+	UCommonLegacyMovementSettings* SharedAB = GetLegacySettings(*PawnA);
+	TestTrue(TEXT("Identical settings and config share one instance"), SharedAB != OwnSettingsA && SharedAB == GetLegacySettings(*PawnB));
+	TestTrue(TEXT("Settings that differ outside the config are not merged"), SharedAB != GetLegacySettings(*PawnC));
+	TestEqual(TEXT("Shared instance keeps values the config does not cover"), SharedAB->GroundFriction, DefaultFriction);
+	TestEqual(TEXT("Other instance keeps its own value"), GetLegacySettings(*PawnC)->GroundFriction, 2.0f);
+
+	// The modes registered before the config was applied, so they must have been pointed at the shared instance.
+	const UCommonLegacyMovementSettings* WalkingSettings = FGCFMoverSettingsTestAccess::GetWalkingSettings(*PawnA);
+	TestTrue(TEXT("The walking mode reads the shared instance"), WalkingSettings == SharedAB);
+	TestEqual(TEXT("The walking mode moves with the config speed"), WalkingSettings ? WalkingSettings->MaxSpeed : 0.0f, 450.0f);
+	TestEqual(TEXT("The walking mode moves with the config deceleration"), WalkingSettings ? WalkingSettings->Deceleration : 0.0f, 2500.0f);
+
+	IGCFMovementConfigReceiver::Execute_ApplyMovementConfig(PawnA->MoverComponent, Config);
+	TestTrue(TEXT("Re-applying the config keeps the shared instance"), GetLegacySettings(*PawnA) == SharedAB);
+
+	// Copy-on-write: a runtime override detaches only the requesting pawn.
+	UCommonLegacyMovementSettings* PrivateA = PawnA->MoverComponent->GetMutableLegacyMovementSettings();
+	if (!TestNotNull(TEXT("Private copy"), PrivateA)) {
+		return false;
+	}
+	TestTrue(TEXT("Private copy replaces the shared entry"), PrivateA != SharedAB && GetLegacySettings(*PawnA) == PrivateA);
+	TestTrue(TEXT("The walking mode reads the private copy"), FGCFMoverSettingsTestAccess::GetWalkingSettings(*PawnA) == PrivateA);
+	TestTrue(TEXT("Other pawn keeps the shared instance"), GetLegacySettings(*PawnB) == SharedAB && FGCFMoverSettingsTestAccess::GetWalkingSettings(*PawnB) == SharedAB);
+
+	PrivateA->GroundFriction = 1.0f;
+	TestEqual(TEXT("Override does not leak into the shared instance"), SharedAB->GroundFriction, DefaultFriction);
+
+	Config->MaxSpeed = 600.0f;
+	IGCFMovementConfigReceiver::Execute_ApplyMovementConfig(PawnA->MoverComponent, Config);
+	TestTrue(TEXT("Config applies write into the private copy"), GetLegacySettings(*PawnA) == PrivateA);
+	TestEqual(TEXT("The walking mode moves with the new config speed"), FGCFMoverSettingsTestAccess::GetWalkingSettings(*PawnA)->MaxSpeed, 600.0f);
+	TestEqual(TEXT("Private copy keeps the runtime override"), PrivateA->GroundFriction, 1.0f);
+	TestEqual(TEXT("Shared instance is unchanged"), SharedAB->MaxSpeed, 450.0f);
+
+	// A config change on a shared pawn moves it to another shared instance and rebinds its modes again.
+	IGCFMovementConfigReceiver::Execute_ApplyMovementConfig(PawnB->MoverComponent, Config);
+	TestTrue(TEXT("A new config value selects another shared instance"), GetLegacySettings(*PawnB) != SharedAB);
+	TestEqual(TEXT("The walking mode follows the new shared instance"), FGCFMoverSettingsTestAccess::GetWalkingSettings(*PawnB)->MaxSpeed, 600.0f);
+
+	return true;
+}
+
+#endif
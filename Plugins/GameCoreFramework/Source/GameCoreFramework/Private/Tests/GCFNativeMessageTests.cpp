@@ -0,0 +1,155 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Messages/GCFNativeMessageSubsystem.h"
+#include "Messages/GCFGameplayMessages.h"
+#include "Common/GCFGameplayTags.h"
+#include "GameFramework/GameplayMessageSubsystem.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GCF::Tests
+{
+/** Number of broadcasts the benchmark issues, matching one frame of worst-case GCF-internal traffic. */
+static constexpr int32 NativeMessageBenchmarkCount = 10000;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFNativeMessageDeliveryTest, "GameCoreFramework.Messages.Native.Delivery",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFNativeMessageDeliveryTest::RunTest(const FString& Parameters)
+{
+	UGCFNativeMessageSubsystem* Subsystem = NewObject<UGCFNativeMessageSubsystem>(GetTransientPackage());
+
+	FGCFCameraModeChangedMessage Message;
+	Message.NewCameraModeTag = GCFGameplayTags::Camera_Mode_ThirdPerson;
+
+	const void* ReceivedAddress = nullptr;
+	int32 CameraCount = 0;
+	int32 CursorCount = 0;
+
+	TestFalse(TEXT("No listeners before registration"), Subsystem->HasListeners<FGCFCameraModeChangedMessage>());
+
+	FGCFNativeMessageListenerHandle CameraHandle = Subsystem->RegisterListener<FGCFCameraModeChangedMessage>(
+		[&](const FGCFCameraModeChangedMessage& Payload) {
+			ReceivedAddress = &Payload;
+			++CameraCount;
+		});
+	FGCFNativeMessageListenerHandle CursorHandle = Subsystem->RegisterListener<FGCFPolicyChangedCursorMessage>(
+		[&](const FGCFPolicyChangedCursorMessage&) { ++CursorCount; });
+
+	TestTrue(TEXT("Listener is reported after registration"), Subsystem->HasListeners<FGCFCameraModeChangedMessage>());
+
+	Subsystem->BroadcastMessage(Message);
+	TestEqual(TEXT("Camera listener received the camera message"), CameraCount, 1);
+	TestEqual(TEXT("Cursor listener ignored the camera message"), CursorCount, 0);
+	TestTrue(TEXT("Payload is passed by reference, not copied"), ReceivedAddress == &Message);
+
+	Subsystem->UnregisterListener(CameraHandle);
+	TestFalse(TEXT("Unregister invalidates the handle"), CameraHandle.IsValid());
+	TestFalse(TEXT("No listeners after unregistration"), Subsystem->HasListeners<FGCFCameraModeChangedMessage>());
+
+	Subsystem->BroadcastMessage(Message);
+	TestEqual(TEXT("Unregistered listener is not called"), CameraCount, 1);
+
+	Subsystem->UnregisterListener(CursorHandle);
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFNativeMessageReentrancyTest, "GameCoreFramework.Messages.Native.Reentrancy",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFNativeMessageReentrancyTest::RunTest(const FString& Parameters)
+{
+	UGCFNativeMessageSubsystem* Subsystem = NewObject<UGCFNativeMessageSubsystem>(GetTransientPackage());
+
+	FGCFNativeMessageListenerHandle SelfRemovingHandle;
+	FGCFNativeMessageListenerHandle AddedHandle;
+	int32 SelfRemovingCount = 0;
+	int32 SecondCount = 0;
+	int32 AddedCount = 0;
+
+	SelfRemovingHandle = Subsystem->RegisterListener<FGCFCameraModeChangedMessage>(
+		[&](const FGCFCameraModeChangedMessage&) {
+			++SelfRemovingCount;
+			Subsystem->UnregisterListener(SelfRemovingHandle);
+			AddedHandle = Subsystem->RegisterListener<FGCFCameraModeChangedMessage>(
+				[&](const FGCFCameraModeChangedMessage&) { ++AddedCount; });
+		});
+	FGCFNativeMessageListenerHandle SecondHandle = Subsystem->RegisterListener<FGCFCameraModeChangedMessage>(
+		[&](const FGCFCameraModeChangedMessage&) { ++SecondCount; });
+
+	const FGCFCameraModeChangedMessage Message;
+	Subsystem->BroadcastMessage(Message);
+	TestEqual(TEXT("Self-removing listener ran once"), SelfRemovingCount, 1);
+	TestEqual(TEXT("Listener after a removed one still ran"), SecondCount, 1);
+	TestEqual(TEXT("Listener added during the broadcast waits for the next one"), AddedCount, 0);
+
+	Subsystem->BroadcastMessage(Message);
+	TestEqual(TEXT("Removed listener is not called again"), SelfRemovingCount, 1);
+	TestEqual(TEXT("Remaining listener ran again"), SecondCount, 2);
+	TestEqual(TEXT("Added listener ran on the next broadcast"), AddedCount, 1);
+
+	Subsystem->UnregisterListener(SecondHandle);
+	Subsystem->UnregisterListener(AddedHandle);
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFNativeMessageBenchmarkTest, "GameCoreFramework.Messages.Native.Benchmark",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFNativeMessageBenchmarkTest::RunTest(const FString& Parameters)
+{
+	UGCFNativeMessageSubsystem* NativeSubsystem = NewObject<UGCFNativeMessageSubsystem>(GetTransientPackage());
+	UGameplayMessageSubsystem* GenericSubsystem = NewObject<UGameplayMessageSubsystem>(GetTransientPackage());
+
+	FGCFCameraModeChangedMessage Message;
+	Message.NewCameraModeTag = GCFGameplayTags::Camera_Mode_ThirdPerson;
+
+	// Typed native channel
+	int32 NativeReceived = 0;
+	double NativeSeconds = 0.0;
+	{
+		FGCFNativeMessageListenerHandle Handle = NativeSubsystem->RegisterListener<FGCFCameraModeChangedMessage>(
+			[&NativeReceived](const FGCFCameraModeChangedMessage&) { ++NativeReceived; });
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < GCF::Tests::NativeMessageBenchmarkCount; ++i) {
+			NativeSubsystem->BroadcastMessage(Message);
+		}
+		NativeSeconds = FPlatformTime::Seconds() - StartTime;
+
+		NativeSubsystem->UnregisterListener(Handle);
+	}
+
+	// Generic GameplayMessage path, as a baseline
+	int32 GenericReceived = 0;
+	double GenericSeconds = 0.0;
+	{
+		FGameplayMessageListenerHandle Handle = GenericSubsystem->RegisterListener<FGCFCameraModeChangedMessage>(GCFGameplayTags::Message_Camera_ModeChange,
+			[&GenericReceived](FGameplayTag, const FGCFCameraModeChangedMessage&) { ++GenericReceived; });
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < GCF::Tests::NativeMessageBenchmarkCount; ++i) {
+			GenericSubsystem->BroadcastMessage(GCFGameplayTags::Message_Camera_ModeChange, Message);
+		}
+		GenericSeconds = FPlatformTime::Seconds() - StartTime;
+
+		GenericSubsystem->UnregisterListener(Handle);
+	}
+
+	TestEqual(TEXT("Every native broadcast was delivered"), NativeReceived, GCF::Tests::NativeMessageBenchmarkCount);
+	TestEqual(TEXT("Every GameplayMessage broadcast was delivered"), GenericReceived, GCF::Tests::NativeMessageBenchmarkCount);
+
+	AddInfo(FString::Printf(TEXT("%d broadcasts. Native: %.3f ms, GameplayMessage: %.3f ms"),
+		GCF::Tests::NativeMessageBenchmarkCount, NativeSeconds * 1000.0, GenericSeconds * 1000.0));
+	return true;
+}
+
+#endif
@@ -0,0 +1,118 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Components/BoxComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/IConsoleManager.h"
+
+namespace GCF::Tests
+{
+/**
+ * Transient game world for automation tests. Destroyed when the scope ends.
+ * Without a game mode, BeginPlay is dispatched through the world settings directly.
+ */
+class FScopedTestWorld
+{
+public:
+	explicit FScopedTestWorld(bool bBeginPlay = false)
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("GCFTestWorld"));
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		if (bBeginPlay) {
+			World->InitializeActorsForPlay(FURL());
+			World->BeginPlay();
+			if (!World->HasBegunPlay()) {
+				World->GetWorldSettings()->NotifyBeginPlay();
+			}
+		}
+	}
+
+	~FScopedTestWorld()
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+
+	FScopedTestWorld(const FScopedTestWorld&) = delete;
+	FScopedTestWorld& operator=(const FScopedTestWorld&) = delete;
+
+	UWorld* Get() const { return World; }
+	UWorld* operator->() const { return World; }
+
+	/** Advances the world by the given number of frames. */
+	void Tick(int32 FrameCount = 1, float DeltaSeconds = 1.0f / 60.0f) const
+	{
+		for (int32 i = 0; i < FrameCount; ++i) {
+			World->Tick(LEVELTICK_All, DeltaSeconds);
+			++GFrameCounter;
+		}
+	}
+
+private:
+	UWorld* World = nullptr;
+};
+
+/** Sets a console variable for the scope of the test and restores the previous value afterwards. */
+class FScopedConsoleVariable
+{
+public:
+	FScopedConsoleVariable(const TCHAR* Name, const TCHAR* Value)
+		: Variable(IConsoleManager::Get().FindConsoleVariable(Name))
+	{
+		if (Variable) {
+			PreviousValue = Variable->GetString();
+			Variable->Set(Value, ECVF_SetByCode);
+		}
+	}
+
+	~FScopedConsoleVariable()
+	{
+		if (Variable) {
+			Variable->Set(*PreviousValue, ECVF_SetByCode);
+		}
+	}
+
+	void Set(const TCHAR* Value) const
+	{
+		if (Variable) {
+			Variable->Set(Value, ECVF_SetByCode);
+		}
+	}
+
+private:
+	IConsoleVariable* Variable = nullptr;
+	FString PreviousValue;
+};
+
+/** Spawns a blocking box with the given center, extent and rotation. */
+inline AActor* SpawnTestBox(UWorld* World, const FVector& Center, const FVector& Extent, const FRotator& Rotation = FRotator::ZeroRotator)
+{
+	AActor* Actor = World->SpawnActor<AActor>();
+	UBoxComponent* Box = NewObject<UBoxComponent>(Actor);
+	Box->SetBoxExtent(Extent);
+	Box->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+	Actor->SetRootComponent(Box);
+	Box->RegisterComponent();
+	Box->SetWorldLocationAndRotation(Center, Rotation);
+	return Actor;
+}
+
+/** Spawns a large blocking box whose top face is at Z = 0. */
+inline AActor* SpawnTestFloor(UWorld* World)
+{
+	return SpawnTestBox(World, FVector(0.0, 0.0, -50.0), FVector(100000.0, 100000.0, 50.0));
+}
+}
+
+#endif
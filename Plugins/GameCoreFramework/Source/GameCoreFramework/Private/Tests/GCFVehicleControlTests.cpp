@@ -0,0 +1,70 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Actor/Vehicle/GCFVehicleControlComponent.h"
+
+#include "AIController.h"
+#include "Misc/AutomationTest.h"
+#include "Actor/Vehicle/GCFWheeledVehiclePawn.h"
+#include "Movement/Locomotion/GCFLocomotionInputHandler.h"
+#include "Tests/GCFTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+struct FGCFVehicleControlComponentTestAccess
+{
+	static bool IsDriveInputCleared(const UGCFVehicleControlComponent& Component)
+	{
+		return Component.LastThrottle == 0.0f && Component.LastBrake == 0.0f && Component.LastSteering == 0.0f;
+	}
+};
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFVehicleDriveInputResetTest, "GameCoreFramework.Vehicle.Control.DriveInputReset",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFVehicleDriveInputResetTest::RunTest(const FString& Parameters)
+{
+	using namespace GCF::Tests;
+
+	FScopedTestWorld World(true);
+
+	AGCFWheeledVehiclePawn* Vehicle = World->SpawnActor<AGCFWheeledVehiclePawn>();
+	AAIController* FirstDriver = World->SpawnActor<AAIController>();
+	AAIController* SecondDriver = World->SpawnActor<AAIController>();
+	if (!TestNotNull(TEXT("Vehicle"), Vehicle) || !TestNotNull(TEXT("First driver"), FirstDriver) || !TestNotNull(TEXT("Second driver"), SecondDriver)) {
+		return false;
+	}
+
+	UGCFVehicleControlComponent* ControlComponent = Vehicle->FindComponentByClass<UGCFVehicleControlComponent>();
+	if (!TestNotNull(TEXT("Vehicle control component"), ControlComponent)) {
+		return false;
+	}
+
+	const auto Drive = [Vehicle]() {
+		IGCFLocomotionInputHandler::Execute_HandleMoveInput(Vehicle, FVector2D(1.0, 0.5), FRotator::ZeroRotator);
+	};
+
+	// Server: possession, a driver swap and unpossession each clear the cache.
+	FirstDriver->Possess(Vehicle);
+	Drive();
+	TestFalse(TEXT("Driving fills the cache"), FGCFVehicleControlComponentTestAccess::IsDriveInputCleared(*ControlComponent));
+
+	SecondDriver->Possess(Vehicle);
+	TestTrue(TEXT("Cache is cleared when another driver takes over"), FGCFVehicleControlComponentTestAccess::IsDriveInputCleared(*ControlComponent));
+
+	Drive();
+	SecondDriver->UnPossess();
+	TestTrue(TEXT("Cache is cleared when the driver leaves"), FGCFVehicleControlComponentTestAccess::IsDriveInputCleared(*ControlComponent));
+
+	// Owning client: the controller change arrives through replication, without PossessedBy or UnPossessed.
+	Vehicle->SetRole(ROLE_AutonomousProxy);
+	Drive();
+	static_cast<APawn*>(Vehicle)->NotifyControllerChanged();
+	TestTrue(TEXT("Cache is cleared on a replicated controller change"), FGCFVehicleControlComponentTestAccess::IsDriveInputCleared(*ControlComponent));
+	Vehicle->SetRole(ROLE_Authority);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,171 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Actor/Vehicle/GCFWheeledVehiclePawn.h"
+
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GCF::Tests
+{
+static constexpr uint8 HeadLightBit = static_cast<uint8>(EGCFVehicleCosmeticState::HeadLight);
+static constexpr uint8 HandBrakeBit = static_cast<uint8>(EGCFVehicleCosmeticState::HandBrake);
+
+/** One unreliable server RPC in flight. */
+struct FCosmeticRequestPacket
+{
+	uint8 SetMask = 0;
+	uint8 ClearMask = 0;
+	uint8 Sequence = 0;
+};
+
+/**
+ * Server and driver's client of the cosmetic state protocol, connected by a lossy, reordering link.
+ * Replication is state based: a delivered update carries the server's current values.
+ */
+struct FCosmeticStateSimulation
+{
+	// Server
+	uint8 ServerState = 0;
+	uint8 ServerAppliedSequence = 0;
+
+	// Client
+	uint8 ReplicatedState = 0;
+	uint8 ReplicatedAppliedSequence = 0;
+	FGCFVehicleCosmeticRequest Request;
+
+	TArray<FCosmeticRequestPacket> InFlight;
+
+	void ClientSet(EGCFVehicleCosmeticState Flag, bool bEnabled)
+	{
+		if (Request.Request(Flag, bEnabled, ReplicatedState)) {
+			Send();
+		}
+	}
+
+	void ClientToggleHeadLight()
+	{
+		ClientSet(EGCFVehicleCosmeticState::HeadLight, (Request.Predict(ReplicatedState) & HeadLightBit) == 0);
+	}
+
+	void Send()
+	{
+		InFlight.Add({Request.SetMask, Request.ClearMask, Request.Sequence});
+	}
+
+	/** Delivers, drops or delays every packet in flight, resends a pending request, then replicates. */
+	void Step(FRandomStream& Random, float LossRate)
+	{
+		TArray<FCosmeticRequestPacket> Delayed;
+		Random.Shuffle(InFlight);
+		for (const FCosmeticRequestPacket& Packet : InFlight) {
+			if (Random.FRand() < LossRate) {
+				continue;
+			}
+			if (Random.FRand() < 0.25f) {
+				Delayed.Add(Packet);
+				continue;
+			}
+			FGCFVehicleCosmeticRequest::ApplyRequest(ServerState, ServerAppliedSequence, Packet.SetMask, Packet.ClearMask, Packet.Sequence);
+		}
+		InFlight = MoveTemp(Delayed);
+
+		if (Request.IsPending()) {
+			Send();
+		}
+
+		if (Random.FRand() >= LossRate) {
+			ReplicatedState = ServerState;
+			ReplicatedAppliedSequence = ServerAppliedSequence;
+			Request.Acknowledge(ReplicatedAppliedSequence);
+		}
+	}
+};
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFVehicleCosmeticRequestTest, "GameCoreFramework.Vehicle.Cosmetic.Request",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFVehicleCosmeticRequestTest::RunTest(const FString& Parameters)
+{
+	using namespace GCF::Tests;
+
+	FGCFVehicleCosmeticRequest Request;
+	TestTrue(TEXT("Turning the headlight on is a change"), Request.Request(EGCFVehicleCosmeticState::HeadLight, true, HandBrakeBit));
+	TestEqual(TEXT("Only the changed bit is set"), Request.SetMask, HeadLightBit);
+	TestEqual(TEXT("Nothing is cleared"), Request.ClearMask, static_cast<uint8>(0));
+	TestEqual(TEXT("Prediction keeps the other bits"), Request.Predict(HandBrakeBit), static_cast<uint8>(HeadLightBit | HandBrakeBit));
+	TestFalse(TEXT("Repeating a pending change is not a new request"), Request.Request(EGCFVehicleCosmeticState::HeadLight, true, HandBrakeBit));
+
+	// The server released the handbrake on its own before the request arrived: the request must not bring it back.
+	uint8 ServerState = 0;
+	uint8 AppliedSequence = 0;
+	TestTrue(TEXT("Newer request is applied"), FGCFVehicleCosmeticRequest::ApplyRequest(ServerState, AppliedSequence, Request.SetMask, Request.ClearMask, Request.Sequence));
+	TestEqual(TEXT("Server-authored bit is kept"), ServerState, HeadLightBit);
+	TestFalse(TEXT("Resend of an applied request is ignored"), FGCFVehicleCosmeticRequest::ApplyRequest(ServerState, AppliedSequence, 0, HeadLightBit, Request.Sequence));
+
+	// The ack is the applied sequence, regardless of what the server did to other bits.
+	TestFalse(TEXT("Older sequence does not acknowledge"), Request.Acknowledge(static_cast<uint8>(Request.Sequence - 1)));
+	TestTrue(TEXT("Applied sequence acknowledges"), Request.Acknowledge(AppliedSequence));
+	TestFalse(TEXT("Nothing is pending after the ack"), Request.IsPending());
+
+	// Sequences compare across wrap-around.
+	TestTrue(TEXT("Sequence 1 is newer than 255"), FGCFVehicleCosmeticRequest::IsNewerSequence(1, 255));
+	TestFalse(TEXT("Sequence 255 is older than 1"), FGCFVehicleCosmeticRequest::IsNewerSequence(255, 1));
+
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFVehicleCosmeticConvergenceTest, "GameCoreFramework.Vehicle.Cosmetic.Convergence",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFVehicleCosmeticConvergenceTest::RunTest(const FString& Parameters)
+{
+	using namespace GCF::Tests;
+
+	static constexpr int32 RunCount = 50;
+	static constexpr int32 ActiveSteps = 300;
+	static constexpr int32 SettleSteps = 200;
+	static constexpr float LossRate = 0.5f;
+
+	for (int32 Run = 0; Run < RunCount; ++Run) {
+		FRandomStream Random(Run);
+		FCosmeticStateSimulation Simulation;
+
+		// The client toggles the headlights, the server sets the handbrake indicator on its own.
+		bool bExpectedHeadLight = false;
+		bool bExpectedHandBrake = false;
+		for (int32 Step = 0; Step < ActiveSteps; ++Step) {
+			if (Random.FRand() < 0.2f) {
+				Simulation.ClientToggleHeadLight();
+				bExpectedHeadLight = !bExpectedHeadLight;
+			}
+			if (Random.FRand() < 0.05f) {
+				bExpectedHandBrake = !bExpectedHandBrake;
+				Simulation.ServerState = static_cast<uint8>(bExpectedHandBrake ? (Simulation.ServerState | HandBrakeBit) : (Simulation.ServerState & ~HandBrakeBit));
+			}
+			Simulation.Step(Random, LossRate);
+		}
+
+		for (int32 Step = 0; Step < SettleSteps && (Simulation.Request.IsPending() || Simulation.ReplicatedState != Simulation.ServerState); ++Step) {
+			Simulation.Step(Random, LossRate);
+		}
+
+		const FString Context = FString::Printf(TEXT("Run %d: "), Run);
+		if (!TestFalse(Context + TEXT("Client request is acknowledged"), Simulation.Request.IsPending())
+			|| !TestEqual(Context + TEXT("Client replica matches the server"), Simulation.ReplicatedState, Simulation.ServerState)
+			|| !TestEqual(Context + TEXT("Server has the client's last headlight request"), (Simulation.ServerState & HeadLightBit) != 0, bExpectedHeadLight)
+			|| !TestEqual(Context + TEXT("Server keeps its own handbrake indicator"), (Simulation.ServerState & HandBrakeBit) != 0, bExpectedHandBrake)) {
+			return false;
+		}
+	}
+
+	AddInfo(FString::Printf(TEXT("%d runs of %d steps at %.0f%% loss converged."), RunCount, ActiveSteps, LossRate * 100.0f));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
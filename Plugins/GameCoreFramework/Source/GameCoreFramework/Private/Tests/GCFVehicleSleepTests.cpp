@@ -0,0 +1,161 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Actor/Vehicle/GCFVehicleSleepSubsystem.h"
+
+#include "AIController.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Actor/Vehicle/GCFVehicleControlComponent.h"
+#include "Actor/Vehicle/GCFWheeledVehiclePawn.h"
+#include "Tests/GCFTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GCF::Tests
+{
+/** Sample vehicle shipped with the plugin; the GCF base classes carry no mesh or physics asset. */
+static const TCHAR* SampleVehicleClassPath = TEXT("/GameCoreFramework/Sample/Blueprints/Actor/SportsCar/BP_VehicleAdvSportsCar.BP_VehicleAdvSportsCar_C");
+
+static constexpr int32 VehicleSleepBenchmarkCount = 200;
+static constexpr int32 VehicleSleepBenchmarkWarmupFrames = 10;
+static constexpr int32 VehicleSleepBenchmarkMeasuredFrames = 60;
+static constexpr double VehicleSleepBenchmarkSpacing = 600.0;
+
+/** Returns the average milliseconds per frame of the measured frames, after the warm-up frames. */
+static double MeasureVehicleSleepFrames(const FScopedTestWorld& World)
+{
+	World.Tick(VehicleSleepBenchmarkWarmupFrames);
+
+	const double StartSeconds = FPlatformTime::Seconds();
+	World.Tick(VehicleSleepBenchmarkMeasuredFrames);
+	return (FPlatformTime::Seconds() - StartSeconds) * 1000.0 / VehicleSleepBenchmarkMeasuredFrames;
+}
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFVehicleSleepStateTest, "GameCoreFramework.Vehicle.Sleep.State",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFVehicleSleepStateTest::RunTest(const FString& Parameters)
+{
+	using namespace GCF::Tests;
+
+	// The speed rule depends on the physics settling; it is not what this test covers.
+	FScopedConsoleVariable Enable(TEXT("GCF.Vehicle.Sleep.Enable"), TEXT("1"));
+	FScopedConsoleVariable Force(TEXT("GCF.Vehicle.Sleep.Force"), TEXT("-1"));
+	FScopedConsoleVariable Delay(TEXT("GCF.Vehicle.Sleep.Delay"), TEXT("0"));
+	FScopedConsoleVariable SpeedThreshold(TEXT("GCF.Vehicle.Sleep.SpeedThreshold"), TEXT("100000"));
+	FScopedConsoleVariable NetUpdateFrequency(TEXT("GCF.Vehicle.Sleep.NetUpdateFrequency"), TEXT("1"));
+
+	FScopedTestWorld World(true);
+	SpawnTestFloor(World.Get());
+
+	UGCFVehicleSleepSubsystem* Subsystem = UGCFVehicleSleepSubsystem::Get(World.Get());
+	if (!TestNotNull(TEXT("Sleep subsystem"), Subsystem)) {
+		return false;
+	}
+
+	UClass* VehicleClass = LoadClass<AGCFWheeledVehiclePawn>(nullptr, SampleVehicleClassPath);
+	if (!VehicleClass) {
+		AddInfo(TEXT("Sample vehicle not found, using the bare vehicle pawn."));
+		VehicleClass = AGCFWheeledVehiclePawn::StaticClass();
+	}
+
+	AGCFWheeledVehiclePawn* Vehicle = World->SpawnActor<AGCFWheeledVehiclePawn>(VehicleClass, FTransform(FVector(0.0, 0.0, 100.0)));
+	AAIController* Controller = World->SpawnActor<AAIController>();
+	if (!TestNotNull(TEXT("Vehicle"), Vehicle) || !TestNotNull(TEXT("Controller"), Controller)) {
+		return false;
+	}
+
+	UGCFVehicleControlComponent* ControlComponent = Vehicle->FindComponentByClass<UGCFVehicleControlComponent>();
+	const bool bControlTickEnabled = ControlComponent && ControlComponent->IsComponentTickEnabled();
+	const float DefaultNetUpdateFrequency = Vehicle->GetNetUpdateFrequency();
+
+	// No player views the vehicle, so a parked vehicle sleeps on the next evaluation.
+	Subsystem->EvaluateVehicles();
+	TestTrue(TEXT("Parked vehicle sleeps"), Subsystem->IsVehicleSleeping(Vehicle));
+	TestTrue(TEXT("Sleeping vehicle replicates at the sleep rate"), Vehicle->GetNetUpdateFrequency() <= 1.0f);
+	if (ControlComponent) {
+		TestFalse(TEXT("Sleeping vehicle's control component does not tick"), ControlComponent->IsComponentTickEnabled());
+	}
+
+	// Possession wakes the vehicle immediately and restores what sleep changed.
+	Controller->Possess(Vehicle);
+	TestFalse(TEXT("Possession wakes the vehicle"), Subsystem->IsVehicleSleeping(Vehicle));
+	TestEqual(TEXT("Net update frequency is restored"), Vehicle->GetNetUpdateFrequency(), DefaultNetUpdateFrequency);
+	if (ControlComponent) {
+		TestEqual(TEXT("Control component tick is restored"), ControlComponent->IsComponentTickEnabled(), bControlTickEnabled);
+	}
+
+	Subsystem->EvaluateVehicles();
+	TestFalse(TEXT("Possessed vehicle never sleeps"), Subsystem->IsVehicleSleeping(Vehicle));
+
+	Controller->UnPossess();
+	Subsystem->EvaluateVehicles();
+	TestTrue(TEXT("Vehicle sleeps again once unpossessed"), Subsystem->IsVehicleSleeping(Vehicle));
+
+	Enable.Set(TEXT("0"));
+	Subsystem->EvaluateVehicles();
+	TestFalse(TEXT("Disabling the subsystem wakes every vehicle"), Subsystem->IsVehicleSleeping(Vehicle));
+
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFVehicleSleepBenchmarkTest, "GameCoreFramework.Vehicle.Sleep.Benchmark",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFVehicleSleepBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace GCF::Tests;
+
+	FScopedConsoleVariable Enable(TEXT("GCF.Vehicle.Sleep.Enable"), TEXT("1"));
+	FScopedConsoleVariable Force(TEXT("GCF.Vehicle.Sleep.Force"), TEXT("0"));
+
+	UClass* VehicleClass = LoadClass<AGCFWheeledVehiclePawn>(nullptr, SampleVehicleClassPath);
+	if (!TestNotNull(TEXT("Sample vehicle class"), VehicleClass)) {
+		return false;
+	}
+
+	FScopedTestWorld World(true);
+	SpawnTestFloor(World.Get());
+
+	UGCFVehicleSleepSubsystem* Subsystem = UGCFVehicleSleepSubsystem::Get(World.Get());
+	if (!TestNotNull(TEXT("Sleep subsystem"), Subsystem)) {
+		return false;
+	}
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	// Square grid of parked, unpossessed vehicles.
+	const int32 Columns = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(VehicleSleepBenchmarkCount)));
+	TArray<AGCFWheeledVehiclePawn*> Vehicles;
+	for (int32 Index = 0; Index < VehicleSleepBenchmarkCount; ++Index) {
+		const FVector Location((Index / Columns) * VehicleSleepBenchmarkSpacing, (Index % Columns) * VehicleSleepBenchmarkSpacing, 100.0);
+		if (AGCFWheeledVehiclePawn* Vehicle = World->SpawnActor<AGCFWheeledVehiclePawn>(VehicleClass, FTransform(Location), SpawnParameters)) {
+			Vehicles.Add(Vehicle);
+		}
+	}
+	if (!TestEqual(TEXT("Spawned vehicles"), Vehicles.Num(), VehicleSleepBenchmarkCount)) {
+		return false;
+	}
+
+	Subsystem->EvaluateVehicles();
+	const double AwakeMilliseconds = MeasureVehicleSleepFrames(World);
+
+	Force.Set(TEXT("1"));
+	Subsystem->EvaluateVehicles();
+	const int32 SleepingCount = Vehicles.FilterByPredicate([Subsystem](const AGCFWheeledVehiclePawn* Vehicle) { return Subsystem->IsVehicleSleeping(Vehicle); }).Num();
+	TestEqual(TEXT("Every parked vehicle sleeps"), SleepingCount, Vehicles.Num());
+
+	const double AsleepMilliseconds = MeasureVehicleSleepFrames(World);
+
+	AddInfo(FString::Printf(TEXT("%d vehicles. Awake %.3f ms/frame, asleep %.3f ms/frame, saved %.3f us/vehicle."),
+		Vehicles.Num(), AwakeMilliseconds, AsleepMilliseconds, (AwakeMilliseconds - AsleepMilliseconds) * 1000.0 / Vehicles.Num()));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
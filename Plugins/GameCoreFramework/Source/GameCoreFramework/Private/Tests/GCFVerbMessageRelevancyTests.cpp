@@ -0,0 +1,163 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "Messages/GCFVerbMessage.h"
+#include "Messages/GCFVerbMessageHelpers.h"
+#include "AIController.h"
+#include "GameFramework/DefaultPawn.h"
+#include "GameFramework/PlayerState.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/GCFTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GCF::Tests
+{
+static GCFVerbMessageHelpers::FRelevancyReceiver MakeReceiverAt(const FVector& ViewLocation)
+{
+	GCFVerbMessageHelpers::FRelevancyReceiver Receiver;
+	Receiver.bHasViewLocation = true;
+	Receiver.ViewLocation = ViewLocation;
+	return Receiver;
+}
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFVerbMessageRelevancyAllTest, "GameCoreFramework.Messages.VerbRelevancy.All",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFVerbMessageRelevancyAllTest::RunTest(const FString& Parameters)
+{
+	FGCFVerbMessage Message;
+	TestTrue(TEXT("Default relevancy reaches a receiver with nothing resolved"),
+		GCFVerbMessageHelpers::IsMessageRelevantToReceiver(Message, GCFVerbMessageHelpers::NoTeamId, GCFVerbMessageHelpers::FRelevancyReceiver()));
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFVerbMessageRelevancyTeamTest, "GameCoreFramework.Messages.VerbRelevancy.TeamOnly",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFVerbMessageRelevancyTeamTest::RunTest(const FString& Parameters)
+{
+	FGCFVerbMessage Message;
+	Message.Relevancy = EGCFVerbMessageRelevancy::TeamOnly;
+
+	GCFVerbMessageHelpers::FRelevancyReceiver SameTeam;
+	SameTeam.TeamId = 1;
+	GCFVerbMessageHelpers::FRelevancyReceiver OtherTeam;
+	OtherTeam.TeamId = 2;
+	GCFVerbMessageHelpers::FRelevancyReceiver NoTeam;
+
+	TestTrue(TEXT("Same team receives"), GCFVerbMessageHelpers::IsMessageRelevantToReceiver(Message, 1, SameTeam));
+	TestFalse(TEXT("Other team does not receive"), GCFVerbMessageHelpers::IsMessageRelevantToReceiver(Message, 1, OtherTeam));
+	TestFalse(TEXT("Teamless receiver does not receive"), GCFVerbMessageHelpers::IsMessageRelevantToReceiver(Message, 1, NoTeam));
+	TestFalse(TEXT("Teamless instigator reaches nobody, not even teamless receivers"),
+		GCFVerbMessageHelpers::IsMessageRelevantToReceiver(Message, GCFVerbMessageHelpers::NoTeamId, NoTeam));
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFVerbMessageRelevancyParticipantsTest, "GameCoreFramework.Messages.VerbRelevancy.Participants",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFVerbMessageRelevancyParticipantsTest::RunTest(const FString& Parameters)
+{
+	FGCFVerbMessage Message;
+	Message.Relevancy = EGCFVerbMessageRelevancy::Participants;
+
+	GCFVerbMessageHelpers::FRelevancyReceiver Participant;
+	Participant.bIsParticipant = true;
+
+	TestTrue(TEXT("Participant receives"), GCFVerbMessageHelpers::IsMessageRelevantToReceiver(Message, GCFVerbMessageHelpers::NoTeamId, Participant));
+	TestFalse(TEXT("Bystander does not receive"), GCFVerbMessageHelpers::IsMessageRelevantToReceiver(Message, GCFVerbMessageHelpers::NoTeamId, GCFVerbMessageHelpers::FRelevancyReceiver()));
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFVerbMessageRelevancyRadiusTest, "GameCoreFramework.Messages.VerbRelevancy.WithinRadius",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFVerbMessageRelevancyRadiusTest::RunTest(const FString& Parameters)
+{
+	using namespace GCF::Tests;
+
+	FGCFVerbMessage Message;
+	Message.Relevancy = EGCFVerbMessageRelevancy::WithinRadius;
+	Message.RelevancyRadius = 1000.0f;
+
+	// An explicit origin at the world origin is a real origin, not "unset".
+	Message.bHasRelevancyOrigin = true;
+	Message.RelevancyOrigin = FVector::ZeroVector;
+
+	FVector ResolvedOrigin(1.0, 2.0, 3.0);
+	TestTrue(TEXT("Explicit zero origin resolves"), GCFVerbMessageHelpers::ResolveRelevancyOrigin(Message, ResolvedOrigin));
+	TestEqual(TEXT("Explicit zero origin is used as is"), ResolvedOrigin, FVector::ZeroVector);
+
+	TestTrue(TEXT("Receiver inside the radius"), GCFVerbMessageHelpers::IsMessageRelevantToReceiver(Message, GCFVerbMessageHelpers::NoTeamId, MakeReceiverAt(FVector(999.0, 0.0, 0.0))));
+	TestTrue(TEXT("Receiver on the radius"), GCFVerbMessageHelpers::IsMessageRelevantToReceiver(Message, GCFVerbMessageHelpers::NoTeamId, MakeReceiverAt(FVector(0.0, 1000.0, 0.0))));
+	TestFalse(TEXT("Receiver outside the radius"), GCFVerbMessageHelpers::IsMessageRelevantToReceiver(Message, GCFVerbMessageHelpers::NoTeamId, MakeReceiverAt(FVector(0.0, 0.0, 1001.0))));
+	TestFalse(TEXT("Receiver without a view location"), GCFVerbMessageHelpers::IsMessageRelevantToReceiver(Message, GCFVerbMessageHelpers::NoTeamId, GCFVerbMessageHelpers::FRelevancyReceiver()));
+
+	Message.RelevancyRadius = 0.0f;
+	TestFalse(TEXT("Zero radius reaches nobody"), GCFVerbMessageHelpers::IsMessageRelevantToReceiver(Message, GCFVerbMessageHelpers::NoTeamId, MakeReceiverAt(FVector::ZeroVector)));
+
+	Message.RelevancyRadius = -5.0f;
+	TestFalse(TEXT("Negative radius reaches nobody"), GCFVerbMessageHelpers::IsMessageRelevantToReceiver(Message, GCFVerbMessageHelpers::NoTeamId, MakeReceiverAt(FVector::ZeroVector)));
+
+	// Without an explicit origin and without Target/Instigator actors, there is nothing to measure against.
+	Message.RelevancyRadius = 1000.0f;
+	Message.bHasRelevancyOrigin = false;
+	TestFalse(TEXT("Unset origin without actors does not resolve"), GCFVerbMessageHelpers::ResolveRelevancyOrigin(Message, ResolvedOrigin));
+	TestTrue(TEXT("Unresolvable origin delivers instead of dropping"),
+		GCFVerbMessageHelpers::IsMessageRelevantToReceiver(Message, GCFVerbMessageHelpers::NoTeamId, MakeReceiverAt(FVector(1.0e6, 0.0, 0.0))));
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCFVerbMessageRelevancyOriginTest, "GameCoreFramework.Messages.VerbRelevancy.OriginFromPawn",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGCFVerbMessageRelevancyOriginTest::RunTest(const FString& Parameters)
+{
+	using namespace GCF::Tests;
+
+	FScopedTestWorld World(true);
+
+	const FVector PawnLocation(500.0, -200.0, 100.0);
+	ADefaultPawn* Pawn = World->SpawnActor<ADefaultPawn>(PawnLocation, FRotator::ZeroRotator);
+	AAIController* Controller = World->SpawnActor<AAIController>();
+	APlayerState* PlayerState = World->SpawnActor<APlayerState>();
+	if (!TestNotNull(TEXT("Pawn"), Pawn) || !TestNotNull(TEXT("Controller"), Controller) || !TestNotNull(TEXT("Player state"), PlayerState)) {
+		return false;
+	}
+	Controller->Possess(Pawn);
+	Pawn->SetPlayerState(PlayerState);
+
+	FGCFVerbMessage Message;
+	Message.Relevancy = EGCFVerbMessageRelevancy::WithinRadius;
+	Message.RelevancyRadius = 1000.0f;
+
+	// Elimination messages carry the victim's player state, whose own location is meaningless.
+	FVector ResolvedOrigin;
+	Message.Target = PlayerState;
+	TestTrue(TEXT("Player state target resolves"), GCFVerbMessageHelpers::ResolveRelevancyOrigin(Message, ResolvedOrigin));
+	TestEqual(TEXT("Player state target measures from its pawn"), ResolvedOrigin, PawnLocation);
+
+	Message.Target = Controller;
+	TestTrue(TEXT("Controller target resolves"), GCFVerbMessageHelpers::ResolveRelevancyOrigin(Message, ResolvedOrigin));
+	TestEqual(TEXT("Controller target measures from its pawn"), ResolvedOrigin, PawnLocation);
+
+	// A player state without a pawn falls through to the instigator.
+	APlayerState* PawnlessPlayerState = World->SpawnActor<APlayerState>();
+	Message.Target = PawnlessPlayerState;
+	Message.Instigator = Pawn;
+	TestTrue(TEXT("Pawnless player state falls back to the instigator"), GCFVerbMessageHelpers::ResolveRelevancyOrigin(Message, ResolvedOrigin));
+	TestEqual(TEXT("Instigator location is used"), ResolvedOrigin, PawnLocation);
+
+	Message.Instigator = nullptr;
+	TestFalse(TEXT("Nothing to measure from"), GCFVerbMessageHelpers::ResolveRelevancyOrigin(Message, ResolvedOrigin));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "Actor/Pawn/GCFPawn.h"
+#include "Animation/GCFAvatarSignificanceSubsystem.h"
 #include "GCFAvatarPawn.generated.h"
 
 /**
@@ -31,6 +32,20 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "GCF|Movement")
 	class UGCFCharacterMoverComponent* GetCharacterMoverComponent() const;
 
+	/** GCF significance of this avatar for local viewers, in [0, 1]. Always 0 on a dedicated server. */
+	UFUNCTION(BlueprintPure, Category = "GCF|Pawn")
+	float GetGCFSignificance() const { return Significance; }
+
+	/** Animation update rate tier derived from the significance. */
+	UFUNCTION(BlueprintPure, Category = "GCF|Pawn")
+	EGCFAnimUpdateTier GetAnimUpdateTier() const { return AnimUpdateTier; }
+
+	/**
+	 * Stores the significance and applies the tier to the skeletal mesh and its anim instance.
+	 * Called by UGCFAvatarSignificanceSubsystem.
+	 */
+	void SetGCFSignificance(float NewSignificance, EGCFAnimUpdateTier NewTier);
+
 	//~AActor interface
 	virtual void PreInitializeComponents() override;
 	virtual void BeginPlay() override;
@@ -58,4 +73,13 @@ protected:
 
 	/** True only on the exact frame the jump button was initially pressed. */
 	bool bIsJumpJustPressed = false;
+
+	// --- Significance ---
+	float Significance = 1.0f;
+
+	EGCFAnimUpdateTier AnimUpdateTier = EGCFAnimUpdateTier::Full;
+
+	/** Mesh settings authored on the asset, restored in the Full tier. */
+	float DefaultMeshTickInterval = 0.0f;
+	EVisibilityBasedAnimTickOption DefaultVisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
 };
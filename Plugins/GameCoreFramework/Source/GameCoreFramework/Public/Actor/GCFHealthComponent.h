@@ -127,4 +127,8 @@ protected:
 	// Replicated state used to handle dying.
 	UPROPERTY(ReplicatedUsing = OnRep_DeathState)
 	EDeathState DeathState;
+
+	// If true, the elimination message is also sent to the relevant clients through AGCFGameState::SendMessageToRelevantClients.
+	UPROPERTY(EditDefaultsOnly, Category = "Health")
+	bool bRelayEliminationToClients = false;
 };
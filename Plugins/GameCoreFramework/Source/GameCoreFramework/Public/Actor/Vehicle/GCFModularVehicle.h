@@ -23,6 +23,10 @@ public:
 	UE_API virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	//~ End AActor interface
 
+	//~ Begin APawn interface
+	UE_API virtual void NotifyControllerChanged() override;
+	//~ End APawn interface
+
 };
 
 #undef UE_API
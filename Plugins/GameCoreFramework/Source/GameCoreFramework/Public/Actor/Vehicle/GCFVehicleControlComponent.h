@@ -24,6 +24,10 @@ struct FInputActionValue;
  *
  * Unlike LocomotionDirectionComponent (which handles continuous vectors like steering or throttle),
  * this handles discrete vehicle actions.
+ *
+ * [Drive Input]
+ * Throttle, brake and steering arrive through SetDriveInput and are pushed to the Chaos vehicle movement component
+ * only when a value actually changed. The component never ticks: idle inputs cost nothing on the game thread.
  */
 UCLASS(ClassGroup = (GCF), Within = Pawn, HideCategories = (Tags, Activation, Cooking, AssetUserData, Collision, Networking, Replication), meta = (BlueprintSpawnableComponent, CollapseCategories))
 class UGCFVehicleControlComponent : public UPawnComponent
@@ -33,11 +37,19 @@ class UGCFVehicleControlComponent : public UPawnComponent
 public:
 	UGCFVehicleControlComponent(const FObjectInitializer& ObjectInitializer);
 
+	/** Pushes the drive inputs to the vehicle movement component, skipping values that did not change since the last push. */
+	void SetDriveInput(float Throttle, float Brake, float Steering);
+
+	/** Pushes zero drive inputs and clears the cache. Called on every controller change. */
+	void ResetDriveInput();
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
+	friend struct FGCFVehicleControlComponentTestAccess;
+
 	/** Checks if the Pawn is ready to receive input, then registers bindings. */
 	void HandlePawnReadyStateChanged(const FGCFPawnReadyStateSnapshot& Snapshot);
 
@@ -53,4 +65,9 @@ private:
 	TUniquePtr<FGCFContextBinder> Binder;
 
 	EGCFPawnReadyState CachedPawnReadyState;
+
+	// Drive inputs last pushed to the vehicle movement component.
+	float LastThrottle = 0.0f;
+	float LastBrake = 0.0f;
+	float LastSteering = 0.0f;
 };
\ No newline at end of file
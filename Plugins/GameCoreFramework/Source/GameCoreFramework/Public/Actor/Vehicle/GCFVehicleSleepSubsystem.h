@@ -0,0 +1,100 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/TimerHandle.h"
+#include "GCFVehicleSleepSubsystem.generated.h"
+
+#define UE_API GAMECOREFRAMEWORK_API
+
+class AWheeledVehiclePawn;
+class UPrimitiveComponent;
+struct FHitResult;
+
+/**
+ * @brief Puts parked vehicles that nobody is near to sleep, and wakes them when they matter again.
+ *
+ * [Problem Solved]
+ * Parked AGCFModularVehicle instances (and AGCFWheeledVehiclePawn) kept ticking their control and Chaos vehicle
+ * movement components, simulating suspension and replicating at full rate, even with no driver and no player nearby.
+ *
+ * [Solution]
+ * Disabled by default; enable with "GCF.Vehicle.Sleep.Enable".
+ * - Candidates: On the authority, a vehicle may sleep once it is unpossessed, has stayed below
+ *   "GCF.Vehicle.Sleep.SpeedThreshold" for "GCF.Vehicle.Sleep.Delay" seconds, and is farther than
+ *   "GCF.Vehicle.Sleep.Distance" from every player view point.
+ * - Sleep: The Chaos vehicle simulation and the rigid bodies are put to sleep, the control and vehicle movement
+ *   components stop ticking, and the net update frequency drops to "GCF.Vehicle.Sleep.NetUpdateFrequency".
+ * - Wake: Possession (AGCFModularVehicle::NotifyControllerChanged) and any rigid body hit wake the vehicle immediately.
+ *   A player coming within range wakes it on the next evaluation. Everything is restored to the values it had before.
+ *
+ * [Note]
+ * Chaos steps every vehicle at the scene's substep rate; there is no per-vehicle substep count.
+ * A sleeping vehicle is skipped by the vehicle simulation and the solver instead, which removes its physics cost entirely.
+ */
+UCLASS(MinimalAPI)
+class UGCFVehicleSleepSubsystem final : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns the subsystem owned by the world of the given context, or nullptr if unavailable. */
+	UE_API static UGCFVehicleSleepSubsystem* Get(const UObject* WorldContextObject);
+
+	//~USubsystem interface
+	UE_API virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	UE_API virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	UE_API virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	/** Starts managing the vehicle. Called from AGCFModularVehicle::BeginPlay on the authority. */
+	UE_API void RegisterVehicle(AWheeledVehiclePawn* Vehicle);
+
+	/** Wakes the vehicle and stops managing it. Called from AGCFModularVehicle::EndPlay. */
+	UE_API void UnregisterVehicle(AWheeledVehiclePawn* Vehicle);
+
+	/** Wakes the vehicle immediately if it is sleeping. */
+	UE_API void WakeVehicle(AWheeledVehiclePawn* Vehicle);
+
+	/** Returns true if the vehicle is currently put to sleep by this subsystem. */
+	UFUNCTION(BlueprintPure, Category = "GCF|Vehicle")
+	UE_API bool IsVehicleSleeping(const AWheeledVehiclePawn* Vehicle) const;
+
+	/** Updates stationary timers and puts vehicles to sleep or wakes them. Runs on a timer. */
+	UE_API void EvaluateVehicles();
+
+	/** Logs the number of sleeping and awake vehicles. Backs the "GCF.Vehicle.Sleep.Dump" console command. */
+	UE_API void DumpVehicles() const;
+
+private:
+	struct FManagedVehicle
+	{
+		TWeakObjectPtr<AWheeledVehiclePawn> Vehicle;
+		float StationaryTime = 0.0f;
+		bool bSleeping = false;
+
+		// Values captured when the vehicle went to sleep, restored on wake.
+		float DefaultNetUpdateFrequency = 0.0f;
+		bool bControlTickWasEnabled = false;
+		bool bMovementTickWasEnabled = false;
+		bool bDefaultNotifyRigidBodyCollision = false;
+	};
+
+	FManagedVehicle* FindEntry(const AWheeledVehiclePawn* Vehicle);
+
+	void Sleep(FManagedVehicle& Entry);
+	void Wake(FManagedVehicle& Entry);
+
+	UFUNCTION()
+	void HandleVehicleHit(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit);
+
+private:
+	TArray<FManagedVehicle> ManagedVehicles;
+
+	FTimerHandle EvaluateTimerHandle;
+};
+
+#undef UE_API
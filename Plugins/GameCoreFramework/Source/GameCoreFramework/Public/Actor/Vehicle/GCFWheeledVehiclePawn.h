@@ -6,6 +6,7 @@
 #include "CoreMinimal.h"
 #include "Actor/Vehicle/GCFModularVehicle.h"
 #include "Movement/Locomotion/GCFLocomotionInputHandler.h"
+#include "Engine/TimerHandle.h"
 
 #include "GCFWheeledVehiclePawn.generated.h"
 
@@ -18,12 +19,69 @@ class UGCFVehicleControlComponent;
 class UGCFPawnInputBridgeComponent;
 
 
+/**
+ * @brief Bitflags of cosmetic vehicle state replicated in a single byte.
+ *
+ * Only state that has no gameplay consequence belongs here; it is sent unreliably (see AGCFWheeledVehiclePawn).
+ */
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class EGCFVehicleCosmeticState : uint8
+{
+	None		= 0	UMETA(Hidden),
+	HeadLight	= 1 << 0, // Headlights are on.
+	HandBrake	= 1 << 1, // Handbrake indicator is lit.
+};
+ENUM_CLASS_FLAGS(EGCFVehicleCosmeticState);
+
+
+/**
+ * @brief Cosmetic state changes a client requested and the server has not acknowledged yet.
+ *
+ * Only the bits the client touched are carried, as set and clear masks, so a request never overwrites flags the server
+ * changed on its own (e.g. the handbrake indicator when the driver leaves). Every change bumps the sequence number; the
+ * server applies a request only if its sequence is newer than the last one applied, and reports that sequence back.
+ */
+struct FGCFVehicleCosmeticRequest
+{
+	uint8 SetMask = 0;
+	uint8 ClearMask = 0;
+	uint8 Sequence = 0;
+
+	/** Returns true while a change is waiting for the server's ack. */
+	bool IsPending() const { return (SetMask | ClearMask) != 0; }
+
+	/** Returns the replicated state with the pending changes applied. */
+	uint8 Predict(uint8 ReplicatedState) const { return Apply(ReplicatedState, SetMask, ClearMask); }
+
+	/** Records a change on top of the predicted state. Returns false if the predicted state already has it. */
+	bool Request(EGCFVehicleCosmeticState Flag, bool bEnabled, uint8 ReplicatedState);
+
+	/** Clears the pending changes once the server applied this sequence or a later one. Returns true if it did. */
+	bool Acknowledge(uint8 AppliedSequence);
+
+	/** Server side: applies the masks unless the sequence is not newer than the last applied one. Returns true if applied. */
+	static bool ApplyRequest(uint8& InOutState, uint8& InOutAppliedSequence, uint8 InSetMask, uint8 InClearMask, uint8 InSequence);
+
+	static uint8 Apply(uint8 State, uint8 InSetMask, uint8 InClearMask) { return static_cast<uint8>((State | InSetMask) & ~InClearMask); }
+
+	/** Returns true if sequence A was issued after B, allowing for wrap-around. */
+	static bool IsNewerSequence(uint8 A, uint8 B) { return static_cast<int8>(A - B) > 0; }
+};
+
+
 /**
  * @brief The base wheeled vehicle pawn class used by the GCF framework.
  *
  * Integrates Unreal's Chaos Vehicle system with GCF's modular component architecture.
  * Handles locomotion input routing, state replication (e.g., headlights), and lifecycle
  * management when drivers possess or unpossess the vehicle.
+ *
+ * [Cosmetic State]
+ * Headlights, the handbrake indicator and similar toggles are packed into one replicated byte (CosmeticState).
+ * The driver's client requests changes through an unreliable server RPC carrying set/clear masks of the changed bits and
+ * a sequence number (FGCFVehicleCosmeticRequest), so the server applies only the latest request and never stalls the
+ * reliable buffer. The server replicates the last applied sequence to the owner as the ack; until it arrives, the client
+ * resends the request every "GCF.Vehicle.Cosmetic.ResendInterval" seconds, which makes the state converge under packet loss.
  */
 UCLASS(Config = Game, Meta = (ShortTooltip = "The base pawn class used by this project."))
 class AGCFWheeledVehiclePawn : public AGCFModularVehicle, public IGCFLocomotionInputHandler
@@ -44,6 +102,9 @@ public:
 	/** Requests to toggle the headlight state (handled via Server RPC if Client). */
 	void ToggleHeadLightInput();
 
+	/** Returns true if the replicated cosmetic state has the given flag. */
+	bool HasCosmeticState(EGCFVehicleCosmeticState Flag) const { return EnumHasAnyFlags(static_cast<EGCFVehicleCosmeticState>(CosmeticState), Flag); }
+
 protected:
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
@@ -52,6 +113,7 @@ protected:
 	virtual void UnPossessed() override;
 	virtual void OnRep_Controller() override;
 	virtual void OnRep_PlayerState() override;
+	virtual void NotifyControllerChanged() override;
 	//~End of AActor / APawn Interface
 
 	//~IGCFLocomotionInputHandler Interface
@@ -63,6 +125,10 @@ protected:
 	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category = "GCF|Vehicle")
 	void HandleHeadLightStateChange(bool bNewHeadLight);
 
+	/** Blueprint hook to update the handbrake indicator when its state changes. */
+	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category = "GCF|Vehicle")
+	void HandleHandBrakeIndicatorChange(bool bNewHandBrake);
+
 	// Begins the death sequence for the character (disables collision, disables movement, etc...)
 	UFUNCTION()
 	virtual void OnDeathStarted(AActor* OwningActor);
@@ -75,15 +141,30 @@ private:
 	/** Applies the handbrake to the Chaos Vehicle Movement Component. */
 	void SetHandBrake(bool bNewHandbrake);
 
-	/** Internal method to set headlight state, routing to RPC if necessary. */
-	void SetHeadLightState(bool bNewHeadLight);
+	/** Sets or clears a cosmetic flag. Applied directly on the authority, requested through the server RPC by the driver's client. */
+	void SetCosmeticState(EGCFVehicleCosmeticState Flag, bool bEnabled);
 
-	/** Server RPC to validate and apply headlight state changes requested by a client. */
-	UFUNCTION(Server, Reliable)
-	void Server_SetHeadLightState(bool bNewHeadLight);
+	/** Applies the cosmetic byte on the authority and fires the change hooks. */
+	void ApplyCosmeticState(uint8 NewState);
+
+	/** Sends the pending request (again). Runs on a timer until the server acknowledges it. */
+	void SendCosmeticStateRequest();
+
+	/**
+	 * Server RPC carrying the bits to set and clear. Unreliable: a lost call is covered by the client's resend,
+	 * and an outdated one (older Sequence) is ignored.
+	 */
+	UFUNCTION(Server, Unreliable)
+	void Server_SetCosmeticState(uint8 SetMask, uint8 ClearMask, uint8 Sequence);
+
+	UFUNCTION()
+	void OnRep_CosmeticState(uint8 OldState);
 
 	UFUNCTION()
-	void OnRep_IsHeadLightTurnOn();
+	void OnRep_AppliedCosmeticSequence();
+
+	/** Fires the Blueprint hooks for every flag that differs between the two states. */
+	void NotifyCosmeticStateChanged(uint8 OldState);
 
 protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GCF|Pawn", meta = (AllowPrivateAccess = "true"))
@@ -105,7 +186,17 @@ private:
 	/** Local tracking of the handbrake state. */
 	bool bIsHandbraking = false;
 
-	/** Networked state of the headlights. */
-	UPROPERTY(ReplicatedUsing = OnRep_IsHeadLightTurnOn)
-	bool bIsHeadLightTurnOn;
+	/** Networked cosmetic state, a mask of EGCFVehicleCosmeticState. */
+	UPROPERTY(ReplicatedUsing = OnRep_CosmeticState, meta = (Bitmask, BitmaskEnum = "/Script/GameCoreFramework.EGCFVehicleCosmeticState"))
+	uint8 CosmeticState = 0;
+
+	/** Sequence of the last cosmetic request the server applied, replicated to the driver as the ack. Reset on possession. */
+	UPROPERTY(ReplicatedUsing = OnRep_AppliedCosmeticSequence)
+	uint8 AppliedCosmeticSequence = 0;
+
+	// --- Client request (driver only) ---
+	/** Changes requested by this client and not acknowledged yet. */
+	FGCFVehicleCosmeticRequest CosmeticRequest;
+
+	FTimerHandle CosmeticResendTimerHandle;
 };
@@ -6,11 +6,13 @@
 #include "CoreMinimal.h"
 #include "Animation/AnimInstance.h"
 #include "GameplayEffectTypes.h"
+#include "Animation/GCFAvatarSignificanceSubsystem.h"
 #include "GCFAvatarAnimInstance.generated.h"
 
 class APawn;
 class UMoverComponent;
 class UAbilitySystemComponent;
+class FGCFMoverAnimSnapshotBuffer;
 
 /**
  * @brief Base AnimInstance for Avatar Pawns using the Mover plugin.
@@ -18,6 +20,12 @@ class UAbilitySystemComponent;
  * Replaces the traditional Character-based AnimInstance.
  * Optimized for UE5's Fast Path by separating data gathering (Game Thread)
  * from heavy mathematical calculations (Worker Thread).
+ *
+ * With a GCF Mover component, nothing is gathered on the game thread: the anim instance registers as a reader of
+ * the component's FGCFMoverAnimSnapshotBuffer, the component publishes a snapshot whenever Mover finalizes a frame,
+ * and the worker thread update reads it directly.
+ * In a frame without a current snapshot, and for other Mover components, the data is gathered in
+ * NativeUpdateAnimation instead.
  */
 UCLASS(Config = Game)
 class GAMECOREFRAMEWORK_API UGCFAvatarAnimInstance : public UAnimInstance
@@ -30,13 +38,27 @@ public:
 	// Called once at the beginning. Good for caching component pointers.
 	virtual void NativeInitializeAnimation() override;
 
+	// Releases the snapshot buffer so the Mover component stops publishing for this instance.
+	virtual void NativeUninitializeAnimation() override;
+
 	// Executed on the GAME THREAD. Used ONLY to safely gather data from Actors/Components.
 	virtual void NativeUpdateAnimation(float DeltaSeconds) override;
 
 	// Executed on a WORKER THREAD. Used for math and logic using the cached data.
 	virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
 
+	/** Game thread. Sets the update rate tier chosen by the avatar's significance. */
+	void SetAnimUpdateTier(EGCFAnimUpdateTier NewTier) { AnimUpdateTier = NewTier; }
+
 protected:
+	friend struct FGCFAvatarAnimInstanceTestAccess;
+
+	/** Resolves the Mover component and registers as a reader of its snapshot buffer. */
+	void ResolveMoverComponent();
+
+	/** Unregisters from the snapshot buffer of the resolved Mover component, if any. */
+	void ReleaseSnapshotBuffer();
+
 	/** 
 	 * Checks whether the character currently has acceleration intent.
 	 * Handles both locally controlled (InputCmd) and simulated proxy (SyncState) scenarios cleanly.
@@ -50,6 +72,22 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "GCF|References")
 	TObjectPtr<UMoverComponent> MoverComponent;
 
+	/** Snapshot buffer of a GCF Mover component, or nullptr if the data has to be gathered on the game thread. */
+	FGCFMoverAnimSnapshotBuffer* SnapshotBuffer = nullptr;
+
+	/** Set by NativeUpdateAnimation: true if the snapshot is the current frame's and the worker thread reads it. */
+	bool bReadSnapshot = false;
+
+	/**
+	 * Update rate tier of the owning avatar (see UGCFAvatarSignificanceSubsystem).
+	 * Animation Blueprints can use it to skip optional work (e.g. IK, additive layers) at lower tiers.
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GCF|Significance")
+	EGCFAnimUpdateTier AnimUpdateTier = EGCFAnimUpdateTier::Full;
+
+	/** Copy of AnimUpdateTier taken in NativeUpdateAnimation, for the worker thread update. */
+	EGCFAnimUpdateTier ThreadSafeAnimUpdateTier = EGCFAnimUpdateTier::Full;
+
 	// --- Cached Raw Data (Gathered on Game Thread) ---
 	/** Cached rotation of the pawn to be safely used in the worker thread. */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GCF|Locomotion")
@@ -58,10 +96,18 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GCF|Locomotion")
 	FVector Velocity;
 
+	/** Change of velocity per second. Only provided by GCF Mover components. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GCF|Locomotion")
+	FVector Acceleration;
+
 	/** True if the pawn has any input acceleration (i.e., player is pressing keys) */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GCF|Locomotion")
 	bool bHasAcceleration;
 
+	/** True if the pawn is on walkable ground (Mover.IsOnGround) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GCF|Locomotion")
+	bool bIsOnGround;
+
 	/** True if the pawn is in the air (Falling/Jumping) */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GCF|Locomotion")
 	bool bIsFalling;
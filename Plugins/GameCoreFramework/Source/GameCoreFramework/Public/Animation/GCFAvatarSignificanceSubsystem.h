@@ -0,0 +1,85 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/TimerHandle.h"
+#include "GCFAvatarSignificanceSubsystem.generated.h"
+
+#define UE_API GAMECOREFRAMEWORK_API
+
+class AGCFAvatarPawn;
+
+/** Animation update rate tier of an avatar, derived from its GCF significance. */
+UENUM(BlueprintType)
+enum class EGCFAnimUpdateTier : uint8
+{
+	/** Close to a local view: full rate. */
+	Full,
+	/** Mid distance: reduced update rate. */
+	Reduced,
+	/** Far away: minimal update rate. On clients, no pose update while not rendered. */
+	Minimal,
+	/** Dedicated server: only montages, and the bones they need for root motion, are updated. */
+	ServerOnly,
+};
+
+/**
+ * @brief Computes the GCF significance of every avatar pawn and applies the matching animation update tier.
+ *
+ * [Problem Solved]
+ * Every UGCFAvatarAnimInstance updated at full rate, whether the avatar was next to the camera, far away,
+ * or on a dedicated server where nobody ever sees it.
+ *
+ * [Solution]
+ * - Significance: On a timer, each registered avatar gets a score in [0, 1] from its distance to the nearest local
+ *   view ("GCF.Anim.Significance.NearDistance" scores 1, "...FarDistance" scores 0). Dedicated servers score every
+ *   avatar 0. Other worlds without a local view yet keep every avatar at full rate.
+ * - Tier: The score is mapped to an EGCFAnimUpdateTier with hysteresis and pushed to the avatar, which sets its skeletal
+ *   mesh tick interval and visibility-based tick option and forwards the tier to its anim instance.
+ *   The authority never skips the pose of unrendered avatars, so server-side hit detection keeps current bones.
+ * - Server Only: Dedicated servers only tick montages (and refresh bones while one plays), which is what root motion
+ *   and montage-driven gameplay need.
+ *
+ * [Note]
+ * Disabled by default ("GCF.Anim.Significance.Enable").
+ */
+UCLASS(MinimalAPI)
+class UGCFAvatarSignificanceSubsystem final : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns the subsystem owned by the world of the given context, or nullptr if unavailable. */
+	UE_API static UGCFAvatarSignificanceSubsystem* Get(const UObject* WorldContextObject);
+
+	//~USubsystem interface
+	UE_API virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	UE_API virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	UE_API virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	/** Starts scoring the avatar. Called from AGCFAvatarPawn::BeginPlay. */
+	UE_API void RegisterAvatar(AGCFAvatarPawn* Avatar);
+
+	/** Stops scoring the avatar. Called from AGCFAvatarPawn::EndPlay. */
+	UE_API void UnregisterAvatar(AGCFAvatarPawn* Avatar);
+
+	/** Re-scores every registered avatar. Runs on a timer; callable to force an immediate update. */
+	UE_API void EvaluateSignificance();
+
+	/** Returns the tier for a significance score, keeping the current tier within the hysteresis margin. */
+	static EGCFAnimUpdateTier ComputeTier(float Significance, EGCFAnimUpdateTier CurrentTier);
+
+	/** Returns the skeletal mesh tick interval configured for the tier (0 = every frame). */
+	static float GetTierTickInterval(EGCFAnimUpdateTier Tier);
+
+private:
+	TArray<TWeakObjectPtr<AGCFAvatarPawn>> Avatars;
+
+	FTimerHandle EvaluateTimerHandle;
+};
+
+#undef UE_API
@@ -0,0 +1,112 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+#include "GCFMoverAnimSnapshot.generated.h"
+
+#define UE_API GAMECOREFRAMEWORK_API
+
+class UMoverComponent;
+
+/**
+ * @brief Immutable per-frame view of a Mover pawn's movement state for animation.
+ */
+USTRUCT(BlueprintType)
+struct FGCFMoverAnimSnapshot
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "GCF|Animation")
+	FVector Velocity = FVector::ZeroVector;
+
+	/** Change of velocity since the previous snapshot, per second. */
+	UPROPERTY(BlueprintReadOnly, Category = "GCF|Animation")
+	FVector Acceleration = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GCF|Animation")
+	FRotator Rotation = FRotator::ZeroRotator;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GCF|Animation")
+	FName MovementMode;
+
+	/** True if the pawn intends to move (input for local pawns, replicated move intent for simulated proxies). */
+	UPROPERTY(BlueprintReadOnly, Category = "GCF|Animation")
+	bool bHasAcceleration = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GCF|Animation")
+	bool bIsOnGround = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GCF|Animation")
+	bool bIsFalling = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GCF|Animation")
+	bool bIsCrouched = false;
+};
+
+/**
+ * @brief Single-writer, lock-free double buffer of FGCFMoverAnimSnapshot.
+ *
+ * [Problem Solved]
+ * UGCFAvatarAnimInstance gathered velocity, movement mode, input and Mover tags on the game thread in every
+ * NativeUpdateAnimation, so the game thread part of animation grew with the avatar count.
+ *
+ * [Solution]
+ * The GCF Mover components capture the snapshot when Mover finalizes a simulation frame (FinalizeFrame) and publish
+ * it here. The components do not tick; pawns without a reader pay nothing. The anim instance registers as a reader
+ * when it resolves the buffer and reads it from NativeThreadSafeUpdateAnimation on a worker thread.
+ * The writer fills the back slot and then publishes its index with release semantics; readers acquire the index
+ * and read the front slot, which is not written again until the next publish.
+ *
+ * [Note]
+ * Network Prediction finalizes the frame on the game thread before the animation update of the owning mesh,
+ * so a reader never overlaps two publishes.
+ * Readers only use a snapshot published in the current frame (IsPublishedInFrame). In a frame Mover did not finalize
+ * (e.g. no simulation step was due), the reader gathers the data itself.
+ */
+class FGCFMoverAnimSnapshotBuffer
+{
+public:
+	/** Game thread. Captures the current state of the Mover component and publishes it. */
+	UE_API void Publish(const UMoverComponent& MoverComponent, float DeltaSeconds);
+
+	/** Game thread. Registers a reader. The owning component only publishes while at least one reader is registered. */
+	void AddReader() { ++ReaderCount; }
+
+	/** Game thread. Unregisters a reader added with AddReader. */
+	void RemoveReader() { ReaderCount = FMath::Max(0, ReaderCount - 1); }
+
+	/** Game thread. Returns true if a reader is registered. */
+	bool HasReaders() const { return ReaderCount > 0; }
+
+	/** Any thread. Returns the last published snapshot. Only meaningful if HasSnapshot() is true. */
+	const FGCFMoverAnimSnapshot& Read() const
+	{
+		return Slots[FrontIndex.load(std::memory_order_acquire)];
+	}
+
+	/** Any thread. Returns true once the first snapshot has been published. */
+	bool HasSnapshot() const
+	{
+		return bHasSnapshot.load(std::memory_order_acquire);
+	}
+
+	/** Any thread. Returns true if the last snapshot was published in the given frame (GFrameCounter). */
+	bool IsPublishedInFrame(uint64 Frame) const
+	{
+		return HasSnapshot() && PublishedFrame.load(std::memory_order_acquire) == Frame;
+	}
+
+private:
+	FGCFMoverAnimSnapshot Slots[2];
+	std::atomic<int32> FrontIndex{ 0 };
+	std::atomic<bool> bHasSnapshot{ false };
+	std::atomic<uint64> PublishedFrame{ 0 };
+
+	/** Only touched on the game thread. */
+	int32 ReaderCount = 0;
+};
+
+#undef UE_API
@@ -41,8 +41,8 @@ protected:
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
-	/** Handler for GameplayMessages regarding policy changes. */
-	void OnCameraModeMessageReceived(FGameplayTag Channel, const FGCFPolicyChangedMovementRotationMessage& Message);
+	/** Handler for native messages regarding policy changes. */
+	void OnCameraModeMessageReceived(const FGCFPolicyChangedMovementRotationMessage& Message);
 
 	/** Binds Input Actions (Look, Zoom) via the GCF Input System. */
 	TArray<FGCFBindingReceipt> HandleInputBinding(UGCFInputComponent* InputComponent, TScriptInterface<IGCFInputConfigProvider> Provider);
@@ -79,11 +79,13 @@ UE_API	UE_DECLARE_GAMEPLAY_TAG_EXTERN(UI_Layer_GameMenu);
 UE_API	UE_DECLARE_GAMEPLAY_TAG_EXTERN(UI_Layer_Menu);
 UE_API	UE_DECLARE_GAMEPLAY_TAG_EXTERN(UI_Layer_Modal);
 UE_API	UE_DECLARE_GAMEPLAY_TAG_EXTERN(UI_Action_Escape);
+UE_API	UE_DECLARE_GAMEPLAY_TAG_EXTERN(UI_Slot_Debug);
 
 UE_API	UE_DECLARE_GAMEPLAY_TAG_EXTERN(Message_Elimination);
 UE_API	UE_DECLARE_GAMEPLAY_TAG_EXTERN(Message_Camera_ModeChange);
 UE_API	UE_DECLARE_GAMEPLAY_TAG_EXTERN(Message_PolicyChange_Cursor);
 UE_API	UE_DECLARE_GAMEPLAY_TAG_EXTERN(Message_PolicyChange_MovementRotation);
+UE_API	UE_DECLARE_GAMEPLAY_TAG_EXTERN(Message_Interaction_FocusChange);
 
 UE_API	UE_DECLARE_GAMEPLAY_TAG_EXTERN(Message_Debug_Log);
 UE_API	UE_DECLARE_GAMEPLAY_TAG_EXTERN(Message_Debug_State);
@@ -80,6 +80,9 @@ private:
 	{
 		TArray<TWeakObjectPtr<UCommonActivatableWidget>> LayoutsAdded;
 		TArray<FUIExtensionHandle> ExtensionHandles;
+
+		// True if the HUD was registered as a debug listener because it hosts widgets in a UI.Slot.Debug slot
+		bool bRegisteredDebugListener = false;
 	};
 
 	struct FPerContextData
@@ -100,4 +103,9 @@ private:
 
 	void AddWidgets(AActor* Actor, FPerContextData& ActiveData);
 	void RemoveWidgets(AActor* Actor, FPerContextData& ActiveData);
+
+	// Returns true if any widget entry targets a UI.Slot.Debug slot
+	bool HasDebugWidgets() const;
+
+	static void UnregisterDebugListener(AActor* HUD, FPerActorData& ActorData);
 };
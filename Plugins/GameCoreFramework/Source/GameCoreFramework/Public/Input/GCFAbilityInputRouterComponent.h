@@ -30,6 +30,10 @@ class UGCFAbilitySystemComponent;
  * [Benefit]
  * This decoupling allows the Controller to trigger abilities on the Pawn without
  * tightly coupling the input logic to a specific Pawn class.
+ *
+ * [Performance]
+ * Each target ASC keeps a set of the input tags its activatable abilities listen to.
+ * The set is rebuilt lazily after abilities are granted or removed, so routing an input is a single set lookup.
  */
 UCLASS(MinimalAPI, ClassGroup = (GCF), Within = PlayerController, HideCategories = (Tags, Activation, Cooking, AssetUserData, Collision, Networking, Replication), meta = (BlueprintSpawnableComponent, CollapseCategories))
 class UGCFAbilityInputRouterComponent final : public UControllerComponent
@@ -59,18 +63,36 @@ private:
 	/** Updates the reference to the "Soul" ASC when the player enters the GamePlay state. */
 	void HandlePlayerReadyStateChanged(const FGCFPlayerReadyStateSnapshot& Snapshot);
 
-	/** Checks if the target ASC owns an activatable ability matching the given input tag. */
-	bool HasMatchingAbility(UAbilitySystemComponent* ASC, const FGameplayTag& InputTag) const;
+	/** Routing target with the input tags its abilities can consume. */
+	struct FGCFAbilityInputRoute
+	{
+		TWeakObjectPtr<UGCFAbilitySystemComponent> ASC;
+
+		/** Input tags of the ASC's activatable abilities. Rebuilt on the next routed input after a grant or removal. */
+		TSet<FGameplayTag> RoutableInputTags;
+
+		FDelegateHandle AbilitiesChangedHandle;
+		bool bRoutableTagsDirty = true;
+	};
+
+	/** Switches the route to a new ASC and subscribes to its ability grant/removal notifications. */
+	void SetRouteTarget(FGCFAbilityInputRoute& Route, UGCFAbilitySystemComponent* NewASC);
+
+	/** Collects the input tags of the route's activatable abilities. */
+	static void RebuildRoutableTags(FGCFAbilityInputRoute& Route);
+
+	/** Pushes the input event into the route's ASC if one of its abilities listens to the tag. */
+	void RouteToTarget(FGCFAbilityInputRoute& Route, const FGameplayTag& InputTag, bool bPressed);
 
 	/** Pushes the input event directly into the specified ASC and handles debug logging. */
-	void InjectInputToASC(UGCFAbilitySystemComponent* ASC, const FGameplayTag& InputTag, bool bPressed) const;
+	void InjectInputToASC(UGCFAbilitySystemComponent* ASC, const FGameplayTag& InputTag, bool bPressed, bool bHasMatchingAbility) const;
 
 private:
-	/** Reference to the "Soul" ASC (Persistent, e.g., Global Skills, Meta-game). */
-	TWeakObjectPtr<UGCFAbilitySystemComponent> PlayerStateASC;
+	/** Route to the "Soul" ASC (Persistent, e.g., Global Skills, Meta-game). */
+	FGCFAbilityInputRoute PlayerStateRoute;
 
-	/** Reference to the "Body" ASC (Transient, e.g., Movement, Combat). */
-	TWeakObjectPtr<UGCFAbilitySystemComponent> CurrentPawnASC;
+	/** Route to the "Body" ASC (Transient, e.g., Movement, Combat). */
+	FGCFAbilityInputRoute PawnRoute;
 
 	/** Lifecycle management for event binders. */
 	TArray<TUniquePtr<FGCFContextBinder>> BinderList;
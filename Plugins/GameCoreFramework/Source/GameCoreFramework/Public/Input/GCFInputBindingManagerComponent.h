@@ -8,6 +8,8 @@
 #include "Input/GCFInputTypes.h"
 #include "System/Lifecycle/GCFStateTypes.h"
 #include "System/Binder/GCFContextBinder.h"
+#include "Actor/Data/GCFPawnData.h"
+#include "Engine/TimerHandle.h"
 #include "GCFInputBindingManagerComponent.generated.h"
 
 #define UE_API GAMECOREFRAMEWORK_API
@@ -15,7 +17,7 @@
 class UGCFInputComponent;
 class IGCFInputConfigProvider;
 class FGCFDelegateHandle;
-class UInputMappingContext;
+struct FGCFDebugInputSnapshot;
 
 /**
  * Delegate responsible for executing the actual input binding logic.
@@ -40,6 +42,8 @@ DECLARE_DELEGATE_RetVal_TwoParams(
  * - Context Awareness: Distinguishes between Pawn-dependent bindings (cleared on unpossession)
  * and Controller-persistent bindings (survive pawn swaps).
  * - Safety: Prevents duplicate bindings via idempotency checks and ensures clean removal upon context changes.
+ * - Fast Swaps: Mapping contexts are resolved once per PawnData and diffed against the applied set on possession,
+ * so contexts shared by the old and new Pawn are never removed and re-added.
  */
 UCLASS(MinimalAPI, ClassGroup = (GCF), Within = PlayerController, HideCategories = (Tags, Activation, Cooking, AssetUserData, Collision, Networking, Replication), meta = (BlueprintSpawnableComponent, CollapseCategories))
 class UGCFInputBindingManagerComponent final : public UControllerComponent
@@ -75,6 +79,8 @@ protected:
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
+	friend struct FGCFInputBindingManagerTestAccess;
+
 	/** Unique key to identify a pending binding request. */
 	struct FGCFPendingBindingKey
 	{
@@ -108,8 +114,8 @@ private:
 	void ProcessPendingBindings();
 
 	/** 
-	 * Reads Input Mapping Contexts (IMCs) from the target Pawn's data
-	 * and adds them to the Enhanced Input Local Player Subsystem.
+	 * Reads Input Mapping Contexts (IMCs) from the target Pawn's data and applies them to the Enhanced Input Local Player Subsystem.
+	 * IMCs still applied from the previous Pawn are diffed against the new list; only the differences are removed or added.
 	 */
 	void ApplyPawnMappingContexts(AActor* PawnActor);
 
@@ -118,6 +124,12 @@ private:
 	 */
 	void ClearPawnMappingContexts();
 
+	/**
+	 * Returns the valid IMCs of the Pawn's data. Resolved once per PawnData asset and cached for later possessions.
+	 * Returns an empty list if the Pawn has no PawnData.
+	 */
+	const TArray<FGCFInputMappingContextInfo>& ResolvePawnMappingContexts(AActor* PawnActor);
+
 	/** 
 	 * Determines if a binder object belongs to the Pawn's lifecycle.
 	 * Used to decide whether to clear bindings when possession changes.
@@ -128,7 +140,7 @@ private:
 	 * Executes the delegate and registers the receipts to ActiveBindingGroups.
 	 * Includes checks to prevent duplicate bindings on the same InputComponent.
 	 */
-	virtual void ExecuteInputBinding(const FGCFPendingBindingKey& Key, const FGCFInputBindNativeDelegate& Delegate, UGCFInputComponent* InputComp, TScriptInterface<IGCFInputConfigProvider> Provider);
+	virtual void ExecuteInputBinding(const FGCFPendingBindingKey& Key, const FGCFInputBindNativeDelegate& Delegate, bool bIsPawnDependent, UGCFInputComponent* InputComp, TScriptInterface<IGCFInputConfigProvider> Provider);
 
 	/** 
 	 * Clears bindings associated with the Pawn when possession is lost.
@@ -136,7 +148,8 @@ private:
 	 */
 	void ClearBindingsOnContextChange();
 
-	void SendDebugInfo();
+	/** Fills the debug input snapshot from the active groups. Only called when a debug consumer pulls it. */
+	void BuildDebugInputSnapshot(FGCFDebugInputSnapshot& OutSnapshot) const;
 
 private:
 	bool bInputEnabled = false;
@@ -147,14 +160,30 @@ private:
 	TUniquePtr<FGCFContextBinder> PawnPossessionBinder;
 
 	/** 
-	 * List of currently applied Pawn-dependent IMCs.
+	 * List of currently applied Pawn-dependent IMCs (with the priority they were applied with).
 	 * Tracked here to ensure clean removal upon unpossession.
 	 */
 	UPROPERTY(Transient)
-	TArray<TObjectPtr<const UInputMappingContext>> AppliedPawnIMCs;
+	TArray<FGCFInputMappingContextInfo> AppliedPawnIMCs;
+
+	/** Resolved IMC lists per PawnData asset. Reused when a Pawn with already-seen data is possessed again. */
+	TMap<TObjectKey<UGCFPawnData>, TArray<FGCFInputMappingContextInfo>> ResolvedPawnIMCs;
+
+	/**
+	 * Removal of the old Pawn's IMCs is deferred to the next tick on unpossession.
+	 * If a new Pawn is possessed first (e.g., entering a vehicle), the lists are diffed instead.
+	 */
+	FTimerHandle DeferredIMCClearHandle;
+
+	/** A queued binding request with its lifecycle dependency resolved once at registration. */
+	struct FGCFPendingBinding
+	{
+		FGCFInputBindNativeDelegate Delegate;
+		bool bIsPawnDependent = false;
+	};
 
 	/** Queue of binding requests waiting for conditions to be met. */
-	TMap<FGCFPendingBindingKey, FGCFInputBindNativeDelegate> PendingBindings;
+	TMap<FGCFPendingBindingKey, FGCFPendingBinding> PendingBindings;
 
 	/** Represents a physically active binding group in the Enhanced Input System. */
 	struct FGCFInputBindingGroup
@@ -165,13 +194,18 @@ private:
 
 		/** The specific InputComponent instance where bindings were applied. Used for safety checks. */
 		TWeakObjectPtr<UInputComponent> BoundInputComponent;
+	};
 
 #if !UE_BUILD_SHIPPING
-		TArray<FString> DebugBindingInfos;
+	/** Formats the receipts of a group for debug output. Only called when debug output is actually consumed. */
+	static TArray<FString> GetDebugBindingInfos(const FGCFInputBindingGroup& Group);
 #endif
-	};
-	/** List of currently active bindings. Target for clearing during context changes. */
-	TArray<FGCFInputBindingGroup> ActiveBindingGroups;
+
+	/**
+	 * Currently active bindings, keyed like PendingBindings so the "already active" check is a single lookup.
+	 * Target for clearing during context changes.
+	 */
+	TMap<FGCFPendingBindingKey, FGCFInputBindingGroup> ActiveBindingGroups;
 };
 
 
@@ -35,6 +35,7 @@ public:
  * UGCFInputConfig
  *
  *	Non-mutable data asset that contains input configuration properties.
+ *	Tag lookups go through an index built on load and on edit, so they do not scan the action arrays.
  */
 UCLASS(BlueprintType, Const)
 class UGCFInputConfig : public UDataAsset
@@ -45,6 +46,13 @@ public:
 
 	UGCFInputConfig(const FObjectInitializer& ObjectInitializer);
 
+	//~UObject interface
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+	//~End of UObject interface
+
 	UFUNCTION(BlueprintCallable, Category = "GCF|Pawn")
 	const UInputAction* FindNativeInputActionForTag(const FGameplayTag& InputTag, bool bLogNotFound = true) const;
 
@@ -59,4 +67,24 @@ public:
 	// List of input actions used by the owner.  These input actions are mapped to a gameplay tag and are automatically bound to abilities with matching input tags.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Meta = (TitleProperty = "InputAction"))
 	TArray<FGCFInputAction> AbilityInputActions;
+
+	// Rebuilds the tag-to-action indices from NativeInputActions and AbilityInputActions.
+	// Called on load and on edit; call it after filling the arrays of a config created at runtime.
+	void RebuildInputActionIndex();
+
+private:
+
+	// Returns the first entry with a valid action and a matching tag, like the index does.
+	static const UInputAction* FindInputActionLinear(const TArray<FGCFInputAction>& Actions, const FGameplayTag& InputTag);
+
+private:
+	// The first entry wins when a tag is listed more than once, matching the previous linear search.
+	UPROPERTY(Transient)
+	TMap<FGameplayTag, TObjectPtr<const UInputAction>> NativeInputActionIndex;
+
+	UPROPERTY(Transient)
+	TMap<FGameplayTag, TObjectPtr<const UInputAction>> AbilityInputActionIndex;
+
+	// False for configs created at runtime that never went through PostLoad; lookups fall back to a linear scan.
+	bool bInputActionIndexBuilt = false;
 };
@@ -75,6 +75,9 @@ private:
 	/** @return True if all required conditions (Player Ready & Pawn Ready) are met. */
 	bool IsInputAllowed() const;
 
+	/** Returns the input gate status for the debug registry. Only called when a debug consumer pulls it. */
+	FString GetDebugStateValue() const;
+
 private:
 	/** Broadcasts (CurrentStateBits, bIsInputAllowed). */
 	FOnInputContextEvaluatedNative OnInputContextEvaluatedNative;
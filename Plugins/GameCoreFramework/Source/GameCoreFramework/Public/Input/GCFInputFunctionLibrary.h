@@ -11,6 +11,9 @@ class IGCFInputConfigProvider;
 class AController;
 class FGCFDelegateHandle;
 class UObject;
+class UInputMappingContext;
+class IEnhancedInputSubsystemInterface;
+struct FGCFInputMappingContextInfo;
 
 /**
  * @brief Static function library dedicated to Input System utilities.
@@ -19,6 +22,7 @@ class UObject;
  * - Resolving Input Config Providers (finding who holds the input mapping).
  * - Binding to Input Context changes (Gatekeeper status).
  * - Binding to InputComponent initialization events.
+ * - Applying Input Mapping Contexts in batches.
  */
 UCLASS(Abstract)
 class GAMECOREFRAMEWORK_API UGCFInputFunctionLibrary : public UBlueprintFunctionLibrary
@@ -53,4 +57,14 @@ public:
 	 * @return Scoped handle for auto-unbinding.
 	 */
 	static TUniquePtr<FGCFDelegateHandle> BindInputComponentReadyScoped(AController* Controller, const FOnInputComponentReady::FDelegate& Delegate, bool bExecuteImmediately = true);
+
+	/**
+	 * Removes and adds Input Mapping Contexts as a single transaction.
+	 * Individual modifications only mark the player mappings dirty; the control mappings are rebuilt once at the end.
+	 * * @param Subsystem          The Enhanced Input subsystem to modify (usually the local player's).
+	 * @param ContextsToAdd      IMCs to add with their priorities. Null entries are skipped.
+	 * @param ContextsToRemove   IMCs to remove. Removals are applied before additions.
+	 * @return True if the batch modified anything (and therefore rebuilt the mappings).
+	 */
+	static bool ModifyMappingContexts(IEnhancedInputSubsystemInterface* Subsystem, TConstArrayView<FGCFInputMappingContextInfo> ContextsToAdd, TConstArrayView<const UInputMappingContext*> ContextsToRemove = {});
 };
\ No newline at end of file
@@ -0,0 +1,161 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "Input/GCFInputTypes.h"
+#include "GCFInputReplaySubsystem.generated.h"
+
+#define UE_API GAMECOREFRAMEWORK_API
+
+/** Kind of a recorded input event. Stored as one byte in the recording file. */
+enum class EGCFInputReplayEventType : uint8
+{
+	PawnAbilityPressed,
+	PawnAbilityReleased,
+	PlayerAbilityPressed,
+	PlayerAbilityReleased,
+	Move,
+	MoveUp,
+	Jump,
+	Crouch,
+
+	/** Pawn location at the start of the frame. Not dispatched; compared against the replayed pawn. */
+	PawnLocation,
+};
+
+/** One recorded input event. Only the fields relevant to the event type are serialized. */
+struct FGCFInputReplayEvent
+{
+	uint32 Frame = 0;
+	EGCFInputReplayEventType Type = EGCFInputReplayEventType::Move;
+
+	/** Index into the recording's tag table (ability events). */
+	int32 TagIndex = INDEX_NONE;
+
+	/** Move: XY input value. MoveUp: X value. Jump / Crouch: X pressed (0 / 1). PawnLocation: location. */
+	FVector3f Vector = FVector3f::ZeroVector;
+
+	/** Move: movement rotation basis. */
+	FRotator3f Rotation = FRotator3f::ZeroRotator;
+};
+
+/**
+ * @brief Records the input stream of the local player and replays it deterministically.
+ *
+ * [Problem Solved]
+ * Movement and ability benchmarks need the same input every run, without a real player at the keyboard.
+ *
+ * [Solution]
+ * - Record: The input bridges and locomotion components report every tag-based event they receive from
+ *   UGCFInputComponent, keyed by the frame index since recording started. The pawn location is sampled each frame.
+ * - File: Events are written to "Saved/GCFInput/<Name>.gcfinput" as a compact binary stream
+ *   (tag table + packed frame deltas + per-type payload).
+ * - Replay: Events are fed back at the start of their frame through the same bridge components and
+ *   locomotion handler interface that physical input uses. The sampled pawn locations are compared
+ *   against the replayed pawn and the deviation is reported at the end.
+ *
+ * [Usage]
+ * - Console: "GCF.Input.Record.Start <Name>", "GCF.Input.Record.Stop", "GCF.Input.Replay.Start <Name>", "GCF.Input.Replay.Stop".
+ * - Command line: "-GCFInputRecord=<Name>" / "-GCFInputReplay=<Name>" start at world begin play.
+ *   A command-line replay exits the process when finished, e.g.
+ *   "<Game> <Map> -game -nullrhi -unattended -benchmark -fps=60 -GCFInputReplay=<Name>".
+ *
+ * [Note]
+ * While a replay runs, physical input reaching the bridges and locomotion components is dropped
+ * (see IsReplayActive) so it cannot mix with the recorded stream. Mapping contexts stay applied.
+ * Replays are only frame-exact with a fixed time step (-benchmark -fps=N) for both recording and replay.
+ * Not available in Shipping builds.
+ */
+UCLASS(MinimalAPI)
+class UGCFInputReplaySubsystem final : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns the subsystem of the world if it is currently recording, otherwise nullptr (always nullptr in Shipping). */
+	UE_API static UGCFInputReplaySubsystem* GetActiveRecorder(const UObject* WorldContextObject);
+
+	/** Returns true while the world of WorldContextObject is replaying. Input handlers drop physical input then (always false in Shipping). */
+	UE_API static bool IsReplayActive(const UObject* WorldContextObject);
+
+	//~USubsystem interface
+	UE_API virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	UE_API virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	UE_API virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	/** Starts recording. Any recording or replay in progress is stopped first. */
+	UE_API bool StartRecording(const FString& Name);
+
+	/** Stops recording and writes the file. */
+	UE_API void StopRecording();
+
+	/** Loads the recording and starts feeding it to the local player. */
+	UE_API bool StartReplay(const FString& Name);
+
+	/** Stops the replay and logs the comparison summary. */
+	UE_API void StopReplay();
+
+	bool IsRecording() const { return Mode == EMode::Recording; }
+	bool IsReplaying() const { return Mode == EMode::Replaying; }
+
+	// ----------------------------------------------------------------------------------------------------------------
+	// Recording API (called by input handlers)
+	// ----------------------------------------------------------------------------------------------------------------
+
+	UE_API void RecordAbilityInput(EGCFInputSourceType Source, const FGameplayTag& InputTag, bool bPressed);
+	UE_API void RecordMoveInput(const FVector2D& InputValue, const FRotator& MovementRotation);
+	UE_API void RecordMoveUpInput(float Value);
+	UE_API void RecordJumpInput(bool bPressed);
+	UE_API void RecordCrouchInput(bool bPressed);
+
+private:
+	enum class EMode : uint8
+	{
+		Idle,
+		Recording,
+		Replaying,
+	};
+
+	/** Advances the frame counter and samples / dispatches the events of the new frame before any actor ticks. */
+	void HandlePreActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+
+	void DispatchEvent(const FGCFInputReplayEvent& Event);
+	void CompareLocation(const FGCFInputReplayEvent& Event);
+
+	FGCFInputReplayEvent& AddEvent(EGCFInputReplayEventType Type);
+	int32 GetTagIndex(const FGameplayTag& Tag);
+
+	bool SaveRecording() const;
+	bool LoadRecording(const FString& Name);
+
+	static FString GetRecordingPath(const FString& Name);
+
+private:
+	EMode Mode = EMode::Idle;
+	FString RecordingName;
+
+	/** Frame index since recording / replay started. */
+	uint32 CurrentFrame = 0;
+
+	TArray<FGameplayTag> Tags;
+	TMap<FGameplayTag, int32> TagIndices;
+	TArray<FGCFInputReplayEvent> Events;
+
+	// Replay state
+	int32 ReplayCursor = 0;
+	uint32 ReplayFrameCount = 0;
+	double ReplayStartTime = 0.0;
+	float MaxLocationError = 0.0f;
+	int32 FirstDivergentFrame = INDEX_NONE;
+	int32 DivergentFrameCount = 0;
+	bool bExitWhenReplayFinished = false;
+
+	FDelegateHandle PreActorTickHandle;
+};
+
+#undef UE_API
@@ -44,6 +44,9 @@ public:
 	UE_API virtual TArray<const UGCFInputConfig*> GetInputConfigList() const override { return InputConfigList; };
 	// ~End IGCFInputConfigProvider Interface
 
+	/** Routes a recorded ability input event to the ability router, bypassing the physical handlers. Used by input replay. */
+	UE_API void ReplayAbilityInput(FGameplayTag InputTag, bool bPressed);
+
 protected:
 	virtual void InitializeComponent() override;
 	virtual void BeginPlay() override;
@@ -23,8 +23,8 @@ class IGCFPawnDataProvider;
  * @brief Component that manages interaction detection logic based on the active camera mode.
  *
  * [Responsibilities]
- * 1. Switches detection logic (Mode) dynamically when Camera Mode changes (via GameplayMessage).
- * 2. Finds and focuses on interactable targets every tick.
+ * 1. Switches detection logic (Mode) dynamically when Camera Mode changes (via UGCFNativeMessageSubsystem).
+ * 2. Finds and focuses on interactable targets every tick, and broadcasts FGCFInteractionFocusChangedMessage when focus changes.
  * 3. Sends Gameplay Events to GAS when the interaction input is triggered.
  */
 UCLASS(Blueprintable, Meta = (BlueprintSpawnableComponent))
@@ -45,14 +45,14 @@ protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
-	/** Updates the focus state and calls interface events on old/new targets. */
+	/** Updates the focus state, calls interface events on old/new targets and broadcasts the focus change. */
 	void UpdateFocusedTarget(AActor* NewTarget);
 
 	/** Switches the active interaction mode strategy based on the camera tag. */
 	void UpdateActiveCameraMode(FGameplayTag NewCameraModeTag);
 
 	/** Handler for camera mode change messages. */
-	void OnCameraModeMessageReceived(FGameplayTag Channel, const FGCFCameraModeChangedMessage& Message);
+	void OnCameraModeMessageReceived(const FGCFCameraModeChangedMessage& Message);
 
 protected:
 	/** Data Asset defining which InteractionMode to use for each CameraMode. */
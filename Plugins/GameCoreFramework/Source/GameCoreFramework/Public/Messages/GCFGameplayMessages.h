@@ -9,10 +9,12 @@
 #include "GCFGameplayMessages.generated.h"
 
 
+class AActor;
 class AController;
 
 /**
- * @brief Message struct broadcast via GameplayMessageSubsystem when the active camera mode changes.
+ * @brief Message struct broadcast when the active camera mode changes.
+ * Sent on UGCFNativeMessageSubsystem and on the GameplayMessageSubsystem (Message.Camera.ModeChange).
  */
 USTRUCT(BlueprintType)
 struct FGCFCameraModeChangedMessage
@@ -46,6 +48,29 @@ struct FGCFPolicyChangedCursorMessage
 };
 
 
+/**
+ * @brief Message broadcast when the focused interactable of a local controller changes.
+ * Sent on UGCFNativeMessageSubsystem and on the GameplayMessageSubsystem (Message.Interaction.FocusChange).
+ */
+USTRUCT(BlueprintType)
+struct FGCFInteractionFocusChangedMessage
+{
+	GENERATED_BODY()
+
+	/** The previously focused actor, or nullptr. */
+	UPROPERTY(BlueprintReadOnly, Category = "Interaction")
+	TObjectPtr<AActor> PreviousTarget;
+
+	/** The newly focused actor, or nullptr if focus was lost. */
+	UPROPERTY(BlueprintReadOnly, Category = "Interaction")
+	TObjectPtr<AActor> NewTarget;
+
+	/** The controller whose focus changed. */
+	UPROPERTY(BlueprintReadOnly, Category = "Interaction")
+	TObjectPtr<AController> Controller;
+};
+
+
 /**
  * @brief Message broadcast when the movement rotation policy (e.g., VelocityDirection vs CameraDirection) changes.
  */
@@ -6,6 +6,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/GameplayMessageSubsystem.h"
 #include "GameplayTagContainer.h"
+#include "Messages/GCFNativeMessageSubsystem.h"
 
 class UWorld;
 
@@ -14,6 +15,7 @@ class UWorld;
  *
  * Automatically unregisters the listener when this object goes out of scope.
  * Essential for preventing crashes caused by dangling listeners in the subsystem.
+ * Works with both UGameplayMessageSubsystem and UGCFNativeMessageSubsystem listeners.
  */
 class FGCFMessageSubscription
 {
@@ -22,6 +24,8 @@ public:
 
 	FGCFMessageSubscription(UWorld* World, FGameplayMessageListenerHandle InHandle);
 
+	FGCFMessageSubscription(UWorld* World, FGCFNativeMessageListenerHandle InNativeHandle);
+
 	/** Destructor ensures the listener is unregistered. */
 	~FGCFMessageSubscription() { Unsubscribe(); }
 
@@ -41,4 +45,5 @@ public:
 private:
 	TWeakObjectPtr<UWorld> WeakWorld;
 	FGameplayMessageListenerHandle Handle;
+	FGCFNativeMessageListenerHandle NativeHandle;
 };
\ No newline at end of file
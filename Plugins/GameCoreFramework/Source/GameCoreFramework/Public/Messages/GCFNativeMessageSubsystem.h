@@ -0,0 +1,122 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GCFNativeMessageSubsystem.generated.h"
+
+#define UE_API GAMECOREFRAMEWORK_API
+
+class UScriptStruct;
+
+/**
+ * @brief Handle identifying a listener registered on the UGCFNativeMessageSubsystem.
+ */
+struct FGCFNativeMessageListenerHandle
+{
+	const UScriptStruct* MessageType = nullptr;
+	int32 ID = 0;
+
+	bool IsValid() const { return ID != 0; }
+};
+
+/**
+ * @brief Typed message channel for GCF-internal, high-frequency native traffic.
+ *
+ * [Problem Solved]
+ * UGameplayMessageSubsystem copies the payload into an instanced struct and walks the channel tag hierarchy
+ * on every broadcast. That is fine for gameplay events, but wasteful for native-only traffic such as
+ * camera policy changes that are consumed exclusively by C++ components.
+ *
+ * [Solution]
+ * Listeners register against a concrete USTRUCT type instead of a GameplayTag channel.
+ * Broadcasting is one map lookup followed by direct calls with a const reference to the caller's message,
+ * so nothing is copied or allocated per broadcast.
+ *
+ * [Note]
+ * This channel is native only. Messages that Blueprint needs to observe must still be broadcast
+ * through UGameplayMessageSubsystem.
+ */
+UCLASS(MinimalAPI)
+class UGCFNativeMessageSubsystem final : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns the subsystem owned by the world of the given context, or nullptr if unavailable. */
+	UE_API static UGCFNativeMessageSubsystem* Get(const UObject* WorldContextObject);
+
+	//~USubsystem interface
+	UE_API virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	/** Delivers the message to every listener registered for TMessage. The message is passed by reference and never copied. */
+	template<typename TMessage>
+	void BroadcastMessage(const TMessage& Message)
+	{
+		BroadcastMessageInternal(TMessage::StaticStruct(), &Message);
+	}
+
+	/**
+	 * Registers a member function as a listener for TMessage.
+	 * The object is held weakly; calls are skipped once it has been destroyed.
+	 */
+	template<typename TMessage, typename TOwner>
+	FGCFNativeMessageListenerHandle RegisterListener(TOwner* Object, void (TOwner::*Function)(const TMessage&))
+	{
+		TWeakObjectPtr<TOwner> WeakObject(Object);
+		return RegisterListenerInternal(TMessage::StaticStruct(), [WeakObject, Function](const void* Payload) {
+			if (TOwner* StrongObject = WeakObject.Get()) {
+				(StrongObject->*Function)(*static_cast<const TMessage*>(Payload));
+			}
+		});
+	}
+
+	/** Registers a free callback as a listener for TMessage. The caller is responsible for unregistering it. */
+	template<typename TMessage>
+	FGCFNativeMessageListenerHandle RegisterListener(TFunction<void(const TMessage&)>&& Callback)
+	{
+		return RegisterListenerInternal(TMessage::StaticStruct(), [Callback = MoveTemp(Callback)](const void* Payload) {
+			Callback(*static_cast<const TMessage*>(Payload));
+		});
+	}
+
+	/** Returns true if at least one listener is registered for TMessage. Use to skip building messages nobody reads. */
+	template<typename TMessage>
+	bool HasListeners() const
+	{
+		return HasListenersInternal(TMessage::StaticStruct());
+	}
+
+	/** Removes the listener and invalidates the handle. Safe to call from inside a listener callback. */
+	UE_API void UnregisterListener(FGCFNativeMessageListenerHandle& Handle);
+
+private:
+	struct FListener
+	{
+		int32 ID = 0;
+		TFunction<void(const void*)> Callback;
+	};
+
+	struct FChannel
+	{
+		TArray<FListener> Listeners;
+
+		/** Number of broadcasts currently iterating this channel. Removal is deferred while non-zero. */
+		int32 BroadcastDepth = 0;
+		bool bHasPendingRemovals = false;
+	};
+
+	UE_API void BroadcastMessageInternal(const UScriptStruct* MessageType, const void* Payload);
+	UE_API FGCFNativeMessageListenerHandle RegisterListenerInternal(const UScriptStruct* MessageType, TFunction<void(const void*)>&& Callback);
+	UE_API bool HasListenersInternal(const UScriptStruct* MessageType) const;
+
+	/** Channels are heap-allocated so references stay valid if a new type is registered during a broadcast. */
+	TMap<const UScriptStruct*, TUniquePtr<FChannel>> Channels;
+
+	int32 LastListenerID = 0;
+};
+
+#undef UE_API
@@ -7,6 +7,23 @@
 
 #include "GCFVerbMessage.generated.h"
 
+// Determines which client connections a verb message is routed to by the server
+UENUM(BlueprintType)
+enum class EGCFVerbMessageRelevancy : uint8
+{
+	// Every connected client receives the message
+	All,
+
+	// Only clients on the same team as the Instigator receive the message
+	TeamOnly,
+
+	// Only the clients owning the Instigator or the Target receive the message
+	Participants,
+
+	// Only clients whose view target is within RelevancyRadius of RelevancyOrigin receive the message
+	WithinRadius
+};
+
 // Represents a generic message of the form Instigator Verb Target (in Context, with Magnitude)
 USTRUCT(BlueprintType)
 struct FGCFVerbMessage
@@ -34,6 +51,24 @@ struct FGCFVerbMessage
 	UPROPERTY(BlueprintReadWrite, Category=Gameplay)
 	double Magnitude = 1.0;
 
+	// Routing metadata below is only evaluated on the server and is never sent over the wire
+
+	UPROPERTY(BlueprintReadWrite, NotReplicated, Category=Relevancy)
+	EGCFVerbMessageRelevancy Relevancy = EGCFVerbMessageRelevancy::All;
+
+	// If set, WithinRadius measures from RelevancyOrigin. Otherwise the location of the Target (or Instigator) actor is used
+	UPROPERTY(BlueprintReadWrite, NotReplicated, Category=Relevancy)
+	bool bHasRelevancyOrigin = false;
+
+	// World location used by WithinRadius when bHasRelevancyOrigin is set
+	UPROPERTY(BlueprintReadWrite, NotReplicated, Category=Relevancy, meta=(EditCondition="bHasRelevancyOrigin"))
+	FVector RelevancyOrigin = FVector::ZeroVector;
+
+	// Radius used by WithinRadius. A message with a radius of zero or less is relevant to nobody
+
+	UPROPERTY(BlueprintReadWrite, NotReplicated, Category=Relevancy, meta=(ClampMin=0.0, Units=cm))
+	float RelevancyRadius = 0.0f;
+
 	// Returns a debug string representation of this message
 	GAMECOREFRAMEWORK_API FString ToString() const;
 };
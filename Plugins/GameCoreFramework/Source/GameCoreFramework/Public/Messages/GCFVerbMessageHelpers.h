@@ -32,4 +32,32 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = "GCF")
 	static FGCFVerbMessage CueParametersToVerbMessage(const FGameplayCueParameters& Params);
+
+	// Returns true if the message's relevancy settings allow it to be delivered to the given player (server-side routing)
+	UFUNCTION(BlueprintPure, Category = "GCF")
+	static bool IsMessageRelevantToPlayer(const FGCFVerbMessage& Message, const APlayerController* PlayerController);
 };
+
+namespace GCFVerbMessageHelpers
+{
+	// Team id value meaning "no team" (matches FGenericTeamId::NoTeam)
+	inline constexpr uint8 NoTeamId = 255;
+
+	// Facts about one receiving player, resolved from the world before the relevancy decision
+	struct FRelevancyReceiver
+	{
+		uint8 TeamId = NoTeamId;
+
+		// True if the player owns the message's Instigator or Target
+		bool bIsParticipant = false;
+
+		bool bHasViewLocation = false;
+		FVector ViewLocation = FVector::ZeroVector;
+	};
+
+	// Returns the location WithinRadius measures from: RelevancyOrigin if set, otherwise the Target or Instigator actor
+	GAMECOREFRAMEWORK_API bool ResolveRelevancyOrigin(const FGCFVerbMessage& Message, FVector& OutOrigin);
+
+	// The relevancy decision itself, free of any world lookup
+	GAMECOREFRAMEWORK_API bool IsMessageRelevantToReceiver(const FGCFVerbMessage& Message, uint8 InstigatorTeamId, const FRelevancyReceiver& Receiver);
+}
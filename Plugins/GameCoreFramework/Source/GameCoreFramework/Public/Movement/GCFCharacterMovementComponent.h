@@ -5,6 +5,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "WorldCollision.h"
 #include "Movement/GCFMovementConfigReceiver.h"
 #include "GCFCharacterMovementComponent.generated.h"
 
@@ -40,7 +41,8 @@ struct FGCFCharacterGroundInfo
  *
  * [Features]
  * - Implements IGCFMovementConfigReceiver for data-driven configuration.
- * - Efficient Ground Tracing cache (GetGroundInfo).
+ * - Efficient Ground Tracing cache (GetGroundInfo). While airborne, the trace length follows the fall speed,
+ *   and the trace can run asynchronously with a bounded staleness ("GCF.Character.AsyncGroundTrace").
  * - Ability System integration (Tag-based movement blocking).
  * - Based on Lyra's robust movement implementation.
  */
@@ -63,6 +65,9 @@ public:
 	/**
 	 * Returns the current ground info.
 	 * Updates the trace only if the frame counter has changed since the last call.
+	 * With async ground traces enabled, an airborne character uses the previous frame's trace result,
+	 * corrected by its vertical movement since then, and only traces synchronously if that result is too old.
+	 * Without a ground hit, GroundDistance is the fixed "no ground" sentinel (100000), not the traced length.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "GCF|CharacterMovement")
 	const FGCFCharacterGroundInfo& GetGroundInfo();
@@ -80,9 +85,41 @@ protected:
 	//~End of UMovementComponent interface
 
 private:
+	friend struct FGCFCharacterMovementComponentTestAccess;
+
+	/** Parameters of an airborne ground trace from the current location. */
+	struct FGroundTraceRequest
+	{
+		FVector Start;
+		FVector End;
+		float CapsuleHalfHeight = 0.0f;
+		ECollisionChannel CollisionChannel = ECC_Pawn;
+		FCollisionQueryParams QueryParams;
+		FCollisionResponseParams ResponseParams;
+	};
+
+	/** Builds the ground trace. The length adapts to the fall speed unless bFixedLength is set. */
+	void BuildGroundTrace(FGroundTraceRequest& OutRequest, bool bFixedLength = false) const;
+
+	/** Fills the cached ground info from a trace hit, correcting for vertical movement since the trace started. */
+	void SetGroundInfoFromTrace(const FHitResult& HitResult, const FVector& TraceStart, float CapsuleHalfHeight);
+
+	/** Issues an async ground trace unless one is still in flight. */
+	void RequestAsyncGroundTrace();
+	void HandleAsyncGroundTrace(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+
 	/** Cached ground information. */
 	FGCFCharacterGroundInfo CachedGroundInfo;
 
+	/** Latest completed async ground trace. */
+	FHitResult AsyncGroundHit;
+	FVector AsyncGroundTraceStart = FVector::ZeroVector;
+	uint64 AsyncGroundTraceFrame = 0;
+
+	FTraceHandle PendingGroundTraceHandle;
+	uint64 PendingGroundTraceFrame = 0;
+	FTraceDelegate AsyncGroundTraceDelegate;
+
 	/** True if we are using a forced acceleration for replication. */
 	bool bHasReplicatedAcceleration = false;
 
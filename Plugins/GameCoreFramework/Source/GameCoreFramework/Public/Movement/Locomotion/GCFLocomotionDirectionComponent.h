@@ -43,6 +43,9 @@ protected:
 	FRotator CalcMovementRotation(AController* Controller) const;
 
 private:
+	/** The Mover benchmark drives scripted pawns through Input_Move. */
+	friend class UGCFMoverBenchmarkSubsystem;
+
 	/** Binds Input Actions when the Input Component is ready. */
 	TArray<FGCFBindingReceipt> HandleInputBinding(UGCFInputComponent* InputComponent, TScriptInterface<IGCFInputConfigProvider> Provider);
 
@@ -0,0 +1,144 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Engine/HitResult.h"
+#include "UObject/ObjectKey.h"
+#include "WorldCollision.h"
+#include "GCFCrowdMovementSubsystem.generated.h"
+
+#define UE_API GAMECOREFRAMEWORK_API
+
+class UMoverComponent;
+
+/** Floor found under a crowd pawn by the batched probe of the previous frame. */
+struct FGCFCrowdFloor
+{
+	/** Height kept between the collision and the floor; between Mover's minimum (1.9) and maximum (2.4) floor distance. */
+	static constexpr float FloorDistance = 2.15f;
+
+	/** Location (capsule center) the probe was cast from, i.e. where the pawn was predicted to be. */
+	FVector ProbeLocation = FVector::ZeroVector;
+
+	FHitResult Hit;
+
+	/** Half height of the pawn's collision, measured when the probe was issued. */
+	float HalfHeight = 0.0f;
+
+	/** Height of the capsule center resting on the floor plane at world X = Y = 0, and the plane's slope along X and Y. */
+	double CenterHeight = 0.0;
+	double SlopeX = 0.0;
+	double SlopeY = 0.0;
+
+	/** GFrameCounter of the frame the probe was issued in. */
+	uint64 Frame = 0;
+
+	bool bBlockingHit = false;
+
+	/** Returns the capsule center height that keeps FloorDistance to the floor plane at the given location. */
+	double GetCenterHeight(const FVector& Location) const { return CenterHeight + SlopeX * Location.X + SlopeY * Location.Y; }
+};
+
+/**
+ * @brief Batches the floor queries of pawns using UGCFCrowdWalkingMode.
+ *
+ * [Problem Solved]
+ * Every walking pawn runs its own synchronous floor sweep each simulation tick.
+ * For ambient crowds of hundreds of NPCs on open ground, these queries dominate the movement cost.
+ *
+ * [Solution]
+ * - Structure of Arrays: Crowd pawns register here. Their locations, velocities and collision heights are
+ *   gathered into contiguous arrays once per frame, after actors have ticked.
+ * - Batch Prediction: The location each pawn will have after its next simulation step is extrapolated in one
+ *   branch-free loop over those arrays.
+ * - Async Probes: One async line trace per pawn is issued at the predicted location. The results are collected
+ *   in one pass before actors tick on the next frame, and every floor plane is solved for the capsule center
+ *   height in the same pass.
+ * - Crowd Step: UGCFCrowdWalkingMode integrates the proposed velocity and evaluates the solved plane instead of
+ *   running its own floor sweep, as long as the pawn ends the step within "GCF.Mover.Crowd.MaxProbeOffset"
+ *   of where the probe was cast.
+ *
+ * [Note]
+ * Network Prediction ticks every Mover simulation separately and produces the proposed velocity inside that tick,
+ * so the final integration of each step stays per pawn. Everything that can run ahead of it is batched here.
+ * The crowd mode falls back to the standard walking path whenever the batched floor cannot answer.
+ * Disabled by default ("GCF.Mover.Crowd.Enable"). The equivalence with the standard walking path is covered
+ * by the "GameCoreFramework.Movement.CrowdWalking" automation tests.
+ */
+UCLASS(MinimalAPI)
+class UGCFCrowdMovementSubsystem final : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns the subsystem owned by the world of the given context, or nullptr if unavailable. */
+	UE_API static UGCFCrowdMovementSubsystem* Get(const UObject* WorldContextObject);
+
+	/** Returns true if crowd pawns may use the batched path ("GCF.Mover.Crowd.Enable"). */
+	UE_API static bool IsBatchingEnabled();
+
+	//~USubsystem interface
+	UE_API virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	UE_API virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	UE_API virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	/** Adds a pawn to the batch. Called when UGCFCrowdWalkingMode is registered on its Mover component. */
+	UE_API void RegisterCrowdMover(UMoverComponent* MoverComponent);
+
+	/** Removes a pawn from the batch. */
+	UE_API void UnregisterCrowdMover(UMoverComponent* MoverComponent);
+
+	/** Returns the floor probed for the pawn, or nullptr if the pawn is not registered or no probe has completed yet. */
+	UE_API const FGCFCrowdFloor* FindFloor(const UMoverComponent* MoverComponent) const;
+
+	/** Returns the distance (cm) a crowd step may end away from its probe location and still use the probed floor. */
+	UE_API static float GetMaxProbeOffset();
+
+	/** Counts a crowd step that moved without a floor sweep. */
+	void RecordBatchedStep() { ++BatchedStepCount; }
+
+	/** Counts a crowd step that used the standard walking path. */
+	void RecordFallbackStep() { ++FallbackStepCount; }
+
+	/** Number of crowd steps taken on the batched and on the standard path since the subsystem was created. */
+	uint64 GetBatchedStepCount() const { return BatchedStepCount; }
+	uint64 GetFallbackStepCount() const { return FallbackStepCount; }
+
+private:
+	void HandlePreActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+	void HandlePostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+
+	/** Collects the probes issued on the previous frame and solves their floor planes. */
+	void CollectFloorProbes(UWorld& World);
+
+	/** Gathers the crowd into the arrays, extrapolates the next locations and issues new probes. */
+	void IssueFloorProbes(UWorld& World, float DeltaSeconds);
+
+	void RemoveSlot(int32 Index);
+
+private:
+	/** Slot index per registered component. The arrays below are indexed by slot. */
+	TMap<TObjectKey<UMoverComponent>, int32> SlotIndices;
+
+	TArray<TWeakObjectPtr<UMoverComponent>> Movers;
+	TArray<FVector> Locations;
+	TArray<FVector> Velocities;
+	TArray<float> HalfHeights;
+	TArray<FVector> ProbeLocations;
+	TArray<FTraceHandle> PendingProbes;
+	TArray<FGCFCrowdFloor> PendingFloors;
+	TArray<FGCFCrowdFloor> Floors;
+
+	FDelegateHandle PreActorTickHandle;
+	FDelegateHandle PostActorTickHandle;
+
+	uint64 BatchedStepCount = 0;
+	uint64 FallbackStepCount = 0;
+};
+
+#undef UE_API
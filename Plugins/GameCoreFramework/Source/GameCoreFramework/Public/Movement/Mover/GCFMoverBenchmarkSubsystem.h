@@ -0,0 +1,172 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "HAL/PlatformTime.h"
+#include "GCFMoverBenchmarkSubsystem.generated.h"
+
+#define UE_API GAMECOREFRAMEWORK_API
+
+class AController;
+class APawn;
+class UGCFLocomotionDirectionComponent;
+
+/** Part of the movement stack a benchmark sample was taken in. */
+enum class EGCFMoverBenchmarkPhase : uint8
+{
+	ConvertInput,
+	ProduceInput,
+	GenerateMove,
+	SimulationTick,
+};
+
+#if !UE_BUILD_SHIPPING
+namespace GCF::MoverBenchmark
+{
+/** True while a benchmark is in its measured frames. Scopes check it before reading the clock. */
+extern UE_API bool bSampling;
+
+UE_API void AddSample(const UClass* Category, EGCFMoverBenchmarkPhase Phase, uint64 Cycles);
+}
+
+/**
+ * Adds the time spent in the enclosing scope to the running Mover benchmark, attributed to the class of the given object.
+ * Samples are keyed by class; names are only resolved when the results are written. Nested scopes count towards the outermost one.
+ */
+struct FGCFMoverBenchmarkScope
+{
+	FGCFMoverBenchmarkScope(const UObject* InObject, EGCFMoverBenchmarkPhase InPhase)
+		: Object(InObject)
+		, Phase(InPhase)
+		, bActive(GCF::MoverBenchmark::bSampling && Depth == 0)
+	{
+		if (bActive) {
+			++Depth;
+			StartCycles = FPlatformTime::Cycles64();
+		}
+	}
+
+	~FGCFMoverBenchmarkScope()
+	{
+		if (bActive) {
+			GCF::MoverBenchmark::AddSample(Object->GetClass(), Phase, FPlatformTime::Cycles64() - StartCycles);
+			--Depth;
+		}
+	}
+
+private:
+	/** Movement runs on the game thread only. */
+	static inline int32 Depth = 0;
+
+	const UObject* Object;
+	EGCFMoverBenchmarkPhase Phase;
+	bool bActive;
+	uint64 StartCycles = 0;
+};
+
+#define GCF_MOVER_BENCHMARK_SCOPE(Object, Phase) FGCFMoverBenchmarkScope ANONYMOUS_VARIABLE(GCFMoverBenchmarkScope)(Object, EGCFMoverBenchmarkPhase::Phase)
+#else
+#define GCF_MOVER_BENCHMARK_SCOPE(Object, Phase)
+#endif
+
+/**
+ * @brief Repeatable, headless benchmark of the GCF Mover stack (input producers, GCF movement modes).
+ *
+ * [Problem Solved]
+ * There was no way to measure the cost of the movement stack for a given pawn count, or to compare it
+ * between builds.
+ *
+ * [Solution]
+ * - Spawns a grid of pawns (AGCFHumanoid, AGCFAvatarPawn or any pawn class), each possessed by an AI controller.
+ * - Drives them with a deterministic script through a UGCFLocomotionDirectionComponent on each controller,
+ *   the same path player move input takes.
+ * - After a warm-up, samples the game thread time of every frame and the time spent per phase
+ *   (ConvertInput / ProduceInput / GenerateMove / SimulationTick) and per component, producer or mode class,
+ *   for a fixed number of frames.
+ * - Writes the results to Saved/GCFBenchmark/<Name>.csv and destroys the spawned pawns.
+ *
+ * Start it with "GCF.Mover.Benchmark [Options]", or headless with
+ * -nullrhi -GCFMoverBenchmark="Class=Humanoid Count=500 Frames=600 Script=Mixed Csv=Humanoid500",
+ * which exits when the benchmark has finished. Any map with a floor around the first player start (or the origin) works.
+ *
+ * [Note]
+ * Samples are only taken where GCF code runs: the direction component, the producers, and GenerateMove and the
+ * simulation step of the GCF modes. The walking, falling and flying modes override SimulationTick only to wrap the
+ * engine step in a benchmark scope, which compiles out in Shipping. The "GameCoreFramework.Movement.MoverBenchmark" automation test runs a short benchmark.
+ * Not available in Shipping builds.
+ */
+UCLASS(MinimalAPI)
+class UGCFMoverBenchmarkSubsystem final : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns the subsystem owned by the world of the given context, or nullptr (always nullptr in Shipping). */
+	UE_API static UGCFMoverBenchmarkSubsystem* Get(const UObject* WorldContextObject);
+
+	//~USubsystem interface
+	UE_API virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	UE_API virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	UE_API virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	/**
+	 * Spawns the pawns and starts the benchmark.
+	 * @param Options  Space-separated Key=Value pairs: Class (Humanoid, Avatar or a class path), Count, Frames, Warmup,
+	 *                 Spacing (cm), Script (Idle, Walk, Mixed), Csv (file name without extension).
+	 */
+	UE_API bool StartBenchmark(const FString& Options);
+
+	/** Stops a running benchmark without writing results and destroys the spawned pawns. */
+	UE_API void CancelBenchmark();
+
+	/** Returns true from StartBenchmark until the results are written or the benchmark is cancelled. */
+	UE_API bool IsRunning() const;
+
+	/** Returns the path of the CSV file the last finished benchmark wrote, or an empty string. */
+	const FString& GetLastCsvPath() const { return LastCsvPath; }
+
+#if !UE_BUILD_SHIPPING
+private:
+	enum class EScript : uint8
+	{
+		Idle,
+		Walk,
+		Mixed,
+	};
+
+	void HandlePreActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+	void SpawnPawns();
+	void DriveScript();
+	void FinishBenchmark();
+	void DestroyPawns();
+	bool WriteCsv(const FString& Path) const;
+
+private:
+	TSubclassOf<APawn> PawnClass;
+	int32 PawnCount = 0;
+	int32 MeasuredFrames = 0;
+	int32 WarmupFrames = 0;
+	float Spacing = 0.0f;
+	EScript Script = EScript::Walk;
+	FString CsvName;
+
+	TArray<TWeakObjectPtr<APawn>> Pawns;
+	TArray<TWeakObjectPtr<AController>> Controllers;
+	TArray<TWeakObjectPtr<UGCFLocomotionDirectionComponent>> DirectionComponents;
+
+	FDelegateHandle PreActorTickHandle;
+	int32 Frame = 0;
+	double GameThreadMilliseconds = 0.0;
+	int32 SampledFrames = 0;
+	bool bExitWhenFinished = false;
+#endif
+
+	FString LastCsvPath;
+};
+
+#undef UE_API
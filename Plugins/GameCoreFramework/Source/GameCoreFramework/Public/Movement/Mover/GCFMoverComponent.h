@@ -6,11 +6,13 @@
 #include "CoreMinimal.h"
 #include "MoverComponent.h"
 #include "Movement/GCFMovementConfigReceiver.h"
+#include "Animation/GCFMoverAnimSnapshot.h"
 #include "GCFMoverComponent.generated.h"
 
 #define UE_API GAMECOREFRAMEWORK_API
 
 class UGCFMovementConfig;
+class UCommonLegacyMovementSettings;
 
 /**
  * @brief Wrapper component that integrates the Mover plugin with the GCF Data-Driven architecture.
@@ -18,6 +20,9 @@ class UGCFMovementConfig;
  * This component acts as a bridge between the data layer (UGCFMovementConfig) and the
  * physics-based Mover system, automatically injecting parameter changes (MaxSpeed, etc.)
  * into Mover's shared settings.
+ *
+ * Pawns with identical configs share one legacy settings instance (see UGCFMoverSettingsSubsystem).
+ * On the server, pawns that no player controls lower their net update frequency with their distance to players (see UGCFMoverLODSubsystem).
  */
 UCLASS(Blueprintable, ClassGroup = (GCF), meta = (BlueprintSpawnableComponent))
 class UGCFMoverComponent : public UMoverComponent, public IGCFMovementConfigReceiver
@@ -25,11 +30,38 @@ class UGCFMoverComponent : public UMoverComponent, public IGCFMovementConfigRece
     GENERATED_BODY()
 
 public:
+	UE_API UGCFMoverComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	//~UActorComponent interface
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	//~End of UActorComponent interface
+
+	//~UMoverComponent interface
+	virtual void FinalizeFrame(const FMoverSyncState* SyncState, const FMoverAuxStateContext* AuxState) override;
+	//~End of UMoverComponent interface
+
 	/**
 	 * Called to apply data-driven movement parameters to this component.
 	 * Overrides the interface method to update Mover's internal shared settings.
 	 */
     virtual void ApplyMovementConfig_Implementation(const UGCFMovementConfig* Config) override;
+
+	/**
+	 * Returns legacy movement settings that are safe to modify at runtime.
+	 * If the current instance is shared with other pawns, it is replaced by a private copy first.
+	 */
+	UE_API UCommonLegacyMovementSettings* GetMutableLegacyMovementSettings();
+
+	/**
+	 * Movement state for animation, published whenever Mover finalizes a frame while a reader is registered.
+	 * Safe to read from animation worker threads.
+	 */
+	FGCFMoverAnimSnapshotBuffer& GetAnimSnapshotBuffer() { return AnimSnapshotBuffer; }
+	const FGCFMoverAnimSnapshotBuffer& GetAnimSnapshotBuffer() const { return AnimSnapshotBuffer; }
+
+private:
+	FGCFMoverAnimSnapshotBuffer AnimSnapshotBuffer;
 };
 
 #undef UE_API
\ No newline at end of file
@@ -0,0 +1,113 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/TimerHandle.h"
+#include "GCFMoverLODSubsystem.generated.h"
+
+#define UE_API GAMECOREFRAMEWORK_API
+
+class UMoverComponent;
+
+/** Net update frequency tier of a server-side Mover pawn that no player controls. Higher tiers are farther from every player view. */
+UENUM(BlueprintType)
+enum class EGCFMoverLODTier : uint8
+{
+	High,
+	Medium,
+	Low,
+	Minimal,
+};
+
+/**
+ * @brief Distance-based net update frequency policy for server-side Mover pawns that are not driven by a player.
+ *
+ * [Problem Solved]
+ * Every GCF Mover pawn replicated at full rate, no matter how far it was from any player's view,
+ * so the replication cost of large NPC populations grew with their count instead of with what players can see.
+ *
+ * [Solution]
+ * - Significance: On a timer, each registered pawn is ranked by its distance to the nearest player view point,
+ *   with a hysteresis margin around each threshold.
+ * - Server NPCs: The tier lowers the owning actor's net update frequency, so simulated proxies receive fewer
+ *   movement updates. Network Prediction interpolates the proxy between the (now less frequent) server states
+ *   (SimulatedProxyNetworkLOD=Interpolated in DefaultNetworkPrediction.ini).
+ * - Tiers are configured with the "GCF.Mover.LOD.*" console variables and can be forced for profiling.
+ *   Disabled by default ("GCF.Mover.LOD.Enable").
+ *
+ * [Note]
+ * Only the net update frequency changes. Network Prediction steps every simulation of a ticking policy at one rate,
+ * so the movement simulation of a downgraded pawn costs the same on the server; the saving is bandwidth and
+ * client-side state processing.
+ * Locally controlled and player-controlled pawns are never downgraded. A net update frequency that gameplay changes
+ * while a pawn is downgraded becomes the value restored at High. Keep the lowest net update frequency above
+ * 1000 / IndependentTickInterpolationMaxBufferedMS so proxies never run out of buffered states.
+ */
+UCLASS(MinimalAPI)
+class UGCFMoverLODSubsystem final : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns the subsystem owned by the world of the given context, or nullptr if unavailable. */
+	UE_API static UGCFMoverLODSubsystem* Get(const UObject* WorldContextObject);
+
+	//~USubsystem interface
+	UE_API virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	UE_API virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	UE_API virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	/** Starts managing the net update frequency of a Mover component. Called from the GCF Mover components' BeginPlay. */
+	UE_API void RegisterMoverComponent(UMoverComponent* MoverComponent);
+
+	/** Restores the original net update frequency and stops managing the component. Called from the GCF Mover components' EndPlay. */
+	UE_API void UnregisterMoverComponent(UMoverComponent* MoverComponent);
+
+	/** Returns the current tier of a registered component, or High if it is not managed. */
+	UFUNCTION(BlueprintPure, Category = "GCF|Movement")
+	UE_API EGCFMoverLODTier GetMoverLODTier(const UMoverComponent* MoverComponent) const;
+
+	/** Re-ranks every registered pawn and applies tier changes. Runs on a timer; callable to force an immediate update. */
+	UE_API void EvaluateTiers();
+
+	/** Logs the number of pawns per tier. Backs the "GCF.Mover.LOD.Dump" console command. */
+	UE_API void DumpTiers() const;
+
+private:
+	struct FManagedMover
+	{
+		TWeakObjectPtr<UMoverComponent> Component;
+
+		/** Value to restore at High. Captured when the pawn leaves High. */
+		float DefaultNetUpdateFrequency = 0.0f;
+
+		/** Value this subsystem wrote. A different current value means gameplay changed it since. */
+		float AppliedNetUpdateFrequency = 0.0f;
+
+		EGCFMoverLODTier Tier = EGCFMoverLODTier::High;
+	};
+
+	/** Per-tier values parsed from the console variables once per evaluation. */
+	struct FTierSettings
+	{
+		TArray<float> Distances;
+		TArray<float> NetUpdateFrequencies;
+	};
+
+	/** Returns true if the pawn may be downgraded, i.e. it is a server-side pawn that no player controls. */
+	static bool IsLODCandidate(const UMoverComponent& MoverComponent);
+
+	static void ApplyTier(FManagedMover& Entry, EGCFMoverLODTier NewTier, const FTierSettings& Settings);
+	static void RestoreDefaults(FManagedMover& Entry);
+
+private:
+	TArray<FManagedMover> ManagedMovers;
+
+	FTimerHandle EvaluateTimerHandle;
+};
+
+#undef UE_API
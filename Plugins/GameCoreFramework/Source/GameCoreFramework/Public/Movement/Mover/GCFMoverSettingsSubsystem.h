@@ -0,0 +1,111 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "GCFMoverSettingsSubsystem.generated.h"
+
+#define UE_API GAMECOREFRAMEWORK_API
+
+class UCommonLegacyMovementSettings;
+class UGCFMovementConfig;
+class UMoverComponent;
+
+/**
+ * @brief Deduplicates Mover legacy movement settings between pawns with identical movement configs.
+ *
+ * [Problem Solved]
+ * Every Mover component owns a private UCommonLegacyMovementSettings instance, and ApplyMovementConfig
+ * wrote MaxSpeed / Acceleration / Deceleration into it. Large crowds sharing one config each carried a copy.
+ *
+ * [Solution]
+ * - Shared: Applying a config points the component's settings entry at one immutable instance per
+ *   (settings class, config values, every other property of the component's current settings).
+ *   The instance is duplicated from the component's settings, so values the config does not cover are kept.
+ *   Instances are bucketed by class and config values, and only the few candidates in a bucket are compared
+ *   property by property. Re-applying the same values to a shared instance is a pointer check.
+ * - Rebind: Movement modes cache the settings instance when they register. Whenever the entry is replaced,
+ *   the component's registered modes are re-registered so they read the new instance.
+ * - Copy-on-write: Code that changes a value at runtime asks the component for its mutable settings
+ *   (GetMutableLegacyMovementSettings), which swaps in a private copy first. Later config applies write into
+ *   that copy, so runtime overrides of other values are kept.
+ *
+ * [Note]
+ * Never modify the instance returned by FindSharedSettings_Mutable<UCommonLegacyMovementSettings>() on a GCF Mover
+ * component directly; it may be shared with other pawns.
+ */
+UCLASS(MinimalAPI)
+class UGCFMoverSettingsSubsystem final : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns the subsystem owned by the world of the given context, or nullptr if unavailable. */
+	UE_API static UGCFMoverSettingsSubsystem* Get(const UObject* WorldContextObject);
+
+	//~USubsystem interface
+	UE_API virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	/**
+	 * Applies the config to the legacy settings entry of a Mover component's shared settings list.
+	 * @param MoverComponent   Owner of the settings list. Its registered modes are rebound if the entry is replaced.
+	 * @param InOutSettings    The component's shared settings list. The legacy settings entry may be replaced.
+	 * @return false if the list holds no legacy movement settings.
+	 */
+	UE_API bool ApplyMovementConfig(UMoverComponent* MoverComponent, TArray<TObjectPtr<UObject>>& InOutSettings, const UGCFMovementConfig* Config);
+
+	/** Replaces a shared legacy settings entry with a private copy owned by the component, and returns the private instance. */
+	UE_API UCommonLegacyMovementSettings* MakeSettingsPrivate(UMoverComponent* MoverComponent, TArray<TObjectPtr<UObject>>& InOutSettings);
+
+	/** Logs the shared instances. Backs the "GCF.Mover.DumpSharedSettings" console command. */
+	UE_API void DumpSharedSettings() const;
+
+private:
+	/** Bucket of shared instances. Instances in one bucket differ only in values the config does not write. */
+	struct FSettingsKey
+	{
+		const UClass* SettingsClass = nullptr;
+		float MaxSpeed = 0.0f;
+		float Acceleration = 0.0f;
+		float Deceleration = 0.0f;
+
+		bool operator==(const FSettingsKey& Other) const
+		{
+			return SettingsClass == Other.SettingsClass && MaxSpeed == Other.MaxSpeed && Acceleration == Other.Acceleration && Deceleration == Other.Deceleration;
+		}
+
+		friend uint32 GetTypeHash(const FSettingsKey& Key)
+		{
+			return HashCombine(HashCombine(GetTypeHash(Key.SettingsClass), GetTypeHash(Key.MaxSpeed)),
+							   HashCombine(GetTypeHash(Key.Acceleration), GetTypeHash(Key.Deceleration)));
+		}
+	};
+
+	static int32 FindLegacySettingsIndex(const TArray<TObjectPtr<UObject>>& Settings);
+
+	/** Returns true if both instances hold the same value for every property the config does not write. */
+	static bool HasSameUnconfiguredValues(const UCommonLegacyMovementSettings* A, const UCommonLegacyMovementSettings* B);
+
+	/** Returns the shared instance for the source settings with the config applied, duplicating the source if none exists yet. */
+	UCommonLegacyMovementSettings* FindOrCreateSharedSettings(UCommonLegacyMovementSettings* SourceSettings, const UGCFMovementConfig* Config);
+
+	/** Replaces the legacy settings entry and re-registers the component's modes, which cache the instance on registration. */
+	static void ReplaceSettings(UMoverComponent* MoverComponent, TArray<TObjectPtr<UObject>>& InOutSettings, int32 Index, UCommonLegacyMovementSettings* NewSettings);
+
+	/** Shared immutable instances, outered to this subsystem. */
+	TMap<FSettingsKey, TArray<UCommonLegacyMovementSettings*>> SharedSettings;
+	int32 SharedSettingsCount = 0;
+
+	/** Private copies created by MakeSettingsPrivate, i.e. settings overridden at runtime. */
+	TSet<TObjectKey<UCommonLegacyMovementSettings>> PrivateSettings;
+
+	/** Keeps the shared instances alive. TMap values with a custom key are not reflected. */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UCommonLegacyMovementSettings>> SharedSettingsReferences;
+};
+
+#undef UE_API
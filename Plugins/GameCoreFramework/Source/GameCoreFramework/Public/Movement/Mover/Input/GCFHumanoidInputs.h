@@ -4,6 +4,7 @@
 #pragma once
 
 #include "MoverTypes.h"
+#include "MoverDataModelTypes.h"
 #include "GCFHumanoidInputs.generated.h"
 
 /**
@@ -11,9 +12,17 @@
  * 
  * This struct encapsulates additional input intents (like crouching, sprinting) that go beyond
  * the standard directional movement, tailored specifically for bipedal characters.
+ *
+ * [Bandwidth]
+ * The struct extends FCharacterDefaultInputs and replaces it in the input command of humanoid pawns,
+ * so Mover's modes still find it as the default inputs while the wire format is owned by the plugin:
+ * - The directional intent and the orientation intent are unit-range vectors and are sent as 16-bit fixed components.
+ *   A zero move intent costs a single bit.
+ * - The control rotation is sent as compressed shorts.
+ * - Jump, crouch and the optional fields (movement mode, movement base) are packed into single bits.
  */
 USTRUCT(BlueprintType)
-struct GAMECOREFRAMEWORK_API FGCFHumanoidInputs : public FMoverDataStructBase
+struct GAMECOREFRAMEWORK_API FGCFHumanoidInputs : public FCharacterDefaultInputs
 {
 	GENERATED_USTRUCT_BODY()
 
@@ -28,11 +37,13 @@ struct GAMECOREFRAMEWORK_API FGCFHumanoidInputs : public FMoverDataStructBase
 	virtual bool ShouldReconcile(const FMoverDataStructBase& AuthorityState) const override
 	{
 		const FGCFHumanoidInputs& TypedAuthority = static_cast<const FGCFHumanoidInputs&>(AuthorityState);
-		return (TypedAuthority.bWantsToCrouch != bWantsToCrouch);
+		return Super::ShouldReconcile(AuthorityState) || (TypedAuthority.bWantsToCrouch != bWantsToCrouch);
 	}
 
 	virtual void Interpolate(const FMoverDataStructBase& From, const FMoverDataStructBase& To, float LerpFactor) override
 	{
+		Super::Interpolate(From, To, LerpFactor);
+
 		// Since boolean values cannot be interpolated (Lerped), we adopt the value from the 
 		// source state if LerpFactor is less than 0.5; otherwise, we use the target state.
 		const FGCFHumanoidInputs& SourceInputs = static_cast<const FGCFHumanoidInputs&>((LerpFactor < 0.5f) ? From : To);
@@ -41,6 +52,8 @@ struct GAMECOREFRAMEWORK_API FGCFHumanoidInputs : public FMoverDataStructBase
 
 	virtual void Merge(const FMoverDataStructBase& From) override
 	{
+		Super::Merge(From);
+
 		const FGCFHumanoidInputs& TypedFrom = static_cast<const FGCFHumanoidInputs&>(From);
 		bWantsToCrouch |= TypedFrom.bWantsToCrouch;
 	}
@@ -50,16 +63,8 @@ struct GAMECOREFRAMEWORK_API FGCFHumanoidInputs : public FMoverDataStructBase
 		return new FGCFHumanoidInputs(*this);
 	}
 
-	virtual bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override
-	{
-		Super::NetSerialize(Ar, Map, bOutSuccess);
-
-		// Optimize network bandwidth by serializing boolean flags down to a single bit.
-		Ar.SerializeBits(&bWantsToCrouch, 1);
-
-		bOutSuccess = true;
-		return true;
-	}
+	/** Quantized replacement for FCharacterDefaultInputs::NetSerialize. See [Bandwidth] above. */
+	virtual bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override;
 
 	virtual UScriptStruct* GetScriptStruct() const override { return StaticStruct(); }
 
@@ -70,4 +75,4 @@ struct GAMECOREFRAMEWORK_API FGCFHumanoidInputs : public FMoverDataStructBase
 	}
 
 	virtual void AddReferencedObjects(FReferenceCollector& Collector) override { Super::AddReferencedObjects(Collector); }
-};
\ No newline at end of file
+};
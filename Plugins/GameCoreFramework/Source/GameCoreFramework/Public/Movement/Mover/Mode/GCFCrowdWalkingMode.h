@@ -0,0 +1,54 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Movement/Mover/Mode/GCFWalkingMode.h"
+#include "GCFCrowdWalkingMode.generated.h"
+
+#define UE_API GAMECOREFRAMEWORK_API
+
+class UGCFCrowdMovementSubsystem;
+struct FGCFCrowdFloor;
+
+/**
+ * @brief Walking mode for ambient crowd NPCs that moves on batched floor probes.
+ *
+ * The proposed move is generated exactly like UGCFWalkingMode. The simulation step then places the pawn on the
+ * floor probed for it by UGCFCrowdMovementSubsystem, instead of running its own floor sweep.
+ *
+ * Any case the probe cannot answer (no or unwalkable floor, a probe older than the previous frame, a step ending
+ * farther than "GCF.Mover.Crowd.MaxProbeOffset" from the probe, a step higher than MaxStepHeight, a moving base,
+ * a blocked move, player-controlled or non-authoritative pawns) runs the standard walking step for that tick.
+ */
+UCLASS(MinimalAPI, Blueprintable, BlueprintType)
+class UGCFCrowdWalkingMode : public UGCFWalkingMode
+{
+	GENERATED_BODY()
+
+public:
+	//~UBaseMovementMode interface
+	UE_API virtual void OnRegistered(const FName ModeName) override;
+	UE_API virtual void OnUnregistered() override;
+	UE_API virtual void SimulationTick_Implementation(const FSimulationTickParams& Params, FMoverTickEndData& OutputState) override;
+	//~End of UBaseMovementMode interface
+
+private:
+	struct FCrowdMoveResult
+	{
+		FVector Location = FVector::ZeroVector;
+		FRotator Orientation = FRotator::ZeroRotator;
+		FVector Velocity = FVector::ZeroVector;
+		FVector AngularVelocityDegrees = FVector::ZeroVector;
+		const FGCFCrowdFloor* Floor = nullptr;
+	};
+
+	/** Computes the step from the batched floor. Returns false if the standard path has to run instead. Has no side effects. */
+	bool ComputeCrowdMove(const UGCFCrowdMovementSubsystem& CrowdSubsystem, const FSimulationTickParams& Params, FCrowdMoveResult& OutResult) const;
+
+	/** Moves the updated component and writes the output state. Returns false (and undoes the move) if the move was blocked. */
+	bool ApplyCrowdMove(const FSimulationTickParams& Params, const FCrowdMoveResult& Result, FMoverTickEndData& OutputState) const;
+};
+
+#undef UE_API
@@ -31,6 +31,12 @@ public:
 	  * Overridden here to sanitize input buffers for simulated proxies before physics execution.
 	  */
     virtual void GenerateMove_Implementation(const FMoverTickStartData& StartState, const FMoverTimeStep& TimeStep, FProposedMove& OutProposedMove) const override;
+
+	/** Overridden to attribute the step to this mode in the GCF Mover benchmark. */
+	virtual void SimulationTick_Implementation(const FSimulationTickParams& Params, FMoverTickEndData& OutputState) override;
+
+private:
+	friend struct FGCFMoverSettingsTestAccess;
 };
 
 #undef UE_API
\ No newline at end of file
@@ -6,8 +6,11 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "MoverSimulationTypes.h"
+#include "System/Binder/GCFContextBinder.h"
 #include "GCFLocomotionInputProducer.generated.h"
 
+class IGCFLocomotionInputProvider;
+
 /**
  * @brief Mover input producer that bridges the GCF Input System with the Mover plugin.
  *
@@ -16,6 +19,13 @@
  * project to maintain a data-driven input flow (InputAction -> InputTag -> Pawn Cache)
  * while fully supporting Mover's tick-based prediction and rollback systems.
  * * By utilizing the interface, it completely decouples from concrete Pawn classes.
+ *
+ * [Performance]
+ * The owner pawn, its local control state and the provider are resolved when the pawn is possessed,
+ * unpossessed or gets its controller assigned (FGCFPawnPossessionBinder / FGCFPawnControllerAssignedBinder),
+ * so a produced input frame performs no cast, component or interface lookup.
+ * If the owner implements the interface in C++ and no Blueprint overrides any of its functions,
+ * the _Implementation functions are called directly. Blueprint implementers fall back to the reflected Execute_ calls.
  */
 UCLASS(Blueprintable, ClassGroup = (GCF), meta = (BlueprintSpawnableComponent))
 class GAMECOREFRAMEWORK_API UGCFLocomotionInputProducer : public UActorComponent, public IMoverInputProducerInterface
@@ -28,4 +38,52 @@ public:
 	 * Retrieves cached intents (Move, Jump) via Interface and injects them into Mover's data model.
 	 */
 	virtual void ProduceInput_Implementation(int32 SimTime, FMoverInputCmdContext& InputCmdResult) override;
-};
\ No newline at end of file
+
+protected:
+	//~UActorComponent interface
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	//~End of UActorComponent interface
+
+	/** Returns the owner pawn if it is locally controlled, as of the last possession change. */
+	APawn* GetLocallyControlledOwner() const { return bOwnerLocallyControlled ? CachedOwnerPawn.Get() : nullptr; }
+
+	/** How the owner's IGCFLocomotionInputProvider functions are called. */
+	enum class EGCFProviderCallMode : uint8
+	{
+		Unresolved,
+		None,		// Owner does not implement the interface.
+		Native,		// Direct call of the C++ _Implementation functions.
+		Reflected	// Execute_ calls, required for Blueprint implementations and overrides.
+	};
+
+	/** Returns the call mode resolved on the last possession change, resolving it now if nothing has been resolved yet. */
+	EGCFProviderCallMode GetProviderCallMode(APawn* OwnerPawn);
+
+	/** Reads the movement intents from the owner through the resolved call mode. Consumes the jump "just pressed" flag. */
+	void ReadLocomotionIntents(APawn* OwnerPawn, FVector& OutMove, FVector& OutOrientation, bool& bOutJumpPressed, bool& bOutJumpJustPressed);
+
+	/** Returns true if the owner intends to crouch, through the resolved call mode. */
+	bool ReadWantsToCrouch(APawn* OwnerPawn);
+
+private:
+	friend struct FGCFLocomotionInputProducerTestAccess;
+
+	void ResolveProvider(APawn* OwnerPawn, bool bAllowNative);
+
+	/** Possession binder callback. Refreshes the cached owner state and re-resolves the provider. */
+	void HandlePossessionChanged(AActor* Actor, bool bPossessed);
+	void RefreshOwnerState();
+
+	UPROPERTY(Transient)
+	TObjectPtr<APawn> CachedOwnerPawn;
+
+	bool bOwnerLocallyControlled = false;
+
+	TArray<TUniquePtr<FGCFContextBinder>> PossessionBinders;
+
+	EGCFProviderCallMode ProviderCallMode = EGCFProviderCallMode::Unresolved;
+
+	/** Valid only in Native mode. Points into the owner, which outlives this component. */
+	IGCFLocomotionInputProvider* NativeProvider = nullptr;
+};
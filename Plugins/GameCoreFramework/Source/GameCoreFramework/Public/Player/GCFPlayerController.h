@@ -126,7 +126,7 @@ private:
 
 	void BroadcastOnPlayerStateChanged();
 
-	void OnCameraModeMessageReceived(FGameplayTag Channel, const FGCFPolicyChangedCursorMessage& Message);
+	void OnCameraModeMessageReceived(const FGCFPolicyChangedCursorMessage& Message);
 
 private:
 	UPROPERTY()
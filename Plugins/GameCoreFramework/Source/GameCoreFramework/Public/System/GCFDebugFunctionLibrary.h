@@ -12,6 +12,11 @@
 /**
  * Utility library for formatting and broadcasting debug information.
  * Uses the Gameplay Message Subsystem to dispatch logs and states without direct UI dependencies.
+ * Nothing is formatted or broadcast unless IsDebugChannelActive() (see UGCFDebugSubsystem).
+ *
+ * [Note]
+ * GCF's own components no longer push state through this library. They mark state dirty on UGCFDebugSubsystem,
+ * which builds snapshots on demand. The Send*StateMessage functions remain for Blueprint and project code.
  */
 UCLASS()
 class GAMECOREFRAMEWORK_API UGCFDebugFunctionLibrary : public UBlueprintFunctionLibrary
@@ -69,7 +74,14 @@ public:
 	UFUNCTION(BlueprintPure, Category = "GCF|Debug", meta = (Keywords = "Log Format RichText"))
 	static FText FormatLogMessage(EGCFDebugLogVerbosity Verbosity, const FString& InMessage);
 
-	/** Broadcasts a general debug log message via the Gameplay Message Subsystem. */
+	/**
+	 * Returns true if a debug consumer is currently listening.
+	 * Native callers should check this before formatting expensive message strings.
+	 */
+	UFUNCTION(BlueprintPure, Category = "GCF|Debug", meta = (WorldContext = "WorldContext"))
+	static bool IsDebugChannelActive(const UObject* WorldContext);
+
+	/** Records a general debug log message in the debug registry, which publishes it at the snapshot refresh rate. */
 	UFUNCTION(BlueprintCallable, Category = "GCF|Debug")
 	static void SendLogMessage(const UObject* WorldContext, EGCFDebugLogVerbosity Verbosity, const FString& Msg);
 
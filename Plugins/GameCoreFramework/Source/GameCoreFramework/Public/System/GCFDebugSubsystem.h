@@ -0,0 +1,163 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Common/GCFDebugTypes.h"
+#include "Engine/TimerHandle.h"
+#include "GCFDebugSubsystem.generated.h"
+
+#define UE_API GAMECOREFRAMEWORK_API
+
+/** Native getter returning the current display value of a debug state category. */
+DECLARE_DELEGATE_RetVal(FString, FGCFDebugStateValueGetter);
+
+/** Native builder filling the current input binding snapshot. */
+DECLARE_DELEGATE_OneParam(FGCFDebugInputSnapshotBuilder, FGCFDebugInputSnapshot&);
+
+/**
+ * @brief World-level registry of debug listeners and pull-based debug snapshots.
+ *
+ * [Problem Solved]
+ * Debug state used to be formatted and pushed on every gameplay change, so debug overhead scaled with
+ * the gameplay event rate, even when no debug HUD was open.
+ *
+ * [Solution]
+ * - Listener Gate: Debug consumers register while they are visible. Nothing is built when nobody listens.
+ * - Dirty Flags: Gameplay code only marks a category dirty and names the getter that can produce its value.
+ * - Pull: Consumers ask for a snapshot (GetStateSnapshot / GetInputSnapshot) at their own refresh rate,
+ *   and values are only formatted for categories that changed since the last pull.
+ * - Publish: At "GCF.Debug.SnapshotRefreshRate" Hz, changed entries are published on the UGCFNativeMessageSubsystem
+ *   (FGCFDebugStateEntry, FGCFDebugInputSnapshot, FGCFDebugLogEntry) for native consumers.
+ *   The UGameplayMessageSubsystem path is kept only because the Blueprint debug widgets listen on the Message.Debug tags.
+ *
+ * [Note]
+ * The sample debug widgets listen on GameplayMessage tags. The HUD hosting them registers on their behalf:
+ * UGameFeatureAction_AddWidgets registers the HUD while it holds widgets in a "UI.Slot.Debug" slot.
+ * The console variable "GCF.Debug.AlwaysBroadcast" (default false) forces the channel open for consumers that cannot register.
+ */
+UCLASS(MinimalAPI)
+class UGCFDebugSubsystem final : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns the subsystem owned by the world of the given context, or nullptr (always nullptr in Shipping). */
+	UE_API static UGCFDebugSubsystem* Get(const UObject* WorldContextObject);
+
+	//~USubsystem interface
+	UE_API virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	UE_API virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	UE_API virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	/** Registers an object that consumes debug messages. The object is held weakly. */
+	UFUNCTION(BlueprintCallable, Category = "GCF|Debug")
+	UE_API void RegisterDebugListener(UObject* Listener);
+
+	/** Unregisters a debug consumer previously passed to RegisterDebugListener. */
+	UFUNCTION(BlueprintCallable, Category = "GCF|Debug")
+	UE_API void UnregisterDebugListener(UObject* Listener);
+
+	/** Returns true if at least one live debug consumer is registered, or if broadcasting is forced by console variable. */
+	UFUNCTION(BlueprintPure, Category = "GCF|Debug")
+	UE_API bool HasDebugListeners() const;
+
+	// ----------------------------------------------------------------------------------------------------------------
+	// Producer API (cheap, called from gameplay code)
+	// ----------------------------------------------------------------------------------------------------------------
+
+	/**
+	 * Marks a state category as changed. The getter is only bound when the source object changes,
+	 * and is only invoked when a consumer pulls the snapshot.
+	 */
+	template<typename TSource>
+	void MarkStateDirty(EGCFDebugStateCategory Category, TSource* Source, FString (TSource::*ValueGetter)() const)
+	{
+		FGCFDebugStateSlot& Slot = StateSlots.FindOrAdd(Category);
+		if (!Slot.ValueGetter.IsBoundToObject(Source)) {
+			Slot.ValueGetter.BindUObject(Source, ValueGetter);
+		}
+		Slot.bDirty = true;
+	}
+
+	/** Marks the input binding snapshot as changed. The builder is only invoked when a consumer pulls the snapshot. */
+	template<typename TSource>
+	void MarkInputSnapshotDirty(TSource* Source, void (TSource::*Builder)(FGCFDebugInputSnapshot&) const)
+	{
+		if (!InputSlot.Builder.IsBoundToObject(Source)) {
+			InputSlot.Builder.BindUObject(Source, Builder);
+		}
+		InputSlot.bDirty = true;
+	}
+
+	/** Appends a log entry to the ring buffer. Callers are expected to check HasDebugListeners() before formatting. */
+	UE_API void AddLogEntry(EGCFDebugLogVerbosity Verbosity, const FString& Message);
+
+	/** Publishes a state entry immediately, for producers that push a value instead of marking a slot dirty. */
+	UE_API void PublishStateEntry(const FGCFDebugStateEntry& Entry);
+
+	// ----------------------------------------------------------------------------------------------------------------
+	// Consumer API (pull)
+	// ----------------------------------------------------------------------------------------------------------------
+
+	/** Returns the current value of every known state category, re-evaluating only the dirty ones. */
+	UFUNCTION(BlueprintCallable, Category = "GCF|Debug")
+	UE_API TArray<FGCFDebugStateEntry> GetStateSnapshot();
+
+	/** Returns the current input binding snapshot, rebuilding it only if it changed. */
+	UFUNCTION(BlueprintCallable, Category = "GCF|Debug")
+	UE_API FGCFDebugInputSnapshot GetInputSnapshot();
+
+	/**
+	 * Returns the log entries added after the given sequence number.
+	 * @param OutLatestSequence  Pass this value back on the next call to only receive new entries.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GCF|Debug")
+	UE_API TArray<FGCFDebugLogEntry> GetLogEntriesSince(int32 Sequence, int32& OutLatestSequence) const;
+
+	/** Logs the current snapshot. Backs the "GCF.Debug.DumpSnapshot" console command. */
+	UE_API void DumpSnapshot();
+
+private:
+	struct FGCFDebugStateSlot
+	{
+		FGCFDebugStateValueGetter ValueGetter;
+		FGCFDebugStateEntry Cached;
+		bool bDirty = false;
+
+		/** True if the cached entry changed since the last compatibility publish. */
+		bool bPendingPublish = false;
+	};
+
+	struct FGCFDebugInputSlot
+	{
+		FGCFDebugInputSnapshotBuilder Builder;
+		FGCFDebugInputSnapshot Cached;
+		bool bDirty = false;
+		bool bPendingPublish = false;
+	};
+
+	/** Re-evaluates dirty slots. Returns silently if nothing changed. */
+	void RefreshDirtySlots();
+
+	/** Timer callback publishing changed entries to native and Blueprint consumers. */
+	void PublishPendingEntries();
+
+private:
+	TArray<TWeakObjectPtr<UObject>> Listeners;
+
+	TMap<EGCFDebugStateCategory, FGCFDebugStateSlot> StateSlots;
+	FGCFDebugInputSlot InputSlot;
+
+	/** Fixed-size ring buffer of recent log entries. */
+	TArray<FGCFDebugLogEntry> LogEntries;
+	int32 LogSequence = 0;
+	int32 LastPublishedLogSequence = 0;
+
+	FTimerHandle PublishTimerHandle;
+};
+
+#undef UE_API
@@ -61,6 +61,11 @@ public:
 	UFUNCTION(NetMulticast, Reliable, BlueprintCallable, Category = "GCF|GameState")
 	void MulticastReliableMessageToClients(const FGCFVerbMessage Message);
 
+	// Send a message only to the clients selected by the message's Relevancy settings (unreliable, like MulticastMessageToClients)
+	// Messages relevant to everyone still go through a single multicast
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "GCF|GameState")
+	void SendMessageToRelevantClients(const FGCFVerbMessage& Message);
+
 	// Gets the server's FPS, replicated to clients
 	float GetServerFPS() const;
 
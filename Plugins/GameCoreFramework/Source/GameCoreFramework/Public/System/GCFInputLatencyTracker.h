@@ -0,0 +1,109 @@
+﻿// Copyright (c) 2026 munimaru62o. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+/** Input latency instrumentation is compiled out of Shipping builds. */
+#define GCF_WITH_INPUT_LATENCY (!UE_BUILD_SHIPPING)
+
+/** Pipeline stages measured by FGCFInputLatencyTracker. */
+enum class EGCFInputLatencyStage : uint8
+{
+	/** Locomotion input received by the input component -> intent consumed by the Mover input producer. */
+	LocomotionIntent,
+
+	/** Ability input received by an input bridge -> ability activated in ProcessAbilityInput. */
+	AbilityActivation,
+
+	/** Activation request from a remote client received by the server -> ability activated on the server. */
+	ServerAbilityActivation,
+
+	Max
+};
+
+/** Time and frame at which an input event was received. */
+struct FGCFInputTimestamp
+{
+	uint64 Cycles = 0;
+	uint64 Frame = 0;
+
+	bool IsSet() const { return Cycles != 0; }
+};
+
+/**
+ * @brief Optional input-to-simulation latency instrumentation.
+ *
+ * [Problem Solved]
+ * There was no way to see how many frames pass between an Enhanced Input trigger and the moment
+ * its effect is consumed by the simulation (Mover input producer, ability activation).
+ *
+ * [Solution]
+ * - Input handlers stamp the event when it enters the GCF input path.
+ * - The consuming stage reports the elapsed frames and milliseconds for the oldest pending stamp.
+ * - On the server, activation requests from remote clients are stamped on receipt and reported on activation.
+ * - Locomotion stamps that are not consumed within "GCF.Input.Latency.MaxPendingFrames" are discarded,
+ *   so pawns that stop producing input (destroyed, unpossessed, no Mover) do not leave entries behind.
+ * - Each sample updates a per-stage histogram, the "stat GCFInputLatency" counters, and is emitted
+ *   on the "GCFInputLatency" trace channel for Unreal Insights.
+ *
+ * [Note]
+ * Disabled by default ("GCF.Input.Latency.Enable 1" to enable). All calls compile to no-ops in Shipping.
+ * Game thread only. Histograms are printed by "GCF.Input.Latency.Dump" and cleared by "GCF.Input.Latency.Reset".
+ */
+class GAMECOREFRAMEWORK_API FGCFInputLatencyTracker
+{
+public:
+#if GCF_WITH_INPUT_LATENCY
+	/** Returns true if latency tracking is enabled by console variable. */
+	static bool IsEnabled();
+
+	/** Stamps an ability input event. A newer press of the same tag replaces the pending stamp. */
+	static void MarkAbilityInput(const FGameplayTag& InputTag);
+
+	/** Reports the activation latency for the first of the given input tags that has a pending stamp. */
+	static void ReportAbilityActivation(const FGameplayTagContainer& InputTags);
+
+	/** Drops ability stamps that did not lead to an activation this frame. */
+	static void ClearPendingAbilityInputs();
+
+	/** Stamps a locomotion input event for the pawn. An older pending stamp is kept, so the oldest input is measured. */
+	static void MarkLocomotionInput(const UObject* Pawn);
+
+	/** Reports the latency of the pawn's pending locomotion stamp, if any. */
+	static void ConsumeLocomotionInput(const UObject* Pawn);
+
+	/** Drops the pawn's pending locomotion stamp without reporting it. */
+	static void ForgetLocomotionInput(const UObject* Pawn);
+
+	/** Stamps an ability activation request received by the server from a remote client. */
+	static void MarkServerAbilityRequest();
+
+	/** Reports the server activation latency of the pending request, if any. */
+	static void ReportServerAbilityActivation();
+
+	/** Drops the pending server request, e.g. when it did not lead to an activation. */
+	static void ClearServerAbilityRequest();
+
+	/** Logs the histogram of every stage. */
+	static void DumpHistograms();
+
+	/** Clears all histograms and pending stamps. */
+	static void Reset();
+#else
+	static bool IsEnabled() { return false; }
+	static void MarkAbilityInput(const FGameplayTag& InputTag) {}
+	static void ReportAbilityActivation(const FGameplayTagContainer& InputTags) {}
+	static void ClearPendingAbilityInputs() {}
+	static void MarkLocomotionInput(const UObject* Pawn) {}
+	static void ConsumeLocomotionInput(const UObject* Pawn) {}
+	static void ForgetLocomotionInput(const UObject* Pawn) {}
+	static void MarkServerAbilityRequest() {}
+	static void ReportServerAbilityActivation() {}
+	static void ClearServerAbilityRequest() {}
+	static void DumpHistograms() {}
+	static void Reset() {}
+#endif
+};
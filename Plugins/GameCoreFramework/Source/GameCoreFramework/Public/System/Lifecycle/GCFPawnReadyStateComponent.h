@@ -76,6 +76,9 @@ protected:
 
 	FGCFPawnReadyStateSnapshot MakeSnapshot(EGCFPawnReadyState State);
 
+	/** Formats the cached state for the debug registry. Only called when a debug consumer pulls it. */
+	FString GetDebugStateValue() const;
+
 protected:
 	/** Blueprint-assignable delegate for state changes. */
 	UPROPERTY(BlueprintAssignable, Category = "GCF|ReadyState")
@@ -44,6 +44,9 @@ private:
 	/** Helper to send extension events via GFCM. */
 	void BroadcastEvent(APawn* Pawn, FName EventName);
 
+	/** Returns the possessed pawn name for the debug registry. Only called when a debug consumer pulls it. */
+	FString GetDebugStateValue() const;
+
 private:
 	/** Scoped handle to automatically unbind from the possession tracker. */
 	TUniquePtr<FGCFDelegateHandle> PossessionTrackerHandle;